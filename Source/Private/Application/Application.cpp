@@ -9,7 +9,6 @@
 #include <Application/Window.h>
 #include <SDL.h>
 #include <ImGui/ImGuiWrapper.h>
-#include <Application/ApplicationInput.h>
 
 using namespace Zn;
 
@@ -48,8 +47,6 @@ void Application::Initialize()
 
         window = std::make_shared<Window>(SCREEN_WIDTH, SCREEN_HEIGHT, "Zn-Engine");
 
-        input = std::make_shared<InputState>();
-
         is_initialized = true;
 
         ZN_LOG(LogApplication, ELogVerbosity::Log, "Application Initialized");
@@ -65,6 +62,10 @@ void Application::Shutdown()
     if (is_initialized)
     {
         SDLWrapper::Shutdown();
+
+        IO::Shutdown();
+
+        ThreadPool::ShutdownWorkerPool();
     }
 }
 
@@ -74,8 +75,6 @@ bool Application::ProcessOSEvents(float deltaTime)
 
     SDL_Event event;
 
-    input->events.clear();
-
     while (SDL_PollEvent(&event) != 0)
     {
         imgui_process_event(event);
@@ -90,7 +89,7 @@ bool Application::ProcessOSEvents(float deltaTime)
         }
         else if (event.type >= SDL_KEYDOWN && event.type <= SDL_CONTROLLERSENSORUPDATE)
         {
-            input->events.push_back(event);
+            inputEvent.Broadcast(event, deltaTime);
         }
     }
 
@@ -102,9 +101,9 @@ SharedPtr<Window> Application::GetWindow() const
     return window;
 }
 
-SharedPtr<InputState> Zn::Application::GetInputState() const
+Application::InputEvent& Zn::Application::GetInputEvent()
 {
-    return input;
+    return inputEvent;
 }
 
 void Application::RequestExit(String exitReason)
@@ -4,7 +4,6 @@
 #include <SDL.h>
 #include <SDL_syswm.h>
 #include <ImGui/ImGuiWrapper.h>
-#include <Rendering/Renderer.h>
 
 DEFINE_STATIC_LOG_CATEGORY(LogWindow, ELogVerbosity::Log);
 
@@ -52,18 +51,17 @@ bool Zn::Window::ProcessEvent(SDL_Event event)
             return false;
         }
 
-        // TODO: Implement as events, so that we remove the strong-reference to Renderer
         if (event.window.event == SDL_WINDOWEVENT_RESIZED)
         {
-            Renderer::Get().on_window_resized();
+            resizedEvent.Broadcast();
         }
         else if (event.window.event == SDL_WINDOWEVENT_MINIMIZED)
         {
-            Renderer::Get().on_window_minimized();
+            minimizedEvent.Broadcast();
         }
         else if (event.window.event == SDL_WINDOWEVENT_RESTORED)
         {
-            Renderer::Get().on_window_restored();
+            restoredEvent.Broadcast();
         }
     }
 
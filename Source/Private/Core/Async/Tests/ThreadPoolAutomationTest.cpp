@@ -0,0 +1,155 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Core/Async/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_ThreadPool, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+class ThreadPoolAutomationTest : public AutomationTest
+{
+  public:
+    ThreadPoolAutomationTest(u32 numThreads_, u32 numTasks_)
+        : numThreads(numThreads_)
+        , numTasks(numTasks_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        bool bMatches = true;
+
+        {
+            ThreadPool pool("AutomationTest", numThreads);
+
+            std::atomic<u64> sum {0};
+            std::atomic<u32> numCompleted {0};
+
+            Vector<ThreadPool::Task> tasks;
+
+            for (u32 index = 0; index < numTasks; ++index)
+            {
+                tasks.push_back(
+                    [&sum, &numCompleted, index]
+                    {
+                        sum.fetch_add(index);
+                        numCompleted.fetch_add(1, std::memory_order_release);
+                    });
+            }
+
+            pool.EnqueueBatch(std::move(tasks));
+
+            // Help the workers until every task has run.
+            while (numCompleted.load(std::memory_order_acquire) < numTasks)
+            {
+                if (!pool.TryRunPendingTask())
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            bMatches &= sum == u64(numTasks) * (numTasks - 1) / 2;
+        }
+
+        {
+            // With the single worker blocked, queued tasks must run by priority and then in submission order.
+            std::mutex  orderMutex;
+            Vector<i32> order;
+
+            auto Record = [&order, &orderMutex](i32 value)
+            {
+                return [&order, &orderMutex, value]
+                {
+                    std::scoped_lock lock(orderMutex);
+                    order.push_back(value);
+                };
+            };
+
+            {
+                ThreadPool pool("AutomationTestPriority", 1);
+
+                std::promise<void>       release;
+                std::shared_future<void> releaseFuture = release.get_future().share();
+
+                pool.Enqueue(
+                    [releaseFuture]
+                    {
+                        releaseFuture.wait();
+                    });
+
+                pool.Enqueue(Record(3), ETaskPriority::Low);
+                pool.Enqueue(Record(1), ETaskPriority::Normal);
+                pool.Enqueue(Record(2), ETaskPriority::Normal);
+                pool.Enqueue(Record(0), ETaskPriority::High);
+
+                release.set_value();
+            } // The destructor completes the queued tasks.
+
+            bMatches &= order == Vector<i32> {0, 1, 2, 3};
+        }
+
+        {
+            // Every index is visited exactly once, including when called from a task of the same pool.
+            ThreadPool pool("AutomationTestParallelFor", numThreads);
+
+            Vector<u32> visits(numTasks, 0);
+
+            pool.ParallelFor(numTasks,
+                             [&visits](sizet index)
+                             {
+                                 ++visits[index];
+                             });
+
+            std::promise<Vector<u32>> nestedVisits;
+
+            pool.Enqueue(
+                [&pool, &nestedVisits, this]
+                {
+                    Vector<u32> visits(numTasks, 0);
+
+                    pool.ParallelFor(numTasks,
+                                     [&visits](sizet index)
+                                     {
+                                         visits[index] += 2;
+                                     });
+
+                    nestedVisits.set_value(std::move(visits));
+                });
+
+            const Vector<u32> nested = nestedVisits.get_future().get();
+
+            bMatches &= std::all_of(visits.begin(),
+                                    visits.end(),
+                                    [](u32 count)
+                                    {
+                                        return count == 1;
+                                    });
+            bMatches &= std::all_of(nested.begin(),
+                                    nested.end(),
+                                    [](u32 count)
+                                    {
+                                        return count == 2;
+                                    });
+
+            pool.ParallelFor(0,
+                             [&bMatches](sizet)
+                             {
+                                 bMatches = false;
+                             });
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+  private:
+    u32 numThreads = 1;
+    u32 numTasks   = 0;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(ThreadPoolAutomationTest, Zn::Automation::ThreadPoolAutomationTest, 4, 100000);
@@ -0,0 +1,268 @@
+#include <Znpch.h>
+#include "Core/Async/ThreadPool.h"
+#include "Core/Async/Thread.h"
+#include "Core/Async/ThreadedJob.h"
+#include "Core/HAL/PlatformTypes.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+DEFINE_STATIC_LOG_CATEGORY(LogThreadPool, ELogVerbosity::Log);
+
+namespace Zn
+{
+namespace
+{
+std::mutex            s_WorkerPoolMutex;
+UniquePtr<ThreadPool> s_WorkerPool;
+} // namespace
+
+class ThreadPoolWorker : public ThreadedJob
+{
+  public:
+    ThreadPoolWorker(ThreadPool& pool)
+        : m_Pool(pool)
+    {
+    }
+
+    virtual void DoWork() override
+    {
+        m_Pool.WorkerLoop();
+    }
+
+  private:
+    ThreadPool& m_Pool;
+};
+
+ThreadPool::ThreadPool(String name, uint32 numThreads)
+    : m_Name(std::move(name))
+{
+    numThreads = std::max(numThreads, 1u);
+
+    m_Workers.reserve(numThreads);
+    m_Threads.reserve(numThreads);
+
+    for (uint32 index = 0; index < numThreads; ++index)
+    {
+        ThreadPoolWorker* worker = m_Workers.emplace_back(std::make_unique<ThreadPoolWorker>(*this)).get();
+
+        if (Thread* thread = Thread::New(m_Name + "_" + std::to_string(index), worker))
+        {
+            m_Threads.push_back(thread);
+        }
+    }
+
+    checkMsg(m_Threads.size() > 0, "ThreadPool %s failed to create any worker thread.", m_Name.c_str());
+
+    ZN_LOG(LogThreadPool, ELogVerbosity::Log, "ThreadPool %s started with %u threads.", m_Name.c_str(), GetNumThreads());
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::scoped_lock lock(m_Mutex);
+        m_bStopping = true;
+    }
+
+    m_Condition.notify_all();
+
+    for (Thread* thread : m_Threads)
+    {
+        thread->WaitUntilCompletion();
+        delete thread;
+    }
+
+    m_Threads.clear();
+    m_Workers.clear();
+}
+
+void ThreadPool::Enqueue(Task&& task, ETaskPriority priority)
+{
+    check(priority < ETaskPriority::Count);
+
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        checkMsg(!m_bStopping, "Enqueueing a task on ThreadPool %s while it is shutting down.", m_Name.c_str());
+
+        m_Queues[static_cast<sizet>(priority)].push_back(std::move(task));
+    }
+
+    m_Condition.notify_one();
+}
+
+void ThreadPool::EnqueueBatch(Vector<Task>&& tasks, ETaskPriority priority)
+{
+    check(priority < ETaskPriority::Count);
+
+    if (tasks.empty())
+    {
+        return;
+    }
+
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        checkMsg(!m_bStopping, "Enqueueing tasks on ThreadPool %s while it is shutting down.", m_Name.c_str());
+
+        std::deque<Task>& queue = m_Queues[static_cast<sizet>(priority)];
+
+        std::move(tasks.begin(), tasks.end(), std::back_inserter(queue));
+    }
+
+    if (tasks.size() == 1)
+    {
+        m_Condition.notify_one();
+    }
+    else
+    {
+        m_Condition.notify_all();
+    }
+
+    tasks.clear();
+}
+
+bool ThreadPool::TryRunPendingTask()
+{
+    Task task;
+
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        if (!PopTask(task))
+        {
+            return false;
+        }
+    }
+
+    task();
+
+    return true;
+}
+
+void ThreadPool::ParallelFor(sizet count, const std::function<void(sizet)>& body)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    std::atomic<sizet>  nextIndex {0};
+    std::atomic<uint32> numRunningTasks {0};
+
+    auto runIndices = [&nextIndex, &body, count]()
+    {
+        for (sizet index = nextIndex.fetch_add(1, std::memory_order_relaxed); index < count;
+             index       = nextIndex.fetch_add(1, std::memory_order_relaxed))
+        {
+            body(index);
+        }
+    };
+
+    // The calling thread takes part, no need for more tasks than remaining indices.
+    const uint32 numTasks = static_cast<uint32>(std::min<sizet>(count - 1, GetNumThreads()));
+
+    if (numTasks > 0)
+    {
+        numRunningTasks.store(numTasks, std::memory_order_relaxed);
+
+        Vector<Task> tasks;
+        tasks.reserve(numTasks);
+
+        for (uint32 index = 0; index < numTasks; ++index)
+        {
+            tasks.push_back(
+                [&runIndices, &numRunningTasks]()
+                {
+                    runIndices();
+                    numRunningTasks.fetch_sub(1, std::memory_order_release);
+                });
+        }
+
+        EnqueueBatch(std::move(tasks), ETaskPriority::High);
+    }
+
+    runIndices();
+
+    // The tasks reference this stack frame, wait for all of them to exit. Help with the queue meanwhile, they may not have started yet.
+    while (numRunningTasks.load(std::memory_order_acquire) > 0)
+    {
+        if (!TryRunPendingTask())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+uint32 ThreadPool::GetDefaultNumThreads()
+{
+    const uint32 numProcessors = PlatformMisc::GetSystemInfo().m_NumOfProcessors;
+
+    return std::max(numProcessors, 2u) - 1;
+}
+
+ThreadPool& ThreadPool::GetWorkerPool()
+{
+    std::scoped_lock lock(s_WorkerPoolMutex);
+
+    if (!s_WorkerPool)
+    {
+        s_WorkerPool = std::make_unique<ThreadPool>("Worker", GetDefaultNumThreads());
+    }
+
+    return *s_WorkerPool;
+}
+
+void ThreadPool::ShutdownWorkerPool()
+{
+    std::scoped_lock lock(s_WorkerPoolMutex);
+    s_WorkerPool.reset();
+}
+
+void ThreadPool::WorkerLoop()
+{
+    for (;;)
+    {
+        Task task;
+
+        {
+            std::unique_lock lock(m_Mutex);
+
+            m_Condition.wait(lock,
+                             [this]
+                             {
+                                 return m_bStopping || std::any_of(std::begin(m_Queues),
+                                                                   std::end(m_Queues),
+                                                                   [](const std::deque<Task>& queue)
+                                                                   {
+                                                                       return !queue.empty();
+                                                                   });
+                             });
+
+            // Queued work is always completed before the workers exit.
+            if (!PopTask(task))
+            {
+                return;
+            }
+        }
+
+        task();
+    }
+}
+
+bool ThreadPool::PopTask(Task& outTask)
+{
+    for (std::deque<Task>& queue : m_Queues)
+    {
+        if (!queue.empty())
+        {
+            outTask = std::move(queue.front());
+            queue.pop_front();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+} // namespace Zn
@@ -0,0 +1,192 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Core/Containers/FlatMap.h"
+#include "Core/Containers/FlatSet.h"
+#include "Core/Containers/Map.h"
+#include "Core/Time/Time.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_FlatMap, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Randomized insert/erase/find sequence checked against std::pmr::unordered_map.
+class FlatMapAutomationTest : public AutomationTest
+{
+  public:
+    FlatMapAutomationTest(sizet numOperations_, u64 keyRange_)
+        : numOperations(numOperations_)
+        , keyRange(keyRange_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        std::mt19937_64                    gen(0x5EED);
+        std::uniform_int_distribution<u64> keys(0, keyRange);
+        std::uniform_int_distribution<u32> operations(0, 9);
+
+        FlatMap<u64, u64>      flatMap;
+        UnorderedMap<u64, u64> referenceMap;
+
+        bool bMatches = true;
+
+        for (sizet index = 0; index < numOperations && bMatches; ++index)
+        {
+            const u64 key = keys(gen);
+
+            switch (operations(gen))
+            {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+                bMatches &= flatMap.insert({key, index}).second == referenceMap.insert({key, index}).second;
+                break;
+            case 4:
+                flatMap[key] = index;
+                referenceMap[key] = index;
+                break;
+            case 5:
+            case 6:
+                bMatches &= flatMap.erase(key) == referenceMap.erase(key);
+                break;
+            default:
+            {
+                auto flatIt      = flatMap.find(key);
+                auto referenceIt = referenceMap.find(key);
+                bMatches &= (flatIt == flatMap.end()) == (referenceIt == referenceMap.end());
+                bMatches &= flatIt == flatMap.end() || flatIt->second == referenceIt->second;
+                break;
+            }
+            }
+
+            bMatches &= flatMap.size() == referenceMap.size();
+        }
+
+        sizet visited = 0;
+        for (const auto& [key, value] : flatMap)
+        {
+            auto referenceIt = referenceMap.find(key);
+            bMatches &= referenceIt != referenceMap.end() && referenceIt->second == value;
+            ++visited;
+        }
+
+        bMatches &= visited == referenceMap.size();
+
+        // Erase while iterating must visit every element exactly once.
+        for (auto it = flatMap.begin(); it != flatMap.end();)
+        {
+            it = (it->first & 1) ? flatMap.erase(it) : std::next(it);
+        }
+
+        bMatches &= std::all_of(flatMap.begin(),
+                                flatMap.end(),
+                                [](const auto& pair)
+                                {
+                                    return (pair.first & 1) == 0;
+                                });
+
+        FlatSet<u64> flatSet(std::initializer_list<u64> {1, 2, 3, 2, 1});
+        bMatches &= flatSet.size() == 3 && flatSet.contains(2) && !flatSet.contains(4);
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+  private:
+    sizet numOperations = 0;
+    u64   keyRange      = 0;
+};
+
+// Logs insert/find/erase timings of FlatMap against UnorderedMap for the same key sequence.
+class FlatMapBenchmarkAutomationTest : public AutomationTest
+{
+  public:
+    FlatMapBenchmarkAutomationTest(sizet numElements_)
+        : numElements(numElements_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        std::mt19937_64 gen(0xF1A7);
+
+        keys.resize(numElements);
+        std::generate(keys.begin(), keys.end(), gen);
+
+        lookups = keys;
+        std::shuffle(lookups.begin(), lookups.end(), gen);
+    }
+
+    virtual void Execute() override
+    {
+        const u64 flatChecksum      = Run<FlatMap<u64, u64>>("FlatMap");
+        const u64 referenceChecksum = Run<UnorderedMap<u64, u64>>("UnorderedMap");
+
+        ZN_TEST_VERIFY(flatChecksum == referenceChecksum, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        keys.clear();
+        lookups.clear();
+    }
+
+  private:
+    template<typename TMap>
+    u64 Run(const char* label)
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        TMap map;
+        u64  checksum = 0;
+
+        auto start = SystemClock::now();
+
+        for (sizet index = 0; index < keys.size(); ++index)
+        {
+            map.insert({keys[index], index});
+        }
+
+        auto inserted = SystemClock::now();
+
+        for (u64 key : lookups)
+        {
+            if (auto it = map.find(key); it != map.end())
+            {
+                checksum += it->second;
+            }
+        }
+
+        auto found = SystemClock::now();
+
+        for (u64 key : lookups)
+        {
+            map.erase(key);
+        }
+
+        auto erased = SystemClock::now();
+
+        ZN_LOG(LogAutomationTest_FlatMap,
+               ELogVerbosity::Log,
+               "%s [%zu elements] insert: %.2fms find: %.2fms erase: %.2fms",
+               label,
+               keys.size(),
+               Milliseconds(inserted - start).count(),
+               Milliseconds(found - inserted).count(),
+               Milliseconds(erased - found).count());
+
+        return checksum + map.size();
+    }
+
+    sizet       numElements = 0;
+    Vector<u64> keys;
+    Vector<u64> lookups;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(FlatMapAutomationTest, Zn::Automation::FlatMapAutomationTest, 200000, 4096);
+DEFINE_AUTOMATION_STARTUP_TEST(FlatMapBenchmarkAutomationTest, Zn::Automation::FlatMapBenchmarkAutomationTest, 1000000);
@@ -0,0 +1,187 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Core/Containers/InlineVector.h"
+#include "Core/Containers/StaticVector.h"
+#include "Core/Time/Time.h"
+#include <chrono>
+#include <numeric>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_InlineVector, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Exercises growth past the inline capacity, moves between inline/heap storage and element lifetimes.
+class InlineVectorAutomationTest : public AutomationTest
+{
+  public:
+    struct Tracked
+    {
+        Tracked()
+            : Tracked(0)
+        {
+        }
+
+        Tracked(i32 value_)
+            : value(value_)
+        {
+            ++s_Alive;
+        }
+
+        Tracked(const Tracked& other)
+            : value(other.value)
+        {
+            ++s_Alive;
+        }
+
+        Tracked(Tracked&& other) noexcept
+            : value(other.value)
+        {
+            ++s_Alive;
+        }
+
+        Tracked& operator=(const Tracked&) = default;
+        Tracked& operator=(Tracked&&)      = default;
+
+        ~Tracked()
+        {
+            --s_Alive;
+        }
+
+        bool operator==(const Tracked& other) const
+        {
+            return value == other.value;
+        }
+
+        i32 value = 0;
+
+        static inline i32 s_Alive = 0;
+    };
+
+    virtual void Execute() override
+    {
+        bool bMatches = true;
+
+        {
+            InlineVector<Tracked, 4> values;
+
+            for (i32 index = 0; index < 4; ++index)
+            {
+                values.emplace_back(index);
+            }
+
+            bMatches &= values.IsInline() && values.size() == 4;
+
+            // Self-referencing push across the growth boundary.
+            values.push_back(values[0]);
+            bMatches &= !values.IsInline() && values.back().value == 0 && values.size() == 5;
+
+            values.insert(values.begin() + 1, Tracked(42));
+            bMatches &= values[1].value == 42 && values[2].value == 1;
+
+            values.erase(values.begin(), values.begin() + 2);
+            bMatches &= values.size() == 4 && values.front().value == 1;
+
+            values.EraseSwap(values.begin());
+            bMatches &= values.size() == 3 && values.front().value == 0;
+
+            InlineVector<Tracked, 4> moved = std::move(values);
+            bMatches &= values.empty() && values.IsInline() && moved.size() == 3;
+
+            moved.shrink_to_fit();
+            bMatches &= moved.IsInline() && moved.size() == 3;
+
+            InlineVector<Tracked, 4> copied = moved;
+            bMatches &= copied == moved;
+
+            copied.resize(16, Tracked(7));
+            bMatches &= copied.size() == 16 && copied.back().value == 7;
+
+            copied.resize(2);
+            bMatches &= copied.size() == 2 && Tracked::s_Alive == 3 + 2;
+        }
+
+        bMatches &= Tracked::s_Alive == 0;
+
+        {
+            StaticVector<Tracked, 8> values {1, 2, 3};
+            bMatches &= values.size() == 3 && values.capacity() == 8;
+
+            while (values.TryEmplaceBack(0))
+            {
+            }
+
+            bMatches &= values.full() && values.size() == 8;
+
+            values.erase(values.begin() + 1);
+            bMatches &= values[1].value == 3 && values.size() == 7;
+
+            StaticVector<Tracked, 8> moved = std::move(values);
+            bMatches &= values.empty() && moved.size() == 7;
+        }
+
+        bMatches &= Tracked::s_Alive == 0;
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+};
+
+// Logs the cost of building many short-lived lists with Vector, InlineVector and StaticVector.
+class InlineVectorBenchmarkAutomationTest : public AutomationTest
+{
+  public:
+    InlineVectorBenchmarkAutomationTest(sizet iterations_, sizet elementsPerList_)
+        : iterations(iterations_)
+        , elementsPerList(elementsPerList_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        const u64 vectorSum = Run<Vector<u64>>("Vector");
+        const u64 inlineSum = Run<InlineVector<u64, 16>>("InlineVector<16>");
+        const u64 staticSum = Run<StaticVector<u64, 16>>("StaticVector<16>");
+
+        ZN_TEST_VERIFY(vectorSum == inlineSum && inlineSum == staticSum, Result::kFailed);
+    }
+
+  private:
+    template<typename TVector>
+    u64 Run(const char* label)
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        u64 sum = 0;
+
+        auto start = SystemClock::now();
+
+        for (sizet iteration = 0; iteration < iterations; ++iteration)
+        {
+            TVector list;
+
+            for (sizet index = 0; index < elementsPerList; ++index)
+            {
+                list.push_back(iteration + index);
+            }
+
+            sum += std::accumulate(list.begin(), list.end(), u64 {0});
+        }
+
+        ZN_LOG(LogAutomationTest_InlineVector,
+               ELogVerbosity::Log,
+               "%s [%zu lists of %zu] %.2fms",
+               label,
+               iterations,
+               elementsPerList,
+               Milliseconds(SystemClock::now() - start).count());
+
+        return sum;
+    }
+
+    sizet iterations      = 0;
+    sizet elementsPerList = 0;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(InlineVectorAutomationTest, Zn::Automation::InlineVectorAutomationTest);
+DEFINE_AUTOMATION_STARTUP_TEST(InlineVectorBenchmarkAutomationTest, Zn::Automation::InlineVectorBenchmarkAutomationTest, 1000000, 8);
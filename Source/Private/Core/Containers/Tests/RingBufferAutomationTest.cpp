@@ -0,0 +1,165 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Core/Containers/RingBuffer.h"
+#include "Core/Async/Thread.h"
+#include "Core/Async/ThreadedJob.h"
+#include "Core/Time/Time.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_RingBuffer, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+template<ERingBufferMode Mode>
+class RingBufferProducerJob : public ThreadedJob
+{
+  public:
+    RingBufferProducerJob(RingBuffer<u64, Mode>& buffer_, u64 numValues_)
+        : buffer(buffer_)
+        , numValues(numValues_)
+    {
+    }
+
+    virtual void DoWork() override
+    {
+        for (u64 value = 0; value < numValues; ++value)
+        {
+            while (!buffer.TryPush(value))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+  private:
+    RingBuffer<u64, Mode>& buffer;
+    u64                    numValues = 0;
+};
+
+template<ERingBufferMode Mode>
+class RingBufferConsumerJob : public ThreadedJob
+{
+  public:
+    RingBufferConsumerJob(RingBuffer<u64, Mode>& buffer_, std::atomic<u64>& poppedSum_, std::atomic<u64>& poppedCount_, u64 totalValues_)
+        : buffer(buffer_)
+        , poppedSum(poppedSum_)
+        , poppedCount(poppedCount_)
+        , totalValues(totalValues_)
+    {
+    }
+
+    virtual void DoWork() override
+    {
+        u64 localSum = 0;
+
+        while (poppedCount.load(std::memory_order_relaxed) < totalValues)
+        {
+            if (std::optional<u64> value = buffer.TryPop())
+            {
+                localSum += *value;
+
+                poppedCount.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        poppedSum.fetch_add(localSum);
+    }
+
+  private:
+    RingBuffer<u64, Mode>& buffer;
+    std::atomic<u64>&      poppedSum;
+    std::atomic<u64>&      poppedCount;
+    u64                    totalValues = 0;
+};
+
+// Every producer pushes the values [0, numValues) and consumers sum everything they pop:
+// the total must match and nothing can be left in the buffer.
+template<ERingBufferMode Mode>
+class RingBufferAutomationTest : public AutomationTest
+{
+  public:
+    RingBufferAutomationTest(u32 numProducers_, u32 numConsumers_, u64 numValues_, sizet capacity_)
+        : numProducers(numProducers_)
+        , numConsumers(numConsumers_)
+        , numValues(numValues_)
+        , capacity(capacity_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        RingBuffer<u64, Mode> buffer(capacity);
+
+        std::atomic<u64> poppedSum {0};
+        std::atomic<u64> poppedCount {0};
+
+        const u64 totalValues = numValues * numProducers;
+
+        Vector<UniquePtr<RingBufferProducerJob<Mode>>> producers;
+        Vector<UniquePtr<RingBufferConsumerJob<Mode>>> consumers;
+        Vector<ThreadedJob*>                           jobs;
+
+        for (u32 index = 0; index < numProducers; ++index)
+        {
+            producers.push_back(std::make_unique<RingBufferProducerJob<Mode>>(buffer, numValues));
+            jobs.push_back(producers.back().get());
+        }
+
+        for (u32 index = 0; index < numConsumers; ++index)
+        {
+            consumers.push_back(std::make_unique<RingBufferConsumerJob<Mode>>(buffer, poppedSum, poppedCount, totalValues));
+            jobs.push_back(consumers.back().get());
+        }
+
+        auto start = SystemClock::now();
+
+        Vector<Thread*> threads;
+
+        for (sizet index = 0; index < jobs.size(); ++index)
+        {
+            threads.push_back(Thread::New("RingBuffer_" + std::to_string(index), jobs[index]));
+        }
+
+        for (Thread* thread : threads)
+        {
+            thread->WaitUntilCompletion();
+            delete thread;
+        }
+
+        ZN_LOG(LogAutomationTest_RingBuffer,
+               ELogVerbosity::Log,
+               "%s %u producer(s) %u consumer(s): %llu values in %.2fms",
+               Mode == ERingBufferMode::SingleProducerSingleConsumer ? "SPSC" : "MPMC",
+               numProducers,
+               numConsumers,
+               totalValues,
+               Milliseconds(SystemClock::now() - start).count());
+
+        const u64 expectedSum = numProducers * (numValues * (numValues - 1) / 2);
+
+        ZN_TEST_VERIFY(poppedSum == expectedSum && buffer.IsEmpty(), Result::kFailed);
+    }
+
+  private:
+    u32   numProducers = 1;
+    u32   numConsumers = 1;
+    u64   numValues    = 0;
+    sizet capacity     = 0;
+};
+
+using SPSCRingBufferAutomationTest = RingBufferAutomationTest<ERingBufferMode::SingleProducerSingleConsumer>;
+using MPMCRingBufferAutomationTest = RingBufferAutomationTest<ERingBufferMode::MultiProducerMultiConsumer>;
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(SPSCRingBufferAutomationTest, Zn::Automation::SPSCRingBufferAutomationTest, 1, 1, 1000000, 1024);
+DEFINE_AUTOMATION_STARTUP_TEST(MPMCRingBufferAutomationTest_1, Zn::Automation::MPMCRingBufferAutomationTest, 1, 1, 1000000, 1024);
+DEFINE_AUTOMATION_STARTUP_TEST(MPMCRingBufferAutomationTest_4, Zn::Automation::MPMCRingBufferAutomationTest, 4, 4, 250000, 1024);
@@ -0,0 +1,309 @@
+#include <Znpch.h>
+#include <Core/IO/DerivedDataCache.h>
+#include <Core/IO/IO.h>
+#include <Core/CommandLine.h>
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+
+using namespace Zn;
+
+DEFINE_STATIC_LOG_CATEGORY(LogDerivedDataCache, ELogVerbosity::Log);
+
+namespace
+{
+constexpr const char* kEntryExtension     = ".ddc";
+constexpr const char* kTemporaryExtension = ".tmp";
+
+bool ParseKey(const std::filesystem::path& path, u64& outKey)
+{
+    const String stem = path.stem().string();
+
+    auto [end, error] = std::from_chars(stem.data(), stem.data() + stem.size(), outKey, 16);
+
+    return error == std::errc() && end == stem.data() + stem.size();
+}
+} // namespace
+
+DerivedDataCache& DerivedDataCache::Get()
+{
+    static DerivedDataCache instance = []()
+    {
+        u64 maxSize = kDefaultMaxSize;
+
+        if (String maxSizeValue; CommandLine::Get().Value("-ddcsize", maxSizeValue))
+        {
+            maxSize = std::strtoull(maxSizeValue.c_str(), nullptr, 10) * 1024 * 1024;
+        }
+
+        if (CommandLine::Get().Param("-noddc"))
+        {
+            maxSize = 0;
+        }
+
+        return DerivedDataCache(IO::GetAbsolutePath("DerivedDataCache"), maxSize);
+    }();
+
+    return instance;
+}
+
+DerivedDataCache::DerivedDataCache(String directory, u64 maxSize)
+    : m_Directory(std::move(directory))
+    , m_MaxSize(maxSize)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    if (m_MaxSize == 0)
+    {
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(m_Directory, error);
+
+    if (error)
+    {
+        ZN_LOG(LogDerivedDataCache, ELogVerbosity::Warning, "Unable to create %s, caching is disabled.", m_Directory.c_str());
+        return;
+    }
+
+    m_bEnabled = true;
+
+    struct ScannedEntry
+    {
+        std::filesystem::file_time_type lastWrite;
+        u64                             key;
+        u64                             size;
+    };
+
+    Vector<ScannedEntry> scannedEntries;
+
+    for (const auto& directoryEntry : std::filesystem::directory_iterator(m_Directory, error))
+    {
+        const std::filesystem::path& path = directoryEntry.path();
+
+        if (path.extension() == kTemporaryExtension)
+        {
+            // Left behind by a run that didn't finish storing the entry.
+            std::filesystem::remove(path, error);
+            continue;
+        }
+
+        u64 key = 0;
+
+        if (path.extension() == kEntryExtension && ParseKey(path, key))
+        {
+            scannedEntries.push_back({directoryEntry.last_write_time(error), key, directoryEntry.file_size(error)});
+        }
+    }
+
+    // Entries are touched on access, so the write time carries the LRU order across runs.
+    std::sort(scannedEntries.begin(),
+              scannedEntries.end(),
+              [](const ScannedEntry& lhs, const ScannedEntry& rhs)
+              {
+                  return lhs.lastWrite < rhs.lastWrite;
+              });
+
+    m_Entries.reserve(scannedEntries.size());
+
+    for (const ScannedEntry& scannedEntry : scannedEntries)
+    {
+        m_Entries.insert({scannedEntry.key, Entry {.size = scannedEntry.size, .lastAccess = ++m_AccessCounter}});
+        m_Size += scannedEntry.size;
+    }
+
+    EvictLeastRecentlyUsed();
+
+    ZN_LOG(LogDerivedDataCache,
+           ELogVerbosity::Log,
+           "%s: %zu entries, %llu of %llu MiB.",
+           m_Directory.c_str(),
+           m_Entries.size(),
+           m_Size / (1024 * 1024),
+           m_MaxSize / (1024 * 1024));
+}
+
+MappedFile DerivedDataCache::Load(u64 key)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    std::scoped_lock lock(m_Mutex);
+
+    auto it = m_Entries.find(key);
+
+    if (it == m_Entries.end())
+    {
+        return {};
+    }
+
+    MappedFile file = IO::MapFile(GetEntryPath(key));
+
+    if (!file)
+    {
+        // Removed from outside the cache.
+        m_Size -= it->second.size;
+        m_Entries.erase(it);
+
+        return {};
+    }
+
+    Touch(key, it->second);
+
+    return file;
+}
+
+bool DerivedDataCache::Store(u64 key, std::span<const u8> data)
+{
+    return Store(key, std::span<const std::span<const u8>>(&data, 1));
+}
+
+bool DerivedDataCache::Store(u64 key, std::span<const std::span<const u8>> parts)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    u64 size = 0;
+
+    for (std::span<const u8> part : parts)
+    {
+        size += part.size();
+    }
+
+    if (!m_bEnabled || size > m_MaxSize)
+    {
+        return false;
+    }
+
+    u64 temporaryId = 0;
+
+    {
+        std::scoped_lock lock(m_Mutex);
+
+        // Same key, same content: nothing to write.
+        if (auto it = m_Entries.find(key); it != m_Entries.end())
+        {
+            Touch(key, it->second);
+            return true;
+        }
+
+        temporaryId = ++m_NumTemporaryFiles;
+    }
+
+    // The file is written without holding the lock, loads and stores of other keys go on meanwhile. Concurrent stores of the same
+    // key write their own temporary file.
+    const String entryPath     = GetEntryPath(key);
+    const String temporaryPath = entryPath + '.' + std::to_string(temporaryId) + kTemporaryExtension;
+
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+
+        for (std::span<const u8> part : parts)
+        {
+            file.write(reinterpret_cast<const char*>(part.data()), part.size());
+        }
+
+        if (!file.good())
+        {
+            file.close();
+
+            std::error_code error;
+            std::filesystem::remove(temporaryPath, error);
+
+            ZN_LOG(LogDerivedDataCache, ELogVerbosity::Warning, "Failed to write %s", temporaryPath.c_str());
+            return false;
+        }
+    }
+
+    // Written aside and renamed, so that a crash never leaves a truncated entry behind. A concurrent store of the same key renames
+    // the same content.
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, entryPath, error);
+
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+
+    std::scoped_lock lock(m_Mutex);
+
+    if (auto it = m_Entries.find(key); it != m_Entries.end())
+    {
+        Touch(key, it->second);
+        return true;
+    }
+
+    m_Entries.insert({key, Entry {.size = size, .lastAccess = ++m_AccessCounter}});
+    m_Size += size;
+
+    EvictLeastRecentlyUsed();
+
+    return true;
+}
+
+bool DerivedDataCache::Contains(u64 key) const
+{
+    std::scoped_lock lock(m_Mutex);
+
+    return m_Entries.contains(key);
+}
+
+u64 DerivedDataCache::GetSize() const
+{
+    std::scoped_lock lock(m_Mutex);
+
+    return m_Size;
+}
+
+String DerivedDataCache::GetEntryPath(u64 key) const
+{
+    char name[17] = {};
+    std::to_chars(name, name + 16, key, 16);
+
+    return (std::filesystem::path(m_Directory) / (String(name) + kEntryExtension)).string();
+}
+
+void DerivedDataCache::Touch(u64 key, Entry& entry)
+{
+    entry.lastAccess = ++m_AccessCounter;
+
+    std::error_code error;
+    std::filesystem::last_write_time(GetEntryPath(key), std::filesystem::file_time_type::clock::now(), error);
+}
+
+void DerivedDataCache::EvictLeastRecentlyUsed()
+{
+    if (m_Size <= m_MaxSize)
+    {
+        return;
+    }
+
+    Vector<std::pair<u64, u64>> candidates; // Last access, key.
+    candidates.reserve(m_Entries.size());
+
+    for (const auto& [key, entry] : m_Entries)
+    {
+        candidates.emplace_back(entry.lastAccess, key);
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& [lastAccess, key] : candidates)
+    {
+        if (m_Size <= m_MaxSize)
+        {
+            break;
+        }
+
+        std::error_code error;
+
+        // Fails while the entry is still mapped by a reader, it'll be evicted on a later pass.
+        if (std::filesystem::remove(GetEntryPath(key), error) || !error)
+        {
+            m_Size -= m_Entries.at(key).size;
+            m_Entries.erase(key);
+        }
+    }
+}
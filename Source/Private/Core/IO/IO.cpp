@@ -1,16 +1,87 @@
 #include <Znpch.h>
 #include <Core/IO/IO.h>
 #include <Core/CommandLine.h>
+#include <Core/HAL/PlatformTypes.h>
 
 #include <fstream>
 #include <filesystem>
 
 using namespace Zn;
 
+DEFINE_STATIC_LOG_CATEGORY(LogIO, ELogVerbosity::Log);
+
 String IO::kExecutablePath = "";
 
 String IO::kRootPath = "";
 
+namespace
+{
+// Reads are mostly waiting on the disk, a couple of threads are enough to keep requests in flight.
+constexpr uint32 kNumIOThreads = 2;
+
+std::mutex            s_IOThreadPoolMutex;
+UniquePtr<ThreadPool> s_IOThreadPool;
+
+ThreadPool& GetIOThreadPool()
+{
+    std::scoped_lock lock(s_IOThreadPoolMutex);
+
+    if (!s_IOThreadPool)
+    {
+        s_IOThreadPool = std::make_unique<ThreadPool>("IO", kNumIOThreads);
+    }
+
+    return *s_IOThreadPool;
+}
+
+// Size of the pages faulted in, the smallest page size of the platforms supported.
+constexpr sizet kPageSize = 4096;
+
+IOReadResult ReadBinaryFileResult(const String& InFilename)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    IOReadResult Result {.filename = InFilename, .file = IO::MapFile(InFilename)};
+
+    Result.success = Result.file.IsValid();
+
+    if (Result.success)
+    {
+        // Queues the read-ahead of the whole view, then waits for it by touching every page. The consumer doesn't stall on the disk.
+        Result.file.Prefetch();
+
+        const volatile uint8* Bytes = Result.file.GetData();
+
+        for (sizet Offset = 0; Offset < Result.file.GetSize(); Offset += kPageSize)
+        {
+            (void) Bytes[Offset];
+        }
+    }
+    else
+    {
+        ZN_LOG(LogIO, ELogVerbosity::Warning, "Failed to read %s", InFilename.c_str());
+    }
+
+    return Result;
+}
+
+ThreadPool::Task MakeReadTask(const String& InFilename, SharedPtr<std::promise<IOReadResult>> InPromise)
+{
+    return [InFilename, InPromise]()
+    {
+        InPromise->set_value(ReadBinaryFileResult(InFilename));
+    };
+}
+
+ThreadPool::Task MakeReadTask(const String& InFilename, IOReadCallback InCallback)
+{
+    return [InFilename, Callback = std::move(InCallback)]()
+    {
+        Callback(ReadBinaryFileResult(InFilename));
+    };
+}
+} // namespace
+
 void Zn::IO::Initialize()
 {
     kExecutablePath = CommandLine::Get().GetExeArgument();
@@ -18,6 +89,15 @@ void Zn::IO::Initialize()
     std::filesystem::path RootPath(kExecutablePath);
 
     kRootPath = RootPath.parent_path().parent_path().parent_path().parent_path().string();
+
+    GetIOThreadPool();
+}
+
+void Zn::IO::Shutdown()
+{
+    // Completes the reads still in flight before joining the IO threads.
+    std::scoped_lock lock(s_IOThreadPoolMutex);
+    s_IOThreadPool.reset();
 }
 
 bool IO::ReadBinaryFile(const String& InFilename, Vector<uint8>& OutData)
@@ -45,10 +125,92 @@ bool IO::ReadBinaryFile(const String& InFilename, Vector<uint8>& OutData)
     return true;
 }
 
-bool IO::ReadTextFile(const String& InFilename, Vector<const char*>& OutData)
+bool IO::ReadTextFile(const String& InFilename, String& OutData)
+{
+    String AbsFilename = GetAbsolutePath(InFilename);
+
+    std::ifstream File(AbsFilename.c_str(), std::ios::ate | std::ios::binary);
+
+    if (!File.is_open())
+    {
+        return false;
+    }
+
+    size_t Size = File.tellg();
+
+    OutData.resize(Size);
+
+    File.seekg(0);
+
+    File.read(OutData.data(), Size);
+
+    return true;
+}
+
+MappedFile IO::MapFile(const String& InFilename, EFileAccessPattern InAccessPattern)
 {
-    check(false); // Not Implemented
-    return false;
+    ZN_TRACE_QUICKSCOPE();
+
+    String AbsFilename = GetAbsolutePath(InFilename);
+
+    MappedFile File;
+    File.m_bMapped = PlatformFile::MapReadOnly(AbsFilename, InAccessPattern, File.m_Data, File.m_Size);
+
+    return File;
+}
+
+std::future<IOReadResult> IO::ReadBinaryFileAsync(const String& InFilename, ETaskPriority InPriority)
+{
+    auto Promise = std::make_shared<std::promise<IOReadResult>>();
+
+    std::future<IOReadResult> Future = Promise->get_future();
+
+    GetIOThreadPool().Enqueue(MakeReadTask(InFilename, std::move(Promise)), InPriority);
+
+    return Future;
+}
+
+void IO::ReadBinaryFileAsync(const String& InFilename, IOReadCallback&& InCallback, ETaskPriority InPriority)
+{
+    check(InCallback);
+
+    GetIOThreadPool().Enqueue(MakeReadTask(InFilename, std::move(InCallback)), InPriority);
+}
+
+Vector<std::future<IOReadResult>> IO::ReadBinaryFilesAsync(const Vector<String>& InFilenames, ETaskPriority InPriority)
+{
+    Vector<std::future<IOReadResult>> Futures;
+    Vector<ThreadPool::Task>          Tasks;
+
+    Futures.reserve(InFilenames.size());
+    Tasks.reserve(InFilenames.size());
+
+    for (const String& Filename : InFilenames)
+    {
+        auto Promise = std::make_shared<std::promise<IOReadResult>>();
+
+        Futures.push_back(Promise->get_future());
+        Tasks.push_back(MakeReadTask(Filename, std::move(Promise)));
+    }
+
+    GetIOThreadPool().EnqueueBatch(std::move(Tasks), InPriority);
+
+    return Futures;
+}
+
+void IO::ReadBinaryFilesAsync(const Vector<String>& InFilenames, IOReadCallback InCallback, ETaskPriority InPriority)
+{
+    check(InCallback);
+
+    Vector<ThreadPool::Task> Tasks;
+    Tasks.reserve(InFilenames.size());
+
+    for (const String& Filename : InFilenames)
+    {
+        Tasks.push_back(MakeReadTask(Filename, InCallback));
+    }
+
+    GetIOThreadPool().EnqueueBatch(std::move(Tasks), InPriority);
 }
 
 String IO::GetAbsolutePath(const String& InFilename)
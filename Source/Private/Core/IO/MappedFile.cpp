@@ -0,0 +1,56 @@
+#include <Znpch.h>
+#include "Core/IO/MappedFile.h"
+#include "Core/HAL/PlatformTypes.h"
+#include <algorithm>
+#include <utility>
+
+namespace Zn
+{
+MappedFile::~MappedFile()
+{
+    Reset();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_Data(std::exchange(other.m_Data, nullptr))
+    , m_Size(std::exchange(other.m_Size, 0))
+    , m_bMapped(std::exchange(other.m_bMapped, false))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+
+        m_Data    = std::exchange(other.m_Data, nullptr);
+        m_Size    = std::exchange(other.m_Size, 0);
+        m_bMapped = std::exchange(other.m_bMapped, false);
+    }
+
+    return *this;
+}
+
+void MappedFile::Prefetch(sizet offset, sizet size) const
+{
+    if (offset >= m_Size)
+    {
+        return;
+    }
+
+    PlatformFile::Prefetch(m_Data + offset, std::min(size, m_Size - offset));
+}
+
+void MappedFile::Reset()
+{
+    if (m_Data)
+    {
+        PlatformFile::Unmap(m_Data);
+    }
+
+    m_Data    = nullptr;
+    m_Size    = 0;
+    m_bMapped = false;
+}
+} // namespace Zn
@@ -0,0 +1,118 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Core/IO/DerivedDataCache.h"
+#include <algorithm>
+#include <filesystem>
+
+namespace Zn::Automation
+{
+// Stores, loads and evicts entries of a cache capped to a few entries, then reopens it to check the LRU order is kept.
+class DerivedDataCacheAutomationTest : public AutomationTest
+{
+  public:
+    DerivedDataCacheAutomationTest(u32 entrySize_)
+        : entrySize(entrySize_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        directory = std::filesystem::temp_directory_path() / "ZnDerivedDataCacheAutomationTest";
+
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+    virtual void Execute() override
+    {
+        bool bMatches = true;
+
+        // Room for three entries.
+        const u64 maxSize = entrySize * 3;
+
+        {
+            DerivedDataCache cache(directory.string(), maxSize);
+
+            bMatches &= cache.IsEnabled() && !cache.Load(0).IsValid();
+
+            for (u64 key = 0; key < 3; ++key)
+            {
+                bMatches &= cache.Store(key, MakeEntry(key));
+            }
+
+            bMatches &= cache.GetSize() == maxSize;
+
+            // Touch the oldest entry, 1 becomes the least recently used one.
+            bMatches &= std::ranges::equal(cache.Load(0).GetView(), MakeEntry(0));
+
+            bMatches &= cache.Store(3, MakeEntry(3));
+            bMatches &= cache.Contains(0) && !cache.Contains(1) && cache.Contains(2) && cache.Contains(3);
+            bMatches &= cache.GetSize() == maxSize;
+
+            // Storing an existing key only refreshes it, 2 is now the oldest.
+            bMatches &= cache.Store(0, MakeEntry(0));
+
+            bMatches &= !cache.Store(4, Vector<u8>(maxSize + 1));
+        }
+
+        {
+            // The access order survives across instances. The file times can be coarse, so only check what was loaded back.
+            DerivedDataCache cache(directory.string(), maxSize);
+
+            bMatches &= cache.GetSize() == maxSize && cache.Contains(0) && cache.Contains(2) && cache.Contains(3);
+            bMatches &= std::ranges::equal(cache.Load(3).GetView(), MakeEntry(3));
+        }
+
+        {
+            // A smaller cap evicts on open.
+            DerivedDataCache cache(directory.string(), entrySize);
+
+            bMatches &= cache.GetSize() <= entrySize;
+        }
+
+        {
+            // Parts are written back to back as a single entry.
+            DerivedDataCache cache(directory.string(), maxSize);
+
+            const Vector<u8>          entry   = MakeEntry(6);
+            const std::span<const u8> parts[] = {std::span(entry).first(16), std::span(entry).subspan(16)};
+
+            bMatches &= cache.Store(6, parts) && std::ranges::equal(cache.Load(6).GetView(), entry);
+        }
+
+        {
+            DerivedDataCache disabled(directory.string(), 0);
+
+            bMatches &= !disabled.IsEnabled() && !disabled.Store(5, MakeEntry(5)) && !disabled.Load(5);
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+  private:
+    Vector<u8> MakeEntry(u64 key) const
+    {
+        Vector<u8> entry(entrySize);
+
+        for (sizet index = 0; index < entry.size(); ++index)
+        {
+            entry[index] = static_cast<u8>(index * 7 + key);
+        }
+
+        return entry;
+    }
+
+    u32 entrySize = 0;
+
+    std::filesystem::path directory;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(DerivedDataCacheAutomationTest, Zn::Automation::DerivedDataCacheAutomationTest, 4096);
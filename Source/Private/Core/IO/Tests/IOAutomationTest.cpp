@@ -0,0 +1,157 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Core/IO/IO.h"
+#include "Core/Time/Time.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_IO, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Writes a set of files to a temporary folder, then reads them back synchronously, through futures, through callbacks and mapped.
+class IOAutomationTest : public AutomationTest
+{
+  public:
+    IOAutomationTest(u32 numFiles_, u32 fileSize_)
+        : numFiles(numFiles_)
+        , fileSize(fileSize_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        directory = std::filesystem::temp_directory_path() / "ZnIOAutomationTest";
+        std::filesystem::create_directories(directory);
+
+        for (u32 index = 0; index < numFiles; ++index)
+        {
+            String filename = (directory / ("file_" + std::to_string(index) + ".bin")).string();
+
+            Vector<uint8> content(fileSize);
+
+            for (u32 byte = 0; byte < fileSize; ++byte)
+            {
+                content[byte] = static_cast<uint8>(byte * 31 + index);
+            }
+
+            std::ofstream file(filename, std::ios::binary);
+            file.write(reinterpret_cast<const char*>(content.data()), content.size());
+
+            filenames.push_back(std::move(filename));
+            contents.push_back(std::move(content));
+        }
+    }
+
+    virtual void Execute() override
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        bool bMatches = true;
+
+        auto start = SystemClock::now();
+
+        for (u32 index = 0; index < numFiles; ++index)
+        {
+            Vector<uint8> data;
+            bMatches &= IO::ReadBinaryFile(filenames[index], data) && data == contents[index];
+        }
+
+        auto syncEnd = SystemClock::now();
+
+        Vector<std::future<IOReadResult>> futures = IO::ReadBinaryFilesAsync(filenames);
+
+        for (u32 index = 0; index < numFiles; ++index)
+        {
+            IOReadResult result = futures[index].get();
+            bMatches &= result.success && result.filename == filenames[index] && std::ranges::equal(result.file.GetView(), contents[index]);
+        }
+
+        auto asyncEnd = SystemClock::now();
+
+        for (u32 index = 0; index < numFiles; ++index)
+        {
+            const MappedFile file = IO::MapFile(filenames[index]);
+            bMatches &= file && std::ranges::equal(file.GetView(), contents[index]);
+        }
+
+        auto mappedEnd = SystemClock::now();
+
+        std::atomic<u32>   numCompleted {0};
+        std::atomic<bool>  bCallbacksMatch {true};
+        std::promise<void> allCompleted;
+
+        IO::ReadBinaryFilesAsync(
+            filenames,
+            [&](IOReadResult&& result)
+            {
+                auto it = std::find(filenames.begin(), filenames.end(), result.filename);
+
+                if (!result.success || it == filenames.end() ||
+                    !std::ranges::equal(result.file.GetView(), contents[it - filenames.begin()]))
+                {
+                    bCallbacksMatch = false;
+                }
+
+                if (++numCompleted == numFiles)
+                {
+                    allCompleted.set_value();
+                }
+            },
+            ETaskPriority::High);
+
+        allCompleted.get_future().wait();
+
+        bMatches &= bCallbacksMatch;
+
+        bMatches &= !IO::ReadBinaryFileAsync((directory / "missing.bin").string()).get().success;
+
+        String text;
+        bMatches &= IO::ReadTextFile(filenames[0], text) && text.size() == fileSize;
+
+        {
+            MappedFile file = IO::MapFile(filenames[0], EFileAccessPattern::Random);
+            file.Prefetch(fileSize / 2, fileSize);
+
+            MappedFile moved = std::move(file);
+            bMatches &= !file && moved.GetSize() == fileSize && std::ranges::equal(moved.GetView(), contents[0]);
+
+            moved.Reset();
+            bMatches &= !moved && moved.GetData() == nullptr;
+        }
+
+        bMatches &= !IO::MapFile((directory / "missing.bin").string());
+
+        ZN_LOG(LogAutomationTest_IO,
+               ELogVerbosity::Log,
+               "%u files of %u bytes. Sync: %.2fms Async batch: %.2fms Mapped: %.2fms",
+               numFiles,
+               fileSize,
+               Milliseconds(syncEnd - start).count(),
+               Milliseconds(asyncEnd - syncEnd).count(),
+               Milliseconds(mappedEnd - asyncEnd).count());
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+  private:
+    u32 numFiles = 0;
+    u32 fileSize = 0;
+
+    std::filesystem::path  directory;
+    Vector<String>         filenames;
+    Vector<Vector<uint8>>  contents;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(IOAutomationTest, Zn::Automation::IOAutomationTest, 64, 256 * 1024);
@@ -1,14 +1,14 @@
 #include <Znpch.h>
 #include "Core/Log/Log.h"
-#include "Core/Containers/Map.h"
+#include "Core/Containers/FlatMap.h"
 #include "Core/Time/Time.h"
 
 namespace Zn
 {
 // Internal use only. Map of registered log categories.
-UnorderedMap<Name, SharedPtr<LogCategory>>& GetLogCategories()
+FlatMap<Name, SharedPtr<LogCategory>>& GetLogCategories()
 {
-    static UnorderedMap<Name, SharedPtr<LogCategory>> s_LogCategories;
+    static FlatMap<Name, SharedPtr<LogCategory>> s_LogCategories;
     return s_LogCategories;
 }
 
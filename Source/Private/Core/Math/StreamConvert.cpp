@@ -0,0 +1,263 @@
+#include <Znpch.h>
+#include <Core/Math/StreamConvert.h>
+
+#if ZN_STREAM_CONVERT_AVX2
+    #include <immintrin.h>
+#elif ZN_STREAM_CONVERT_SSE2
+    #include <emmintrin.h>
+#endif
+
+using namespace Zn;
+
+namespace
+{
+#if ZN_STREAM_CONVERT_SSE2
+__m128i Widen4(const u8* src)
+{
+    i32 packed;
+    memcpy(&packed, src, sizeof(packed));
+
+    const __m128i zero = _mm_setzero_si128();
+
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+}
+
+__m128i Widen4(const u16* src)
+{
+    return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), _mm_setzero_si128());
+}
+#endif
+
+#if ZN_STREAM_CONVERT_AVX2
+__m256i Widen8(const u8* src)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+
+__m256i Widen8(const u16* src)
+{
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+#endif
+
+template<typename T>
+void WidenIndicesImpl(const T* src, sizet count, u32* dst)
+{
+    sizet index = 0;
+
+#if ZN_STREAM_CONVERT_AVX2
+    for (; index + 8 <= count; index += 8)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + index), Widen8(src + index));
+    }
+#endif
+
+#if ZN_STREAM_CONVERT_SSE2
+    for (; index + 4 <= count; index += 4)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index), Widen4(src + index));
+    }
+#endif
+
+    for (; index < count; ++index)
+    {
+        dst[index] = src[index];
+    }
+}
+
+// Elements have 1, 2 or 4 components: 4 divides the vector width, so every vector starts on the first component and the stream
+// can be converted as a flat array of scalars.
+template<typename T>
+void DequantizeFlat(const T* src, sizet numScalars, u32 numComponents, const glm::vec4& scale, const glm::vec4& bias, f32* dst)
+{
+    f32 laneScale[4];
+    f32 laneBias[4];
+
+    for (u32 lane = 0; lane < 4; ++lane)
+    {
+        laneScale[lane] = scale[lane % numComponents];
+        laneBias[lane]  = bias[lane % numComponents];
+    }
+
+    sizet index = 0;
+
+#if ZN_STREAM_CONVERT_AVX2
+    {
+        const __m256 scale8 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(laneScale));
+        const __m256 bias8  = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(laneBias));
+
+        for (; index + 8 <= numScalars; index += 8)
+        {
+            const __m256 value = _mm256_cvtepi32_ps(Widen8(src + index));
+
+            _mm256_storeu_ps(dst + index, _mm256_add_ps(_mm256_mul_ps(value, scale8), bias8));
+        }
+    }
+#endif
+
+#if ZN_STREAM_CONVERT_SSE2
+    {
+        const __m128 scale4 = _mm_loadu_ps(laneScale);
+        const __m128 bias4  = _mm_loadu_ps(laneBias);
+
+        for (; index + 4 <= numScalars; index += 4)
+        {
+            const __m128 value = _mm_cvtepi32_ps(Widen4(src + index));
+
+            _mm_storeu_ps(dst + index, _mm_add_ps(_mm_mul_ps(value, scale4), bias4));
+        }
+    }
+#endif
+
+    for (; index < numScalars; ++index)
+    {
+        dst[index] = static_cast<f32>(src[index]) * laneScale[index % 4] + laneBias[index % 4];
+    }
+}
+
+template<typename T>
+void DequantizeExpand(const T* src, sizet count, const glm::vec4& scale, const glm::vec4& bias, f32* dst)
+{
+    sizet index = 0;
+
+#if ZN_STREAM_CONVERT_AVX2
+    {
+        const __m256 scale8 = _mm256_setr_ps(scale.x, scale.y, scale.z, scale.w, scale.x, scale.y, scale.z, scale.w);
+        const __m256 bias8  = _mm256_setr_ps(bias.x, bias.y, bias.z, bias.w, bias.x, bias.y, bias.z, bias.w);
+
+        for (; index + 2 <= count; index += 2)
+        {
+            const T*      element = src + index * 3;
+            const __m256i value   = _mm256_setr_epi32(element[0], element[1], element[2], 0, element[3], element[4], element[5], 0);
+
+            _mm256_storeu_ps(dst + index * 4, _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(value), scale8), bias8));
+        }
+    }
+#endif
+
+#if ZN_STREAM_CONVERT_SSE2
+    {
+        const __m128 scale4 = _mm_setr_ps(scale.x, scale.y, scale.z, scale.w);
+        const __m128 bias4  = _mm_setr_ps(bias.x, bias.y, bias.z, bias.w);
+
+        for (; index < count; ++index)
+        {
+            const T*      element = src + index * 3;
+            const __m128i value   = _mm_setr_epi32(element[0], element[1], element[2], 0);
+
+            _mm_storeu_ps(dst + index * 4, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(value), scale4), bias4));
+        }
+    }
+#endif
+
+    for (; index < count; ++index)
+    {
+        const T* element = src + index * 3;
+
+        for (u32 component = 0; component < 3; ++component)
+        {
+            dst[index * 4 + component] = static_cast<f32>(element[component]) * scale[component] + bias[component];
+        }
+
+        dst[index * 4 + 3] = bias.w;
+    }
+}
+
+template<typename T>
+void DequantizeImpl(const T*         src,
+                    sizet            count,
+                    u32              srcComponents,
+                    u32              dstComponents,
+                    const glm::vec4& scale,
+                    const glm::vec4& bias,
+                    f32*             dst)
+{
+    if (srcComponents == dstComponents && (srcComponents == 1 || srcComponents == 2 || srcComponents == 4))
+    {
+        DequantizeFlat(src, count * srcComponents, srcComponents, scale, bias, dst);
+    }
+    else if (srcComponents == 3 && dstComponents == 4)
+    {
+        DequantizeExpand(src, count, scale, bias, dst);
+    }
+    else
+    {
+        checkMsg(false, "Unsupported conversion from %u to %u components.", srcComponents, dstComponents);
+    }
+}
+} // namespace
+
+void Zn::StreamConvert::WidenIndices(const u8* src, sizet count, u32* dst)
+{
+    WidenIndicesImpl(src, count, dst);
+}
+
+void Zn::StreamConvert::WidenIndices(const u16* src, sizet count, u32* dst)
+{
+    WidenIndicesImpl(src, count, dst);
+}
+
+void Zn::StreamConvert::Dequantize(const u8*        src,
+                                   sizet            count,
+                                   u32              srcComponents,
+                                   u32              dstComponents,
+                                   const glm::vec4& scale,
+                                   const glm::vec4& bias,
+                                   f32*             dst)
+{
+    DequantizeImpl(src, count, srcComponents, dstComponents, scale, bias, dst);
+}
+
+void Zn::StreamConvert::Dequantize(const u16*       src,
+                                   sizet            count,
+                                   u32              srcComponents,
+                                   u32              dstComponents,
+                                   const glm::vec4& scale,
+                                   const glm::vec4& bias,
+                                   f32*             dst)
+{
+    DequantizeImpl(src, count, srcComponents, dstComponents, scale, bias, dst);
+}
+
+void Zn::StreamConvert::ExpandVec3(const glm::vec3* src, sizet count, f32 w, glm::vec4* dst)
+{
+    const f32* srcScalars = reinterpret_cast<const f32*>(src);
+    f32*       dstScalars = reinterpret_cast<f32*>(dst);
+
+    sizet index = 0;
+
+#if ZN_STREAM_CONVERT_AVX2
+    {
+        // Loads 8 floats for 2 vec3, so stops one vec3 early to stay within the source.
+        const __m256i permutation = _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0);
+        const __m256  w8          = _mm256_set1_ps(w);
+
+        for (; index + 3 <= count; index += 2)
+        {
+            const __m256 value = _mm256_permutevar8x32_ps(_mm256_loadu_ps(srcScalars + index * 3), permutation);
+
+            _mm256_storeu_ps(dstScalars + index * 4, _mm256_blend_ps(value, w8, 0b10001000));
+        }
+    }
+#endif
+
+#if ZN_STREAM_CONVERT_SSE2
+    {
+        // Loads 4 floats per vec3, the last one goes through the scalar path.
+        const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        const __m128 w4      = _mm_setr_ps(0.f, 0.f, 0.f, w);
+
+        for (; index + 1 < count; ++index)
+        {
+            const __m128 value = _mm_loadu_ps(srcScalars + index * 3);
+
+            _mm_storeu_ps(dstScalars + index * 4, _mm_or_ps(_mm_and_ps(value, xyzMask), w4));
+        }
+    }
+#endif
+
+    for (; index < count; ++index)
+    {
+        dst[index] = glm::vec4(src[index], w);
+    }
+}
@@ -0,0 +1,256 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Core/Math/Math.h"
+#include "Core/Math/StreamConvert.h"
+#include "Core/Time/Time.h"
+#include <chrono>
+#include <random>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_StreamConvert, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+namespace
+{
+template<typename T>
+void DequantizeReference(const T*         src,
+                         sizet            count,
+                         u32              srcComponents,
+                         u32              dstComponents,
+                         const glm::vec4& scale,
+                         const glm::vec4& bias,
+                         f32*             dst)
+{
+    for (sizet element = 0; element < count; ++element)
+    {
+        for (u32 component = 0; component < dstComponents; ++component)
+        {
+            const f32 value = component < srcComponents ? static_cast<f32>(src[element * srcComponents + component]) : 0.f;
+
+            dst[element * dstComponents + component] = value * scale[component] + bias[component];
+        }
+    }
+}
+
+bool NearlyEqual(const Vector<f32>& lhs, const Vector<f32>& rhs)
+{
+    for (sizet index = 0; index < lhs.size(); ++index)
+    {
+        if (std::abs(lhs[index] - rhs[index]) > 1e-4f * std::max(1.f, std::abs(rhs[index])))
+        {
+            return false;
+        }
+    }
+
+    return lhs.size() == rhs.size();
+}
+} // namespace
+
+// Checks every conversion against a scalar reference, for counts covering the vector loops and their tails.
+class StreamConvertAutomationTest : public AutomationTest
+{
+  public:
+    StreamConvertAutomationTest(sizet maxCount_)
+        : maxCount(maxCount_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        bool bMatches = true;
+
+        for (sizet count = 0; count <= maxCount; ++count)
+        {
+            bMatches &= CheckWidenIndices<u8>(count) && CheckWidenIndices<u16>(count);
+
+            const std::pair<u32, u32> layouts[] = {{1, 1}, {2, 2}, {4, 4}, {3, 4}};
+
+            for (const auto [srcComponents, dstComponents] : layouts)
+            {
+                bMatches &= CheckDequantize<u8>(count, srcComponents, dstComponents);
+                bMatches &= CheckDequantize<u16>(count, srcComponents, dstComponents);
+            }
+
+            Vector<glm::vec3> vectors(count);
+
+            for (sizet index = 0; index < count; ++index)
+            {
+                vectors[index] = glm::vec3(static_cast<f32>(index), -static_cast<f32>(index), 0.5f);
+            }
+
+            Vector<glm::vec4> expanded(count);
+            StreamConvert::ExpandVec3(vectors.data(), count, 1.f, expanded.data());
+
+            for (sizet index = 0; index < count; ++index)
+            {
+                bMatches &= expanded[index] == glm::vec4(vectors[index], 1.f);
+            }
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+  private:
+    template<typename T>
+    bool CheckWidenIndices(sizet count)
+    {
+        Vector<T> src(count);
+
+        for (sizet index = 0; index < count; ++index)
+        {
+            src[index] = static_cast<T>(std::numeric_limits<T>::max() - index * 3);
+        }
+
+        Vector<u32> dst(count);
+        StreamConvert::WidenIndices(src.data(), count, dst.data());
+
+        return std::equal(src.begin(), src.end(), dst.begin(), dst.end());
+    }
+
+    template<typename T>
+    bool CheckDequantize(sizet count, u32 srcComponents, u32 dstComponents)
+    {
+        Vector<T> src(count * srcComponents);
+
+        for (sizet index = 0; index < src.size(); ++index)
+        {
+            src[index] = static_cast<T>(index * 37 + 11);
+        }
+
+        const glm::vec4 scale {0.5f, 2.f, -1.f, 1.f / std::numeric_limits<T>::max()};
+        const glm::vec4 bias {-1.f, 0.f, 3.f, 1.f};
+
+        Vector<f32> dst(count * dstComponents);
+        Vector<f32> reference(count * dstComponents);
+
+        StreamConvert::Dequantize(src.data(), count, srcComponents, dstComponents, scale, bias, dst.data());
+        DequantizeReference(src.data(), count, srcComponents, dstComponents, scale, bias, reference.data());
+
+        return NearlyEqual(dst, reference);
+    }
+
+    sizet maxCount = 0;
+};
+
+// Logs the time to decode normalized u16 uvs, u8 colors and u16 indices with StreamConvert, against per element scalar loops.
+class StreamConvertBenchmarkAutomationTest : public AutomationTest
+{
+  public:
+    StreamConvertBenchmarkAutomationTest(sizet numVertices_)
+        : numVertices(numVertices_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        std::mt19937 gen(0x5C0);
+
+        uvs.resize(numVertices * 2);
+        colors.resize(numVertices * 4);
+        indices.resize(numVertices * 3);
+
+        std::generate(uvs.begin(),
+                      uvs.end(),
+                      [&gen]()
+                      {
+                          return static_cast<u16>(gen());
+                      });
+        std::generate(colors.begin(),
+                      colors.end(),
+                      [&gen]()
+                      {
+                          return static_cast<u8>(gen());
+                      });
+        std::generate(indices.begin(),
+                      indices.end(),
+                      [&gen]()
+                      {
+                          return static_cast<u16>(gen());
+                      });
+    }
+
+    virtual void Execute() override
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        constexpr f32 kUpperU16 = static_cast<f32>(std::numeric_limits<u16>::max());
+        constexpr f32 kUpperU8  = static_cast<f32>(std::numeric_limits<u8>::max());
+
+        Vector<glm::vec2> scalarUvs(numVertices);
+        Vector<glm::vec4> scalarColors(numVertices);
+        Vector<u32>       scalarIndices(indices.size());
+
+        Vector<glm::vec2> streamUvs(numVertices);
+        Vector<glm::vec4> streamColors(numVertices);
+        Vector<u32>       streamIndices(indices.size());
+
+        auto start = SystemClock::now();
+
+        for (sizet index = 0; index < numVertices; ++index)
+        {
+            scalarUvs[index] = glm::vec2 {Math::MapRange(static_cast<f32>(uvs[index * 2]), 0.f, kUpperU16, 0.f, 1.f),
+                                          Math::MapRange(static_cast<f32>(uvs[index * 2 + 1]), 0.f, kUpperU16, 0.f, 1.f)};
+        }
+
+        for (sizet index = 0; index < numVertices; ++index)
+        {
+            const u8* src = &colors[index * 4];
+
+            scalarColors[index] = glm::vec4 {Math::MapRange(static_cast<f32>(src[0]), 0.f, kUpperU8, 0.f, 1.f),
+                                             Math::MapRange(static_cast<f32>(src[1]), 0.f, kUpperU8, 0.f, 1.f),
+                                             Math::MapRange(static_cast<f32>(src[2]), 0.f, kUpperU8, 0.f, 1.f),
+                                             Math::MapRange(static_cast<f32>(src[3]), 0.f, kUpperU8, 0.f, 1.f)};
+        }
+
+        for (sizet index = 0; index < indices.size(); ++index)
+        {
+            scalarIndices[index] = static_cast<u32>(indices[index]);
+        }
+
+        auto scalarEnd = SystemClock::now();
+
+        StreamConvert::Dequantize(
+            uvs.data(), numVertices, 2, 2, glm::vec4(1.f / kUpperU16), glm::vec4(0.f), reinterpret_cast<f32*>(streamUvs.data()));
+        StreamConvert::Dequantize(
+            colors.data(), numVertices, 4, 4, glm::vec4(1.f / kUpperU8), glm::vec4(0.f), reinterpret_cast<f32*>(streamColors.data()));
+        StreamConvert::WidenIndices(indices.data(), indices.size(), streamIndices.data());
+
+        auto streamEnd = SystemClock::now();
+
+        ZN_LOG(LogAutomationTest_StreamConvert,
+               ELogVerbosity::Log,
+               "[%zu vertices, %zu indices] scalar: %.2fms StreamConvert: %.2fms",
+               numVertices,
+               indices.size(),
+               Milliseconds(scalarEnd - start).count(),
+               Milliseconds(streamEnd - scalarEnd).count());
+
+        bool bMatches = scalarIndices == streamIndices;
+
+        for (sizet index = 0; index < numVertices; ++index)
+        {
+            bMatches &= glm::all(glm::epsilonEqual(scalarUvs[index], streamUvs[index], 1e-5f));
+            bMatches &= glm::all(glm::epsilonEqual(scalarColors[index], streamColors[index], 1e-5f));
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        uvs.clear();
+        colors.clear();
+        indices.clear();
+    }
+
+  private:
+    sizet       numVertices = 0;
+    Vector<u16> uvs;
+    Vector<u8>  colors;
+    Vector<u16> indices;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(StreamConvertAutomationTest, Zn::Automation::StreamConvertAutomationTest, 40);
+DEFINE_AUTOMATION_STARTUP_TEST(StreamConvertBenchmarkAutomationTest, Zn::Automation::StreamConvertBenchmarkAutomationTest, 1000000);
@@ -1,13 +1,14 @@
 #include <Znpch.h>
 #include "Core/Name.h"
-#include "Core/Containers/Map.h"
+#include "Core/Containers/FlatMap.h"
 #include <algorithm>
 
 namespace Zn
 {
-UnorderedMap<size_t, String>& Names()
+// Strings are boxed so that CString() pointers stay valid when the table grows.
+FlatMap<size_t, UniquePtr<String>>& Names()
 {
-    static UnorderedMap<size_t, String> s_Names;
+    static FlatMap<size_t, UniquePtr<String>> s_Names;
     return s_Names;
 }
 
@@ -17,7 +18,10 @@ Name::Name(Zn::String string)
 
     m_StringCode = std::hash<Zn::String> {}(string);
 
-    Zn::Names().try_emplace(m_StringCode, string);
+    if (!Zn::Names().contains(m_StringCode))
+    {
+        Zn::Names().try_emplace(m_StringCode, std::make_unique<String>(std::move(string)));
+    }
 }
 
 Zn::String Name::ToString() const
@@ -25,7 +29,7 @@ Zn::String Name::ToString() const
     if (*this == NO_NAME)
         return "";
 
-    return Zn::Names().at(m_StringCode);
+    return *Zn::Names().at(m_StringCode);
 }
 
 const char* const Name::CString() const
@@ -33,6 +37,6 @@ const char* const Name::CString() const
     if (*this == NO_NAME)
         return "";
 
-    return Zn::Names().at(m_StringCode).c_str();
+    return Zn::Names().at(m_StringCode)->c_str();
 }
 } // namespace Zn
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Core/Event.h"
+#include "Core/Time/Time.h"
+#include <chrono>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_Event, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Covers capturing delegates and bind/unbind/reset from inside a broadcast.
+class EventAutomationTest : public AutomationTest
+{
+  public:
+    struct Listener
+    {
+        void OnValue(i32 value)
+        {
+            sum += value;
+        }
+
+        i32 sum = 0;
+    };
+
+    virtual void Execute() override
+    {
+        bool bMatches = true;
+
+        {
+            i32 calls  = 0;
+            i64 values = 0;
+
+            TMulticastEvent<i32> event;
+
+            DelegateHandle first = event.Bind(
+                [&calls, &values](i32 value)
+                {
+                    ++calls;
+                    values += value;
+                });
+
+            Listener listener;
+            event.Bind(TMulticastEvent<i32>::DelegateType::Create<&Listener::OnValue>(&listener));
+
+            event.Broadcast(5);
+            bMatches &= calls == 1 && values == 5 && listener.sum == 5;
+
+            bMatches &= event.Unbind(first) && !event.Unbind(first);
+
+            event.Broadcast(3);
+            bMatches &= calls == 1 && listener.sum == 8;
+        }
+
+        {
+            // A delegate unbinding itself and binding a new one mid broadcast.
+            TMulticastEvent<> event;
+
+            i32            selfCalls  = 0;
+            i32            otherCalls = 0;
+            i32            lateCalls  = 0;
+            DelegateHandle selfHandle;
+
+            selfHandle = event.Bind(
+                [&]
+                {
+                    ++selfCalls;
+                    event.Unbind(selfHandle);
+                    event.Bind(
+                        [&lateCalls]
+                        {
+                            ++lateCalls;
+                        });
+                });
+
+            event.Bind(
+                [&otherCalls]
+                {
+                    ++otherCalls;
+                });
+
+            event.Broadcast();
+            bMatches &= selfCalls == 1 && otherCalls == 1 && lateCalls == 0;
+
+            event.Broadcast();
+            bMatches &= selfCalls == 1 && otherCalls == 2 && lateCalls == 1;
+
+            event.Reset();
+            event.Broadcast();
+            bMatches &= !event.IsBound() && otherCalls == 2;
+        }
+
+        {
+            // Reset from inside a broadcast stops the remaining delegates.
+            TMulticastEvent<> event;
+
+            i32 calls = 0;
+
+            event.Bind(
+                [&]
+                {
+                    ++calls;
+                    event.Reset();
+                });
+
+            event.Bind(
+                [&calls]
+                {
+                    ++calls;
+                });
+
+            event.Broadcast();
+            bMatches &= calls == 1 && !event.IsBound();
+        }
+
+        {
+            TSingleEvent<i32(i32, i32)> event;
+            bMatches &= !event.IsBound() && !event.ExecuteSafe(1, 2).has_value();
+
+            const i32 bias = 10;
+            event.Bind(
+                [bias](i32 a, i32 b)
+                {
+                    return a + b + bias;
+                });
+
+            bMatches &= event.ExecuteSafe(1, 2) == 13;
+
+            event.Unbind();
+            bMatches &= !event.IsBound();
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+};
+
+// Logs the cost of broadcasting to capturing delegates, against a Vector of std::function. The captures live in the delegates
+// themselves, so the broadcast loop never touches the heap while std::function may have to reach its callable through it.
+class EventBenchmarkAutomationTest : public AutomationTest
+{
+  public:
+    EventBenchmarkAutomationTest(sizet numDelegates_, sizet numBroadcasts_)
+        : numDelegates(numDelegates_)
+        , numBroadcasts(numBroadcasts_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        u64 eventSum    = 0;
+        u64 functionSum = 0;
+
+        TMulticastEvent<u64>             event;
+        Vector<std::function<void(u64)>> functions;
+
+        for (sizet index = 0; index < numDelegates; ++index)
+        {
+            const u64 weight = index + 1;
+
+            event.Bind(
+                [&eventSum, weight](u64 value)
+                {
+                    eventSum += value * weight;
+                });
+
+            functions.push_back(
+                [&functionSum, weight](u64 value)
+                {
+                    functionSum += value * weight;
+                });
+        }
+
+        auto start = SystemClock::now();
+
+        for (u64 broadcast = 0; broadcast < numBroadcasts; ++broadcast)
+        {
+            event.Broadcast(broadcast);
+        }
+
+        auto eventEnd = SystemClock::now();
+
+        for (u64 broadcast = 0; broadcast < numBroadcasts; ++broadcast)
+        {
+            for (const auto& function : functions)
+            {
+                function(broadcast);
+            }
+        }
+
+        auto functionEnd = SystemClock::now();
+
+        ZN_LOG(LogAutomationTest_Event,
+               ELogVerbosity::Log,
+               "%zu broadcasts to %zu delegates. TMulticastEvent: %.2fms Vector<std::function>: %.2fms",
+               numBroadcasts,
+               numDelegates,
+               Milliseconds(eventEnd - start).count(),
+               Milliseconds(functionEnd - eventEnd).count());
+
+        ZN_TEST_VERIFY(eventSum == functionSum, Result::kFailed);
+    }
+
+  private:
+    sizet numDelegates  = 0;
+    sizet numBroadcasts = 0;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(EventAutomationTest, Zn::Automation::EventAutomationTest);
+DEFINE_AUTOMATION_STARTUP_TEST(EventBenchmarkAutomationTest, Zn::Automation::EventBenchmarkAutomationTest, 8, 1000000);
@@ -16,7 +16,6 @@
 #include <Engine/Camera.h>
 #include <Engine/EngineFrontend.h>
 #include <Application/Application.h>
-#include <Application/ApplicationInput.h>
 
 DEFINE_STATIC_LOG_CATEGORY(LogEngine, ELogVerbosity::Log);
 
@@ -40,6 +39,8 @@ void Engine::Initialize()
 
     activeCamera = std::make_shared<Camera>();
     m_FrontEnd   = std::make_shared<EngineFrontend>();
+
+    inputEventHandle = Application::Get().GetInputEvent().Bind(Application::InputEvent::DelegateType::Create<&Engine::OnInputEvent>(this));
 }
 
 void Engine::Update(float deltaTime)
@@ -76,6 +77,8 @@ void Engine::Update(float deltaTime)
 
 void Engine::Shutdown()
 {
+    Application::Get().GetInputEvent().Unbind(inputEventHandle);
+
     m_FrontEnd = nullptr;
 
     Renderer::destroy();
@@ -106,11 +109,9 @@ void Engine::ProcessInput()
         camera_process_key_input(SDLK_q, m_DeltaTime, *activeCamera.get());
     if (keyboardState[SDL_SCANCODE_E])
         camera_process_key_input(SDLK_e, m_DeltaTime, *activeCamera.get());
+}
 
-    SharedPtr<InputState> input = Application::Get().GetInputState();
-
-    for (const SDL_Event& event : input->events)
-    {
-        camera_process_input(event, m_DeltaTime, *activeCamera.get());
-    }
+void Engine::OnInputEvent(const SDL_Event& event, f32 deltaTime)
+{
+    camera_process_input(event, deltaTime, *activeCamera.get());
 }
@@ -0,0 +1,318 @@
+#include <Znpch.h>
+#include <Engine/Importer/CookedMesh.h>
+#include <Engine/Importer/MeshImporter.h>
+#include <Core/IO/IO.h>
+#include <Core/Memory/Memory.h>
+#include <algorithm>
+
+using namespace Zn;
+
+namespace
+{
+struct CookedStream
+{
+    u64 offset = 0;
+    u64 count  = 0;
+};
+
+struct CookedMeshHeader
+{
+    u32 magic;
+    u32 version;
+    u32 numPrimitives;
+    u32 numMaterials;
+    u32 numTextures;
+    u32 padding;
+    u64 primitivesOffset;
+    u64 materialsOffset;
+    u64 texturesOffset;
+    u64 fileSize;
+};
+
+struct CookedPrimitive
+{
+    glm::mat4         matrix;
+    CookedStream      position;
+    CookedStream      normal;
+    CookedStream      tangent;
+    CookedStream      uv;
+    CookedStream      color;
+    CookedStream      indices;
+    CookedStream      lods;
+    CookedStream      lodIndices;
+    u32               materialIndex;
+    PrimitiveTopology topology;
+    u8                padding[3];
+};
+
+struct CookedTexture
+{
+    CookedStream          uri;
+    TextureSampler        sampler;
+    u8                    padding[2];
+    TextureImportSettings settings;
+};
+
+static_assert(std::is_trivially_copyable_v<CookedPrimitive> && std::is_trivially_copyable_v<MaterialAttributes> &&
+              std::is_trivially_copyable_v<CookedTexture> && std::is_trivially_copyable_v<RHIPrimitiveLOD>);
+
+// Tables are memcpy'd into the blob: every byte must belong to a member, so that no uninitialized padding ends up in the file.
+static_assert(sizeof(CookedPrimitive) == sizeof(glm::mat4) + sizeof(CookedStream) * 8 + sizeof(u32) + sizeof(PrimitiveTopology) + 3);
+static_assert(sizeof(CookedTexture) == sizeof(CookedStream) + sizeof(TextureSampler) + 2 + sizeof(TextureImportSettings));
+static_assert(sizeof(MaterialAttributes) == sizeof(glm::vec4) + sizeof(f32) * 2 + sizeof(glm::vec3) + sizeof(f32) * 2 + sizeof(AlphaMode) +
+                                                sizeof(bool) + 2 + sizeof(ResourceHandle) * 5);
+static_assert(sizeof(TextureImportSettings) == sizeof(f32) + sizeof(bool) * 2 + sizeof(TextureCompression) + sizeof(u8));
+
+class CookedMeshWriter
+{
+  public:
+    sizet Reserve(sizet size, sizet alignment)
+    {
+        const sizet offset = Memory::Align(blob.size(), alignment);
+
+        blob.resize(offset + size);
+
+        return offset;
+    }
+
+    template<typename T>
+    CookedStream WriteStream(std::span<const T> data)
+    {
+        const sizet offset = Reserve(data.size_bytes(), CookedMesh::kStreamAlignment);
+
+        if (!data.empty())
+        {
+            memcpy(blob.data() + offset, data.data(), data.size_bytes());
+        }
+
+        return CookedStream {.offset = offset, .count = data.size()};
+    }
+
+    template<typename T>
+    void WriteAt(sizet offset, std::span<const T> data)
+    {
+        if (!data.empty())
+        {
+            memcpy(blob.data() + offset, data.data(), data.size_bytes());
+        }
+    }
+
+    Vector<u8> blob;
+};
+
+template<typename T>
+bool ReadStream(const MappedFile& file, const CookedStream& stream, std::span<const T>& outData)
+{
+    if (stream.count == 0)
+    {
+        outData = {};
+        return true;
+    }
+
+    if (stream.offset % alignof(T) != 0 || stream.offset > file.GetSize() || stream.count > (file.GetSize() - stream.offset) / sizeof(T))
+    {
+        return false;
+    }
+
+    outData = std::span<const T>(reinterpret_cast<const T*>(file.GetData() + stream.offset), static_cast<sizet>(stream.count));
+
+    return true;
+}
+
+template<typename T>
+bool ReadTable(const MappedFile& file, u64 offset, u32 count, std::span<const T>& outData)
+{
+    return ReadStream(file, CookedStream {.offset = offset, .count = count}, outData);
+}
+
+bool AreIndicesInRange(std::span<const u32> indices, sizet numVertices)
+{
+    return std::all_of(indices.begin(), indices.end(), [numVertices](u32 index) { return index < numVertices; });
+}
+
+bool IsFileTexture(const String& uri)
+{
+    return !uri.empty() && !uri.starts_with("data:");
+}
+} // namespace
+
+bool Zn::CookedMesh::Cook(const MeshImporterOutput& output, Vector<u8>& outBlob)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    Vector<String> textureUris;
+    textureUris.reserve(output.textures.size());
+
+    for (const auto& [uri, texture] : output.textures)
+    {
+        if (!IsFileTexture(uri))
+        {
+            ZN_LOG(LogMeshImporter, ELogVerbosity::Warning, "Unable to cook a mesh with textures not backed by a file (%s).", uri.c_str());
+            return false;
+        }
+
+        textureUris.push_back(uri);
+    }
+
+    // Sorted so that cooking the same output twice produces the same blob.
+    std::sort(textureUris.begin(), textureUris.end());
+
+    Vector<MaterialAttributes> materials;
+    Vector<CookedPrimitive>    primitives;
+    Vector<CookedTexture>      textures;
+
+    CookedMeshWriter writer;
+
+    const sizet headerOffset     = writer.Reserve(sizeof(CookedMeshHeader), alignof(CookedMeshHeader));
+    const sizet primitivesOffset = writer.Reserve(sizeof(CookedPrimitive) * output.primitives.size(), alignof(CookedPrimitive));
+
+    for (const RHIPrimitive& primitive : output.primitives)
+    {
+        auto materialIt = std::find(materials.begin(), materials.end(), primitive.materialAttributes);
+
+        if (materialIt == materials.end())
+        {
+            materialIt = materials.insert(materials.end(), primitive.materialAttributes);
+        }
+
+        primitives.push_back(CookedPrimitive {
+            .matrix        = primitive.matrix,
+            .position      = writer.WriteStream<glm::vec3>(primitive.position),
+            .normal        = writer.WriteStream<glm::vec3>(primitive.normal),
+            .tangent       = writer.WriteStream<glm::vec4>(primitive.tangent),
+            .uv            = writer.WriteStream<glm::vec2>(primitive.uv),
+            .color         = writer.WriteStream<glm::vec4>(primitive.color),
+            .indices       = writer.WriteStream<u32>(primitive.indices),
+            .lods          = writer.WriteStream<RHIPrimitiveLOD>(primitive.lods),
+            .lodIndices    = writer.WriteStream<u32>(primitive.lodIndices),
+            .materialIndex = static_cast<u32>(materialIt - materials.begin()),
+            .topology      = primitive.topology,
+            .padding       = {},
+        });
+    }
+
+    for (const String& uri : textureUris)
+    {
+        auto samplerIt  = output.samplers.find(uri);
+        auto settingsIt = output.textureSettings.find(uri);
+
+        textures.push_back(CookedTexture {
+            .uri      = writer.WriteStream<char>(uri),
+            .sampler  = samplerIt != output.samplers.end() ? samplerIt->second : TextureSampler {},
+            .padding  = {},
+            .settings = settingsIt != output.textureSettings.end() ? settingsIt->second : TextureImportSettings {},
+        });
+    }
+
+    const sizet materialsOffset = writer.Reserve(sizeof(MaterialAttributes) * materials.size(), alignof(MaterialAttributes));
+    const sizet texturesOffset  = writer.Reserve(sizeof(CookedTexture) * textures.size(), alignof(CookedTexture));
+
+    const CookedMeshHeader header {
+        .magic            = kMagic,
+        .version          = kVersion,
+        .numPrimitives    = static_cast<u32>(primitives.size()),
+        .numMaterials     = static_cast<u32>(materials.size()),
+        .numTextures      = static_cast<u32>(textures.size()),
+        .padding          = 0,
+        .primitivesOffset = primitivesOffset,
+        .materialsOffset  = materialsOffset,
+        .texturesOffset   = texturesOffset,
+        .fileSize         = writer.blob.size(),
+    };
+
+    writer.WriteAt<CookedMeshHeader>(headerOffset, {&header, 1});
+    writer.WriteAt<CookedPrimitive>(primitivesOffset, primitives);
+    writer.WriteAt<MaterialAttributes>(materialsOffset, materials);
+    writer.WriteAt<CookedTexture>(texturesOffset, textures);
+
+    outBlob = std::move(writer.blob);
+
+    return true;
+}
+
+bool Zn::CookedMesh::Load(const String& fileName, CookedMesh& outMesh)
+{
+    return Load(IO::MapFile(fileName), outMesh);
+}
+
+bool Zn::CookedMesh::Load(MappedFile&& file, CookedMesh& outMesh)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    if (!file || file.GetSize() < sizeof(CookedMeshHeader))
+    {
+        return false;
+    }
+
+    const CookedMeshHeader& header = *reinterpret_cast<const CookedMeshHeader*>(file.GetData());
+
+    if (header.magic != kMagic || header.version != kVersion || header.fileSize != file.GetSize())
+    {
+        ZN_LOG(LogMeshImporter, ELogVerbosity::Log, "Cooked mesh is out of date or invalid.");
+        return false;
+    }
+
+    std::span<const CookedPrimitive>    primitives;
+    std::span<const MaterialAttributes> materials;
+    std::span<const CookedTexture>      textures;
+
+    bool bValid = ReadTable(file, header.primitivesOffset, header.numPrimitives, primitives) &&
+                  ReadTable(file, header.materialsOffset, header.numMaterials, materials) &&
+                  ReadTable(file, header.texturesOffset, header.numTextures, textures);
+
+    Vector<RHIPrimitiveView> primitiveViews(primitives.size());
+
+    for (sizet index = 0; bValid && index < primitives.size(); ++index)
+    {
+        const CookedPrimitive& primitive = primitives[index];
+        RHIPrimitiveView&      view      = primitiveViews[index];
+
+        view.matrix   = primitive.matrix;
+        view.topology = primitive.topology;
+
+        bValid = primitive.materialIndex < materials.size() && ReadStream(file, primitive.position, view.position) &&
+                 ReadStream(file, primitive.normal, view.normal) && ReadStream(file, primitive.tangent, view.tangent) &&
+                 ReadStream(file, primitive.uv, view.uv) && ReadStream(file, primitive.color, view.color) &&
+                 ReadStream(file, primitive.indices, view.indices) && ReadStream(file, primitive.lods, view.lods) &&
+                 ReadStream(file, primitive.lodIndices, view.lodIndices) && AreIndicesInRange(view.indices, view.position.size()) &&
+                 AreIndicesInRange(view.lodIndices, view.position.size());
+
+        for (sizet lod = 0; bValid && lod < view.lods.size(); ++lod)
+        {
+            bValid = view.lods[lod].firstIndex <= view.lodIndices.size() &&
+                     view.lods[lod].numIndices <= view.lodIndices.size() - view.lods[lod].firstIndex;
+        }
+
+        if (bValid)
+        {
+            view.materialAttributes = materials[primitive.materialIndex];
+        }
+    }
+
+    Vector<CookedMeshTexture> textureEntries;
+    textureEntries.reserve(textures.size());
+
+    for (sizet index = 0; bValid && index < textures.size(); ++index)
+    {
+        std::span<const char> uri;
+        bValid = ReadStream(file, textures[index].uri, uri);
+
+        textureEntries.push_back(CookedMeshTexture {
+            .uri      = String(uri.begin(), uri.end()),
+            .sampler  = textures[index].sampler,
+            .settings = textures[index].settings,
+        });
+    }
+
+    if (!bValid)
+    {
+        ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Cooked mesh is corrupted.");
+        return false;
+    }
+
+    outMesh.file       = std::move(file);
+    outMesh.primitives = std::move(primitiveViews);
+    outMesh.textures   = std::move(textureEntries);
+
+    return true;
+}
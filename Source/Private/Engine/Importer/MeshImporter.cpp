@@ -1,5 +1,9 @@
 #include <Znpch.h>
 #include <Engine/Importer/MeshImporter.h>
+#include <Engine/Importer/CookedMesh.h>
+#include <Engine/Importer/TextureImporter.h>
+#include <Core/IO/DerivedDataCache.h>
+#include <Core/IO/IO.h>
 #include <Rendering/RHI/RHIMesh.h>
 #include <filesystem>
 
@@ -23,10 +27,94 @@ bool Zn::MeshImporter::ImportAll(const String& fileName, MeshImporterOutput& out
 {
     std::filesystem::path filePath = fileName;
 
-    if (filePath.extension() == ".gltf")
+    if (filePath.extension() == ".gltf" || filePath.extension() == ".glb")
     {
         return ImportAll_GLTF(fileName, output);
     }
 
     return false;
 }
+
+bool Zn::MeshImporter::ImportCooked(const String& fileName, CookedMesh& outMesh)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    DerivedDataCache& cache = DerivedDataCache::Get();
+
+    u64 key = 0;
+
+    if (!cache.IsEnabled() || !CalculateCookedKey(IO::GetAbsolutePath(fileName), key))
+    {
+        return false;
+    }
+
+    if (CookedMesh::Load(cache.Load(key), outMesh))
+    {
+        return true;
+    }
+
+    MeshImporterOutput output;
+    Vector<u8>         cookedBlob;
+
+    if (!ImportAll(fileName, output) || !CookedMesh::Cook(output, cookedBlob) || !cache.Store(key, cookedBlob))
+    {
+        return false;
+    }
+
+    return CookedMesh::Load(cache.Load(key), outMesh);
+}
+
+// Textures are cached on their own by the TextureImporter, cooked meshes only reference them.
+bool Zn::MeshImporter::CalculateCookedKey(const String& fileName, u64& outKey)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    const MappedFile source = IO::MapFile(fileName);
+
+    if (!source)
+    {
+        return false;
+    }
+
+    outKey = HashCombine(HashCalculate("MeshImporter"),
+                         HashCalculate(kImporterVersion),
+                         HashCalculate(CookedMesh::kVersion),
+                         HashBytes(source.GetData(), source.GetSize()));
+
+    // Cooked texture settings follow the compression options.
+    for (u8 usage = 0; usage < static_cast<u8>(TextureUsage::COUNT); ++usage)
+    {
+        outKey = HashCombine(outKey, HashCalculate(TextureImporter::SelectCompression(static_cast<TextureUsage>(usage))));
+    }
+
+    const std::filesystem::path extension = std::filesystem::path(fileName).extension();
+
+    if (extension != ".gltf" && extension != ".glb")
+    {
+        return true;
+    }
+
+    Vector<String> bufferUris;
+
+    if (!GetBufferUris_GLTF(source, bufferUris))
+    {
+        return false;
+    }
+
+    const std::filesystem::path baseDirectory = std::filesystem::path(fileName).parent_path();
+
+    for (const String& bufferUri : bufferUris)
+    {
+        const MappedFile buffer = IO::MapFile((baseDirectory / bufferUri).string());
+
+        // The import would fail as well, don't cache anything.
+        if (!buffer)
+        {
+            return false;
+        }
+
+        outKey = HashCombine(outKey, HashCalculate(bufferUri), HashBytes(buffer.GetData(), buffer.GetSize()));
+    }
+
+    return true;
+}
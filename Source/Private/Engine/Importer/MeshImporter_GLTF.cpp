@@ -1,8 +1,17 @@
 #include <Znpch.h>
 #include <Engine/Importer/MeshImporter.h>
 #include <Engine/Importer/TextureImporter.h>
+#include <Engine/Importer/MeshOptimizer.h>
+#include <Engine/Importer/MeshSimplifier.h>
+#include <Engine/TransformHierarchy.h>
+#include <Core/IO/IO.h>
+#include <Core/Async/ThreadPool.h>
 #include <Rendering/RHI/RHIMesh.h>
-#include <Core/Math/Math.h>
+#include <Core/Math/StreamConvert.h>
+#include <algorithm>
+#include <filesystem>
+#include <optional>
+#include <span>
 
 #define TINYGLTF_IMPLEMENTATION
 
@@ -28,27 +37,6 @@ namespace
 {
 using namespace Zn;
 
-i32 FetchIndex(const u8* src, u32 componentType)
-{
-    if (componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE)
-    {
-        return static_cast<i32>(*src);
-    }
-    else if (componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT)
-    {
-        return static_cast<i32>(*reinterpret_cast<const u16*>(src));
-    }
-    else if (componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT)
-    {
-        return static_cast<i32>(*reinterpret_cast<const u32*>(src));
-    }
-    else
-    {
-        check(false && "Index type not supported.");
-        return 0;
-    }
-}
-
 Zn::PrimitiveTopology CastTopology(i32 gltfTopology)
 {
     if (gltfTopology == TINYGLTF_MODE_POINTS)
@@ -87,16 +75,267 @@ Zn::AlphaMode TranslateAlphaMode(const Zn::String& gltfAlphaMode)
     return Zn::AlphaMode::COUNT;
 }
 
-SharedPtr<TextureSource> CreateTextureSource(const tinygltf::Image& gltfImage)
+// Memory backing each buffer of the model, viewed in place in the BIN chunk or in the mapping of its file.
+using BufferSpans = Vector<std::span<const u8>>;
+
+// Bytes of the buffers and images the model references. tinygltf is only handed the rest of the document, so that it neither copies
+// the BIN chunk nor reads the external files: they are mapped, only data uris are decoded to memory.
+struct GLTFSources
+{
+    BufferSpans buffers;
+
+    // Encoded images, empty if they can't be read.
+    BufferSpans images;
+
+    // Images are keyed by uri in the output maps. Images embedded in a buffer view (as in a .glb) have no uri, key them like data
+    // uris since no file backs them.
+    Vector<String> imageKeys;
+
+    // External files by uri, read on the IO threads while the document is parsed.
+    UnorderedMap<String, std::future<IOReadResult>> pendingFiles;
+    UnorderedMap<String, MappedFile>                files;
+
+    Vector<Vector<u8>> decodedUris;
+};
+
+String GetString(const nlohmann::json& object, cstring name)
+{
+    const auto it = object.find(name);
+
+    return it != object.end() && it->is_string() ? it->get<String>() : String();
+}
+
+i64 GetInteger(const nlohmann::json& object, cstring name, i64 defaultValue)
+{
+    const auto it = object.find(name);
+
+    return it != object.end() && it->is_number_integer() ? it->get<i64>() : defaultValue;
+}
+
+// Queues the reads of the external buffers and images as a single batch, so that they load while tinygltf parses the document.
+void RequestFiles(const nlohmann::json&        buffers,
+                  const nlohmann::json&        images,
+                  const std::filesystem::path& baseDirectory,
+                  GLTFSources&                 outSources)
+{
+    Vector<String> uris;
+    Vector<String> fileNames;
+
+    for (const nlohmann::json* objects : {&buffers, &images})
+    {
+        if (!objects->is_array())
+        {
+            continue;
+        }
+
+        for (const nlohmann::json& object : *objects)
+        {
+            const String uri = GetString(object, "uri");
+
+            if (uri.empty() || tinygltf::IsDataURI(uri) || std::find(uris.begin(), uris.end(), uri) != uris.end())
+            {
+                continue;
+            }
+
+            // Same decoding the loader applies before opening the file.
+            String decodedUri;
+            tinygltf::URIDecode(uri, &decodedUri, nullptr);
+
+            uris.push_back(uri);
+            fileNames.push_back((baseDirectory / decodedUri).string());
+        }
+    }
+
+    Vector<std::future<IOReadResult>> reads = IO::ReadBinaryFilesAsync(fileNames);
+
+    for (sizet index = 0; index < uris.size(); ++index)
+    {
+        outSources.pendingFiles.insert({uris[index], std::move(reads[index])});
+    }
+}
+
+// Data uris are decoded, other uris are the files queued by RequestFiles.
+bool ReadUri(const String& uri, GLTFSources& sources, std::span<const u8>& outBytes)
+{
+    if (tinygltf::IsDataURI(uri))
+    {
+        Vector<u8> decoded;
+        String     mimeType;
+
+        if (!tinygltf::DecodeDataURI(&decoded, mimeType, uri, 0, false))
+        {
+            return false;
+        }
+
+        outBytes = sources.decodedUris.emplace_back(std::move(decoded));
+
+        return true;
+    }
+
+    auto file = sources.files.find(uri);
+
+    if (file == sources.files.end())
+    {
+        auto pendingFile = sources.pendingFiles.find(uri);
+
+        if (pendingFile == sources.pendingFiles.end())
+        {
+            return false;
+        }
+
+        file = sources.files.insert({uri, pendingFile->second.get().file}).first;
+
+        sources.pendingFiles.erase(pendingFile);
+    }
+
+    outBytes = file->second.GetView();
+
+    return file->second.IsValid();
+}
+
+// Only the first buffer of a .glb can omit its uri, it is the BIN chunk.
+bool ReadBuffers(const nlohmann::json& buffers, std::span<const u8> binaryChunk, GLTFSources& outSources)
+{
+    if (buffers.is_null())
+    {
+        return true;
+    }
+
+    if (!buffers.is_array())
+    {
+        return false;
+    }
+
+    for (const nlohmann::json& buffer : buffers)
+    {
+        const String uri        = GetString(buffer, "uri");
+        const i64    byteLength = GetInteger(buffer, "byteLength", -1);
+
+        std::span<const u8> bytes;
+
+        if (uri.empty() && outSources.buffers.empty())
+        {
+            bytes = binaryChunk;
+        }
+        else if (uri.empty() || !ReadUri(uri, outSources, bytes))
+        {
+            ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Failed to read buffer %llu", outSources.buffers.size());
+            return false;
+        }
+
+        if (byteLength < 0 || static_cast<u64>(byteLength) > bytes.size())
+        {
+            ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Buffer %llu is shorter than its byteLength", outSources.buffers.size());
+            return false;
+        }
+
+        outSources.buffers.push_back(bytes.first(static_cast<sizet>(byteLength)));
+    }
+
+    return true;
+}
+
+// Images that can't be read keep an empty view, they fail to decode in BuildTextures.
+void ReadImages(const nlohmann::json& images, const tinygltf::Model& model, GLTFSources& outSources)
+{
+    if (!images.is_array())
+    {
+        return;
+    }
+
+    for (const nlohmann::json& image : images)
+    {
+        const String uri        = GetString(image, "uri");
+        const i64    bufferView = GetInteger(image, "bufferView", -1);
+
+        std::span<const u8> bytes;
+
+        if (bufferView >= 0 && bufferView < static_cast<i64>(model.bufferViews.size()))
+        {
+            const tinygltf::BufferView& view = model.bufferViews[bufferView];
+
+            if (view.buffer >= 0 && view.buffer < outSources.buffers.size() && view.byteOffset <= outSources.buffers[view.buffer].size() &&
+                view.byteLength <= outSources.buffers[view.buffer].size() - view.byteOffset)
+            {
+                bytes = outSources.buffers[view.buffer].subspan(view.byteOffset, view.byteLength);
+            }
+        }
+        else if (!uri.empty())
+        {
+            ReadUri(uri, outSources, bytes);
+        }
+
+        outSources.images.push_back(bytes);
+        outSources.imageKeys.push_back(uri.empty() ? "data:bufferView," + std::to_string(bufferView) : uri);
+    }
+}
+
+// Holds level 0 only, decoded to RGBA8 as the TextureImporter does. Returns nullptr if the image can't be decoded.
+SharedPtr<TextureSource> DecodeTextureSource(std::span<const u8> bytes)
 {
-    check(gltfImage.pixel_type == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE && "Missing implementation for other texture component types.");
+    i32 width    = 0;
+    i32 height   = 0;
+    i32 channels = 0;
+
+    if (bytes.empty() || bytes.size() > static_cast<sizet>(i32_max))
+    {
+        return nullptr;
+    }
+
+    u8* texels = stbi_load_from_memory(bytes.data(), static_cast<i32>(bytes.size()), &width, &height, &channels, STBI_rgb_alpha);
+
+    if (!texels)
+    {
+        return nullptr;
+    }
 
-    return SharedPtr<TextureSource>(new TextureSource {
-        .width    = gltfImage.width,
-        .height   = gltfImage.height,
-        .channels = gltfImage.component,
-        .data     = gltfImage.image,
+    SharedPtr<TextureSource> texture(new TextureSource {
+        .width    = width,
+        .height   = height,
+        .channels = channels,
+        .data     = TextureBuffer(texels, static_cast<sizet>(width) * height * 4, stbi_image_free),
     });
+
+    return texture;
+}
+
+// Textures are independent of each other, each one is decoded on its own worker. Their levels are split on the workers as well.
+// Images that fail to decode are removed from the output, their materials fall back to the default textures.
+void BuildTextures(MeshImporterOutput& output, const GLTFSources& sources, const Vector<i32>& images)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    // Entries were inserted by AssignTexture, only their values are written concurrently.
+    ThreadPool::GetWorkerPool().ParallelFor(images.size(),
+                                            [&](sizet index)
+                                            {
+                                                const String&             imageKey = sources.imageKeys[images[index]];
+                                                SharedPtr<TextureSource>& texture  = output.textures.at(imageKey);
+
+                                                texture = DecodeTextureSource(sources.images[images[index]]);
+
+                                                if (texture)
+                                                {
+                                                    const TextureImportSettings& settings = output.textureSettings.at(imageKey);
+
+                                                    TextureImporter::GenerateMips(*texture, settings);
+                                                    TextureImporter::Compress(*texture, settings);
+                                                }
+                                            });
+
+    for (i32 image : images)
+    {
+        const String& imageKey = sources.imageKeys[image];
+
+        if (!output.textures.at(imageKey))
+        {
+            ZN_LOG(LogMeshImporter, ELogVerbosity::Warning, "Failed to decode image %d, replaced by a default texture", image);
+
+            output.textures.erase(imageKey);
+            output.textureSettings.erase(imageKey);
+            output.samplers.erase(imageKey);
+        }
+    }
 }
 
 SamplerWrap TranslateWrap(i32 wrap)
@@ -158,29 +397,40 @@ TextureSampler CreateTextureSampler(const tinygltf::Sampler& gltfSampler)
 
     return sampler;
 }
-bool AssignTexture(i32 textureIndex, const tinygltf::Model& model, MeshImporterOutput& output, ResourceHandle& outHandle)
+
+// An image shared by several materials keeps the settings of the first one. Images seen for the first time are added to
+// outNewImages, BuildTextures decodes them into their entry of output.textures.
+bool AssignTexture(i32                          textureIndex,
+                   const tinygltf::Model&       model,
+                   const GLTFSources&           sources,
+                   const TextureImportSettings& settings,
+                   MeshImporterOutput&          output,
+                   Vector<i32>&                 outNewImages,
+                   ResourceHandle&              outHandle)
 {
     if (textureIndex >= 0 && textureIndex < model.textures.size())
     {
         const tinygltf::Texture& texture = model.textures[textureIndex];
-        if (texture.source >= 0 && texture.source < model.images.size())
+        if (texture.source >= 0 && texture.source < sources.images.size())
         {
-            const tinygltf::Image& image = model.images[texture.source];
+            const String& imageKey = sources.imageKeys[texture.source];
 
-            if (!output.textures.contains(image.uri))
+            if (!output.textures.contains(imageKey))
             {
-                output.textures.insert({image.uri, CreateTextureSource(image)});
+                output.textures.insert({imageKey, nullptr});
+                output.textureSettings.insert({imageKey, settings});
+                outNewImages.push_back(texture.source);
             }
 
-            if (!output.samplers.contains(image.uri))
+            if (!output.samplers.contains(imageKey))
             {
                 tinygltf::Sampler sampler = texture.sampler >= 0 ? model.samplers[texture.sampler] : tinygltf::Sampler();
-                output.samplers.insert({image.uri, CreateTextureSampler(sampler)});
+                output.samplers.insert({imageKey, CreateTextureSampler(sampler)});
             }
 
             // TODO: ResourceHandle should only be the pointer to the GPU resource. Using it here so that we know what to
             // associate.
-            outHandle = ResourceHandle(HashCalculate(image.uri));
+            outHandle = ResourceHandle(HashCalculate(imageKey));
 
             return true;
         }
@@ -189,18 +439,417 @@ bool AssignTexture(i32 textureIndex, const tinygltf::Model& model, MeshImporterO
     return false;
 }
 
+// Returns the elements of the accessor tightly packed, nullptr if they don't fit in their buffer view or aren't elementSize bytes.
+// Elements of interleaved buffer views are gathered into scratch, the conversions only read packed streams.
 template<typename T>
-const T* AccessBuffer(const tinygltf::Model& model, const tinygltf::Accessor& accessor, i32* outSize = nullptr)
+const T* AccessBuffer(const tinygltf::Model&    model,
+                      const BufferSpans&        buffers,
+                      const tinygltf::Accessor& accessor,
+                      Vector<u8>&               scratch,
+                      sizet                     elementSize = sizeof(T))
 {
+    if (accessor.bufferView < 0 || accessor.bufferView >= model.bufferViews.size())
+    {
+        return nullptr;
+    }
+
     const tinygltf::BufferView& bufferView = model.bufferViews[accessor.bufferView];
-    const tinygltf::Buffer&     buffer     = model.buffers[bufferView.buffer];
 
-    if (outSize)
+    if (bufferView.buffer < 0 || bufferView.buffer >= buffers.size() || bufferView.byteOffset > buffers[bufferView.buffer].size() ||
+        bufferView.byteLength > buffers[bufferView.buffer].size() - bufferView.byteOffset)
+    {
+        return nullptr;
+    }
+
+    const std::span<const u8> view = buffers[bufferView.buffer].subspan(bufferView.byteOffset, bufferView.byteLength);
+
+    const i32 componentSize = tinygltf::GetComponentSizeInBytes(accessor.componentType);
+    const i32 numComponents = tinygltf::GetNumComponentsInType(accessor.type);
+    const i32 byteStride    = accessor.ByteStride(bufferView);
+
+    if (componentSize <= 0 || numComponents <= 0 || byteStride <= 0 || static_cast<sizet>(componentSize * numComponents) != elementSize)
+    {
+        return nullptr;
+    }
+
+    const sizet stride = static_cast<sizet>(byteStride);
+
+    // The last element only spans elementSize bytes, not a whole stride.
+    if (accessor.count == 0 || accessor.count > view.size() || accessor.byteOffset > view.size() ||
+        (accessor.count - 1) * stride + elementSize > view.size() - accessor.byteOffset)
+    {
+        return nullptr;
+    }
+
+    const u8* elements = view.data() + accessor.byteOffset;
+
+    if (stride == elementSize)
+    {
+        return reinterpret_cast<const T*>(elements);
+    }
+
+    scratch.resize(accessor.count * elementSize);
+
+    for (sizet index = 0; index < accessor.count; ++index)
+    {
+        memcpy(scratch.data() + index * elementSize, elements + index * stride, elementSize);
+    }
+
+    return reinterpret_cast<const T*>(scratch.data());
+}
+
+constexpr u32 kGLBMagic           = 0x46546C67; // glTF
+constexpr u32 kGLBJsonChunkType   = 0x4E4F534A; // JSON
+constexpr u32 kGLBBinaryChunkType = 0x004E4942; // BIN
+
+struct GLBHeader
+{
+    u32 magic;
+    u32 version;
+    u32 length;
+};
+
+struct GLBChunkHeader
+{
+    u32 length;
+    u32 type;
+};
+
+bool IsGLB(std::span<const u8> file)
+{
+    GLBHeader header {};
+
+    if (file.size() >= sizeof(header))
+    {
+        memcpy(&header, file.data(), sizeof(header));
+    }
+
+    return header.magic == kGLBMagic;
+}
+
+// The JSON chunk comes first, followed by the optional BIN chunk.
+std::span<const u8> FindGLBChunk(std::span<const u8> file, u32 chunkType)
+{
+    sizet offset = sizeof(GLBHeader);
+
+    for (u32 chunk = 0; chunk < 2 && offset + sizeof(GLBChunkHeader) <= file.size(); ++chunk)
+    {
+        GLBChunkHeader header;
+        memcpy(&header, file.data() + offset, sizeof(header));
+
+        offset += sizeof(header);
+
+        if (header.length > file.size() - offset)
+        {
+            break;
+        }
+
+        if (header.type == chunkType)
+        {
+            return file.subspan(offset, header.length);
+        }
+
+        offset += header.length;
+    }
+
+    return {};
+}
+
+// Local matrix of the node, relative to its parent. Either the matrix or the TRS properties are set, the matrix wins if both are.
+glm::mat4 GetNodeMatrix(const tinygltf::Node& node)
+{
+    if (node.matrix.size() == 16)
+    {
+        return glm::mat4(glm::make_mat4x4(node.matrix.data()));
+    }
+
+    // T * R * S
+    glm::mat4 matrix {1.f};
+
+    if (node.translation.size() == 3)
+    {
+        matrix = glm::translate(matrix, glm::vec3(glm::make_vec3(node.translation.data())));
+    }
+    if (node.rotation.size() == 4)
+    {
+        glm::quat q = glm::make_quat(node.rotation.data());
+        matrix *= glm::mat4(q);
+    }
+    if (node.scale.size() == 3)
+    {
+        matrix = glm::scale(matrix, glm::vec3(glm::make_vec3(node.scale.data())));
+    }
+
+    return matrix;
+}
+
+// Writes to the shared texture and sampler maps, not safe to call concurrently.
+MaterialAttributes TranslateMaterial(const tinygltf::Model&    model,
+                                     const GLTFSources&        sources,
+                                     const tinygltf::Material& material,
+                                     MeshImporterOutput&       output,
+                                     Vector<i32>&              outNewImages)
+{
+    MaterialAttributes materialAttributes {};
+
+    materialAttributes.baseColor   = *reinterpret_cast<const glm::dvec4*>(material.pbrMetallicRoughness.baseColorFactor.data());
+    materialAttributes.metalness   = material.pbrMetallicRoughness.metallicFactor;
+    materialAttributes.roughness   = material.pbrMetallicRoughness.roughnessFactor;
+    materialAttributes.emissive    = *reinterpret_cast<const glm::dvec3*>(material.emissiveFactor.data());
+    materialAttributes.occlusion   = material.occlusionTexture.strength;
+    materialAttributes.alphaCutoff = material.alphaCutoff;
+    materialAttributes.doubleSided = material.doubleSided;
+    materialAttributes.alphaMode   = TranslateAlphaMode(material.alphaMode);
+
+    const bool bHasAlpha = materialAttributes.alphaMode != AlphaMode::Opaque;
+
+    const TextureImportSettings baseColorSettings {
+        .alphaCutoff            = materialAttributes.alphaCutoff,
+        .bSRGB                  = true,
+        .bPreserveAlphaCoverage = materialAttributes.alphaMode == AlphaMode::Mask,
+        .compression            = TextureImporter::SelectCompression(bHasAlpha ? TextureUsage::ColorAlpha : TextureUsage::Color),
+    };
+
+    const TextureImportSettings emissiveSettings {.bSRGB = true, .compression = TextureImporter::SelectCompression(TextureUsage::Color)};
+    const TextureImportSettings normalSettings {.compression = TextureImporter::SelectCompression(TextureUsage::Normal)};
+    const TextureImportSettings linearSettings {.compression = TextureImporter::SelectCompression(TextureUsage::Linear)};
+
+    AssignTexture(material.pbrMetallicRoughness.baseColorTexture.index,
+                  model,
+                  sources,
+                  baseColorSettings,
+                  output,
+                  outNewImages,
+                  materialAttributes.baseColorTexture);
+    AssignTexture(material.pbrMetallicRoughness.metallicRoughnessTexture.index,
+                  model,
+                  sources,
+                  linearSettings,
+                  output,
+                  outNewImages,
+                  materialAttributes.metalnessTexture);
+    AssignTexture(material.normalTexture.index, model, sources, normalSettings, output, outNewImages, materialAttributes.normalTexture);
+    AssignTexture(
+        material.occlusionTexture.index, model, sources, linearSettings, output, outNewImages, materialAttributes.occlusionTexture);
+    AssignTexture(
+        material.emissiveTexture.index, model, sources, emissiveSettings, output, outNewImages, materialAttributes.emissiveTexture);
+
+    return materialAttributes;
+}
+
+// Widens the indices to u32, the component type is resolved once per accessor rather than once per index. Fails if they can't be read.
+bool CopyIndices(const tinygltf::Model& model, const BufferSpans& buffers, const tinygltf::Accessor& accessor, Vector<u32>& outIndices)
+{
+    Vector<u8> scratch;
+
+    outIndices.resize(accessor.count);
+
+    switch (accessor.componentType)
     {
-        *outSize = accessor.count * tinygltf::GetComponentSizeInBytes(accessor.componentType);
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+        if (const u8* src = AccessBuffer<u8>(model, buffers, accessor, scratch))
+        {
+            StreamConvert::WidenIndices(src, accessor.count, outIndices.data());
+            return true;
+        }
+        break;
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+        if (const u16* src = AccessBuffer<u16>(model, buffers, accessor, scratch))
+        {
+            StreamConvert::WidenIndices(src, accessor.count, outIndices.data());
+            return true;
+        }
+        break;
+    case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+        if (const u32* src = AccessBuffer<u32>(model, buffers, accessor, scratch))
+        {
+            outIndices.assign(src, src + accessor.count);
+            return true;
+        }
+        break;
+    default:
+        check(false && "Index type not supported.");
+        break;
+    }
+
+    outIndices.clear();
+
+    return false;
+}
+
+// Normalized integer attributes are mapped from the range of their component type to the accessor [min, max] range, [0, 1] when
+// the accessor doesn't declare it. Components missing from the source are set to 1, as expected for the alpha of vec3 colors.
+// Fails if the attribute can't be read.
+bool DequantizeAttribute(const tinygltf::Model&    model,
+                         const BufferSpans&        buffers,
+                         const tinygltf::Accessor& accessor,
+                         u32                       srcComponents,
+                         u32                       dstComponents,
+                         f32*                      dst)
+{
+    const bool bIsShort = accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
+
+    check((bIsShort || accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) && "Normalized type not supported.");
+
+    const f32 upper = static_cast<f32>(bIsShort ? std::numeric_limits<u16>::max() : std::numeric_limits<u8>::max());
+
+    glm::vec4 scale {0.f};
+    glm::vec4 bias {1.f};
+
+    for (u32 component = 0; component < srcComponents; ++component)
+    {
+        const f32 min = component < accessor.minValues.size() ? static_cast<f32>(accessor.minValues[component]) : 0.f;
+        const f32 max = component < accessor.maxValues.size() ? static_cast<f32>(accessor.maxValues[component]) : 1.f;
+
+        scale[component] = (max - min) / upper;
+        bias[component]  = min;
+    }
+
+    Vector<u8> scratch;
+
+    if (bIsShort)
+    {
+        const u16* src = AccessBuffer<u16>(model, buffers, accessor, scratch, srcComponents * sizeof(u16));
+
+        if (src)
+        {
+            StreamConvert::Dequantize(src, accessor.count, srcComponents, dstComponents, scale, bias, dst);
+        }
+
+        return src != nullptr;
+    }
+
+    const u8* src = AccessBuffer<u8>(model, buffers, accessor, scratch, srcComponents * sizeof(u8));
+
+    if (src)
+    {
+        StreamConvert::Dequantize(src, accessor.count, srcComponents, dstComponents, scale, bias, dst);
+    }
+
+    return src != nullptr;
+}
+
+// Only reads from the model, primitives can be extracted in parallel. Fails if the POSITION attribute is missing or if the positions
+// or the indices can't be read, other attributes that can't be read are left empty.
+bool ExtractPrimitive(const tinygltf::Model&     model,
+                      const BufferSpans&         buffers,
+                      const tinygltf::Primitive& primitive,
+                      RHIPrimitive&              outPrimitive)
+{
+    using namespace tinygltf;
+
+    outPrimitive.topology = CastTopology(primitive.mode);
+
+    // Holds the attribute being read when its buffer view is interleaved.
+    Vector<u8> scratch;
+
+    if (auto positionAttribute = primitive.attributes.find("POSITION"); positionAttribute != primitive.attributes.end())
+    {
+        const Accessor& accessor = model.accessors[positionAttribute->second];
+
+        const glm::vec3* src = AccessBuffer<glm::vec3>(model, buffers, accessor, scratch);
+
+        if (!src)
+        {
+            return false;
+        }
+
+        outPrimitive.position.assign(src, src + accessor.count);
+    }
+    else
+    {
+        return false;
+    }
+
+    if (auto normalAttribute = primitive.attributes.find("NORMAL"); normalAttribute != primitive.attributes.end())
+    {
+        const Accessor& accessor = model.accessors[normalAttribute->second];
+
+        if (const glm::vec3* src = AccessBuffer<glm::vec3>(model, buffers, accessor, scratch))
+        {
+            outPrimitive.normal.assign(src, src + accessor.count);
+        }
+    }
+
+    if (auto tangentAttribute = primitive.attributes.find("TANGENT"); tangentAttribute != primitive.attributes.end())
+    {
+        const Accessor& accessor = model.accessors[tangentAttribute->second];
+
+        if (const glm::vec4* src = AccessBuffer<glm::vec4>(model, buffers, accessor, scratch))
+        {
+            outPrimitive.tangent.assign(src, src + accessor.count);
+        }
+    }
+
+    if (auto texCoordAttribute = primitive.attributes.find("TEXCOORD_0"); texCoordAttribute != primitive.attributes.end())
+    {
+        const Accessor& accessor = model.accessors[texCoordAttribute->second];
+
+        if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+        {
+            if (const glm::vec2* src = AccessBuffer<glm::vec2>(model, buffers, accessor, scratch))
+            {
+                outPrimitive.uv.assign(src, src + accessor.count);
+            }
+        }
+        else
+        {
+            outPrimitive.uv.resize(accessor.count);
+
+            if (!DequantizeAttribute(model, buffers, accessor, 2, 2, reinterpret_cast<f32*>(outPrimitive.uv.data())))
+            {
+                outPrimitive.uv.clear();
+            }
+        }
+    }
+
+    if (auto colorAttribute = primitive.attributes.find("COLOR_0"); colorAttribute != primitive.attributes.end())
+    {
+        const Accessor& accessor = model.accessors[colorAttribute->second];
+
+        if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
+        {
+            if (accessor.type == TINYGLTF_TYPE_VEC3)
+            {
+                if (const glm::vec3* src = AccessBuffer<glm::vec3>(model, buffers, accessor, scratch))
+                {
+                    outPrimitive.color.resize(accessor.count);
+
+                    StreamConvert::ExpandVec3(src, accessor.count, 1.f, outPrimitive.color.data());
+                }
+            }
+            else if (accessor.type == TINYGLTF_TYPE_VEC4)
+            {
+                if (const glm::vec4* src = AccessBuffer<glm::vec4>(model, buffers, accessor, scratch))
+                {
+                    outPrimitive.color.assign(src, src + accessor.count);
+                }
+            }
+        }
+        else
+        {
+            outPrimitive.color.resize(accessor.count);
+
+            const u32 numComponents = accessor.type == TINYGLTF_TYPE_VEC4 ? 4 : 3;
+
+            if (!DequantizeAttribute(model, buffers, accessor, numComponents, 4, reinterpret_cast<f32*>(outPrimitive.color.data())))
+            {
+                outPrimitive.color.clear();
+            }
+        }
     }
 
-    return reinterpret_cast<const T*>(buffer.data.data() + bufferView.byteOffset + accessor.byteOffset);
+    if (primitive.indices >= 0)
+    {
+        const Accessor& indicesAccessor = model.accessors[primitive.indices];
+
+        if (indicesAccessor.type == TINYGLTF_TYPE_SCALAR && !CopyIndices(model, buffers, indicesAccessor, outPrimitive.indices))
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 } // namespace
 
@@ -216,7 +865,48 @@ bool Zn::MeshImporter::ImportAll_GLTF(const String& fileName, MeshImporterOutput
     String error;
     String warning;
 
-    bool result = loader.LoadASCIIFromFile(&model, &error, &warning, fileName);
+    // Parse in place from the mapped file rather than reading it into a temporary buffer.
+    const MappedFile file = IO::MapFile(fileName);
+
+    if (!file)
+    {
+        ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Failed to open GLTF %s", fileName.c_str());
+
+        return false;
+    }
+
+    const std::filesystem::path baseDirectory = std::filesystem::path(IO::GetAbsolutePath(fileName)).parent_path();
+
+    const bool bIsBinary = IsGLB(file.GetView());
+
+    const std::span<const u8> json        = bIsBinary ? FindGLBChunk(file.GetView(), kGLBJsonChunkType) : file.GetView();
+    const std::span<const u8> binaryChunk = bIsBinary ? FindGLBChunk(file.GetView(), kGLBBinaryChunkType) : std::span<const u8>();
+
+    nlohmann::json document = nlohmann::json::parse(json.begin(), json.end(), nullptr, false);
+
+    if (document.is_discarded() || !document.is_object())
+    {
+        ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Failed to parse GLTF %s", fileName.c_str());
+
+        return false;
+    }
+
+    // tinygltf would copy the BIN chunk and read every external file, it parses the document without its buffers and images. Their
+    // files are read on the IO threads meanwhile, the images are read once the buffer views they may point to are parsed.
+    nlohmann::json buffers = document.contains("buffers") ? std::move(document["buffers"]) : nlohmann::json();
+    nlohmann::json images  = document.contains("images") ? std::move(document["images"]) : nlohmann::json();
+
+    document.erase("buffers");
+    document.erase("images");
+
+    GLTFSources sources;
+
+    RequestFiles(buffers, images, baseDirectory, sources);
+
+    const String strippedJson = document.dump();
+
+    bool result = loader.LoadASCIIFromString(
+        &model, &error, &warning, strippedJson.c_str(), static_cast<u32>(strippedJson.size()), baseDirectory.string());
 
     if (!warning.empty())
     {
@@ -235,238 +925,188 @@ bool Zn::MeshImporter::ImportAll_GLTF(const String& fileName, MeshImporterOutput
         return false;
     }
 
-    for (const Node& node : model.nodes)
+    if (!ReadBuffers(buffers, binaryChunk, sources))
     {
-        if (node.mesh >= 0)
-        {
-            const Mesh& mesh = model.meshes[node.mesh];
-
-            for (const Primitive& primitive : mesh.primitives)
-            {
-                RHIPrimitive& newPrimitive = output.primitives.emplace_back(RHIPrimitive {});
+        ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Failed to read the buffers of GLTF %s", fileName.c_str());
 
-                newPrimitive.matrix = glm::mat4 {1.f};
+        return false;
+    }
 
-                if (node.translation.size() == 3)
-                {
-                    newPrimitive.matrix = glm::translate(newPrimitive.matrix, glm::vec3(glm::make_vec3(node.translation.data())));
-                }
-                if (node.rotation.size() == 4)
-                {
-                    glm::quat q = glm::make_quat(node.rotation.data());
-                    newPrimitive.matrix *= glm::mat4(q);
-                }
-                if (node.scale.size() == 3)
-                {
-                    newPrimitive.matrix = glm::scale(newPrimitive.matrix, glm::vec3(glm::make_vec3(node.scale.data())));
-                }
-                if (node.matrix.size() == 16)
-                {
-                    newPrimitive.matrix = glm::make_mat4x4(node.matrix.data());
-                }
+    ReadImages(images, model, sources);
 
-                newPrimitive.topology = CastTopology(primitive.mode);
+    const BufferSpans& buffers = sources.buffers;
 
-                if (auto positionAttribute = primitive.attributes.find("POSITION"); positionAttribute != primitive.attributes.end())
-                {
-                    const Accessor& accessor = model.accessors[positionAttribute->second];
+    struct PrimitiveJob
+    {
+        const Primitive* primitive;
+        glm::mat4        matrix;
+    };
 
-                    const glm::vec3* src = AccessBuffer<glm::vec3>(model, accessor);
+    Vector<PrimitiveJob> jobs;
 
-                    newPrimitive.position.assign(src, src + accessor.count);
-                }
-                else
-                {
-                    ZN_LOG(
-                        LogMeshImporter, ELogVerbosity::Error, "Unable to find POSITION attribute for mesh in file %s", fileName.c_str());
-                    return false;
-                }
+    // Primitives are placed with the world matrix of their node, which accumulates the matrices of all its ancestors.
+    const u32 numNodes = static_cast<u32>(model.nodes.size());
 
-                if (auto normalAttribute = primitive.attributes.find("NORMAL"); normalAttribute != primitive.attributes.end())
-                {
-                    const Accessor& accessor = model.accessors[normalAttribute->second];
+    Vector<u32>       parents(numNodes, TransformHierarchy::kNoParent);
+    Vector<glm::mat4> localMatrices(numNodes);
 
-                    const glm::vec3* src = AccessBuffer<glm::vec3>(model, accessor);
+    for (u32 nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex)
+    {
+        localMatrices[nodeIndex] = GetNodeMatrix(model.nodes[nodeIndex]);
 
-                    newPrimitive.normal.assign(src, src + accessor.count);
-                }
+        for (i32 child : model.nodes[nodeIndex].children)
+        {
+            if (child >= 0 && child < static_cast<i32>(numNodes))
+            {
+                parents[child] = nodeIndex;
+            }
+        }
+    }
 
-                if (auto tangentAttribute = primitive.attributes.find("TANGENT"); tangentAttribute != primitive.attributes.end())
-                {
-                    const Accessor& accessor = model.accessors[tangentAttribute->second];
+    const TransformHierarchy hierarchy(parents, localMatrices);
 
-                    const glm::vec4* src = AccessBuffer<glm::vec4>(model, accessor);
+    // Materials fill the texture maps shared by the whole output, resolve them serially before fanning out.
+    Vector<std::optional<MaterialAttributes>> materials(model.materials.size());
+    Vector<i32>                               newImages;
 
-                    newPrimitive.tangent.assign(src, src + accessor.count);
-                }
+    for (u32 nodeIndex = 0; nodeIndex < numNodes; ++nodeIndex)
+    {
+        const Node& node = model.nodes[nodeIndex];
 
-                if (auto texCoordAttribute = primitive.attributes.find("TEXCOORD_0"); texCoordAttribute != primitive.attributes.end())
-                {
-                    const Accessor& accessor = model.accessors[texCoordAttribute->second];
+        if (node.mesh < 0)
+        {
+            continue;
+        }
 
-                    if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                    {
-                        const glm::vec2* src = AccessBuffer<glm::vec2>(model, accessor);
+        const glm::mat4& matrix = hierarchy.GetWorldMatrix(nodeIndex);
 
-                        newPrimitive.uv.assign(src, src + accessor.count);
-                    }
-                    else
-                    {
-                        newPrimitive.uv.resize(accessor.count);
+        for (const Primitive& primitive : model.meshes[node.mesh].primitives)
+        {
+            jobs.push_back(PrimitiveJob {.primitive = &primitive, .matrix = matrix});
 
-                        const u8* src = AccessBuffer<u8>(model, accessor);
+            if (primitive.material >= 0 && primitive.material < model.materials.size() && !materials[primitive.material])
+            {
+                materials[primitive.material] = TranslateMaterial(model, sources, model.materials[primitive.material], output, newImages);
+            }
+        }
+    }
 
-                        const f32 minX = static_cast<f32>(accessor.minValues[0]);
-                        const f32 minY = static_cast<f32>(accessor.minValues[1]);
+    BuildTextures(output, sources, newImages);
 
-                        const f32 maxX = static_cast<f32>(accessor.maxValues[0]);
-                        const f32 maxY = static_cast<f32>(accessor.maxValues[1]);
+    if (jobs.empty())
+    {
+        ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Failed to initialize RHI Mesh from file: %s", fileName.c_str());
+        return false;
+    }
 
-                        const i32 componentSize = GetComponentSizeInBytes(accessor.componentType);
-                        const i32 stride        = componentSize * 2;
+    // Every primitive gets its own preallocated slot, the output order follows the nodes whatever the scheduling.
+    const sizet firstPrimitive = output.primitives.size();
+    output.primitives.resize(firstPrimitive + jobs.size());
 
-                        const f32 upper = static_cast<f32>(accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT
-                                                               ? std::numeric_limits<u16>::max()
-                                                               : std::numeric_limits<u8>::max());
+    Vector<u8>                    extracted(jobs.size(), 0);
+    Vector<VertexCacheStatistics> statisticsBefore(jobs.size());
+    Vector<VertexCacheStatistics> statisticsAfter(jobs.size());
 
-                        const f32 lower = 0.f;
+    ThreadPool::GetWorkerPool().ParallelFor(jobs.size(),
+                                            [&](sizet index)
+                                            {
+                                                const Primitive& primitive    = *jobs[index].primitive;
+                                                RHIPrimitive&    newPrimitive = output.primitives[firstPrimitive + index];
 
-                        for (i32 index = 0; index < accessor.count; ++index)
-                        {
-                            f32 x = static_cast<float>(*src);
-                            f32 y = static_cast<float>(*(src + componentSize));
+                                                newPrimitive.matrix = jobs[index].matrix;
 
-                            newPrimitive.uv[index] =
-                                glm::vec2 {Math::MapRange(x, lower, upper, minX, maxX), Math::MapRange(y, lower, upper, minY, maxY)};
+                                                if (primitive.material >= 0 && primitive.material < model.materials.size())
+                                                {
+                                                    newPrimitive.materialAttributes = *materials[primitive.material];
+                                                }
 
-                            src += stride;
-                        }
-                    }
-                }
+                                                extracted[index] = ExtractPrimitive(model, buffers, primitive, newPrimitive);
 
-                if (auto colorAttribute = primitive.attributes.find("COLOR_0"); colorAttribute != primitive.attributes.end())
-                {
-                    const Accessor& accessor = model.accessors[colorAttribute->second];
-
-                    if (accessor.componentType == TINYGLTF_COMPONENT_TYPE_FLOAT)
-                    {
-                        if (accessor.type == TINYGLTF_TYPE_VEC3)
-                        {
-                            const glm::vec3* src = AccessBuffer<glm::vec3>(model, accessor);
-
-                            newPrimitive.color.resize(accessor.count);
-
-                            for (i32 index = 0; index < accessor.count; ++index, ++src)
-                            {
-                                newPrimitive.color[index] = glm::vec4(*src, 1.f);
-                            }
-                        }
-                        else if (accessor.type == TINYGLTF_TYPE_VEC4)
-                        {
-                            const glm::vec4* src = AccessBuffer<glm::vec4>(model, accessor);
-
-                            newPrimitive.color.assign(src, src + accessor.count);
-                        }
-                    }
-                    else
-                    {
-                        const bool isVec4 = accessor.type == TINYGLTF_TYPE_VEC4;
-
-                        const u8* src = AccessBuffer<u8>(model, accessor);
-
-                        const f32 minR = static_cast<f32>(accessor.minValues[0]);
-                        const f32 minG = static_cast<f32>(accessor.minValues[1]);
-                        const f32 minB = static_cast<f32>(accessor.minValues[2]);
-                        const f32 minA = isVec4 ? static_cast<f32>(accessor.minValues[3]) : 0.f;
-
-                        const f32 maxR = static_cast<f32>(accessor.maxValues[0]);
-                        const f32 maxG = static_cast<f32>(accessor.maxValues[1]);
-                        const f32 maxB = static_cast<f32>(accessor.maxValues[2]);
-                        const f32 maxA = isVec4 ? static_cast<f32>(accessor.maxValues[3]) : 1.f;
-
-                        const i32 componentSize = GetComponentSizeInBytes(accessor.componentType);
-                        const i32 stride        = componentSize * (isVec4 ? 4 : 3);
-
-                        const f32 upper = static_cast<f32>(accessor.componentType == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT
-                                                               ? std::numeric_limits<u16>::max()
-                                                               : std::numeric_limits<u8>::max());
-
-                        const f32 lower = 0.f;
-
-                        for (i32 index = 0; index < accessor.count; ++index)
-                        {
-                            f32 r = static_cast<float>(*src);
-                            f32 g = static_cast<float>(*(src + componentSize));
-                            f32 b = static_cast<float>(*(src + componentSize * 2));
-                            f32 a = isVec4 ? static_cast<float>(*(src + componentSize * 3)) : upper;
-
-                            newPrimitive.color[index] = glm::vec4 {Math::MapRange(r, lower, upper, minR, maxR),
-                                                                   Math::MapRange(g, lower, upper, minG, maxG),
-                                                                   Math::MapRange(b, lower, upper, minB, maxB),
-                                                                   Math::MapRange(a, lower, upper, minA, maxA)};
-
-                            src += stride;
-                        }
-                    }
-                }
+                                                if (extracted[index])
+                                                {
+                                                    MeshOptimizer::Optimize(newPrimitive,
+                                                                            &statisticsBefore[index],
+                                                                            &statisticsAfter[index]);
+                                                    MeshSimplifier::GenerateLODs(newPrimitive);
+                                                }
+                                            });
 
-                if (primitive.indices >= 0)
-                {
-                    const Accessor& indicesAccessor = model.accessors[primitive.indices];
+    if (std::find(extracted.begin(), extracted.end(), 0) != extracted.end())
+    {
+        ZN_LOG(LogMeshImporter,
+               ELogVerbosity::Error,
+               "Unable to read the POSITION attribute or the indices of a mesh in file %s",
+               fileName.c_str());
+        return false;
+    }
 
-                    if (indicesAccessor.type == TINYGLTF_TYPE_SCALAR)
-                    {
-                        newPrimitive.indices.resize(indicesAccessor.count);
+    VertexCacheStatistics before;
+    VertexCacheStatistics after;
 
-                        u32 componentSize = GetComponentSizeInBytes(indicesAccessor.componentType);
+    for (sizet index = 0; index < jobs.size(); ++index)
+    {
+        before += statisticsBefore[index];
+        after += statisticsAfter[index];
+    }
 
-                        const u8* src = AccessBuffer<u8>(model, indicesAccessor);
+    ZN_LOG(LogMeshImporter,
+           ELogVerbosity::Log,
+           "Optimized %llu triangles from %s, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+           after.numTriangles,
+           fileName.c_str(),
+           before.GetACMR(),
+           after.GetACMR(),
+           before.GetATVR(),
+           after.GetATVR());
+
+    return true;
+}
 
-                        for (i32 index = 0; index < indicesAccessor.count; ++index)
-                        {
-                            newPrimitive.indices[index] = FetchIndex(src, indicesAccessor.componentType);
+bool Zn::MeshImporter::GetBufferUris_GLTF(const MappedFile& source, Vector<String>& outUris)
+{
+    ZN_TRACE_QUICKSCOPE();
 
-                            src += componentSize;
-                        }
-                    }
-                }
+    const std::span<const u8> json = IsGLB(source.GetView()) ? FindGLBChunk(source.GetView(), kGLBJsonChunkType) : source.GetView();
 
-                if (primitive.material >= 0 && primitive.material < model.materials.size())
-                {
-                    const tinygltf::Material& material = model.materials[primitive.material];
-
-                    MaterialAttributes& materialAttributes = newPrimitive.materialAttributes;
-
-                    materialAttributes.baseColor =
-                        *reinterpret_cast<const glm::dvec4*>(material.pbrMetallicRoughness.baseColorFactor.data());
-                    materialAttributes.metalness   = material.pbrMetallicRoughness.metallicFactor;
-                    materialAttributes.roughness   = material.pbrMetallicRoughness.roughnessFactor;
-                    materialAttributes.emissive    = *reinterpret_cast<const glm::dvec3*>(material.emissiveFactor.data());
-                    materialAttributes.occlusion   = material.occlusionTexture.strength;
-                    materialAttributes.alphaCutoff = material.alphaCutoff;
-                    materialAttributes.doubleSided = material.doubleSided;
-                    materialAttributes.alphaMode   = TranslateAlphaMode(material.alphaMode);
-
-                    // TODO: ResourceHandle should only be the pointer to the GPU resource. Using it here so that we know what to
-                    // associate.
-                    AssignTexture(material.pbrMetallicRoughness.baseColorTexture.index, model, output, materialAttributes.baseColorTexture);
-                    AssignTexture(
-                        material.pbrMetallicRoughness.metallicRoughnessTexture.index, model, output, materialAttributes.metalnessTexture);
-                    AssignTexture(material.normalTexture.index, model, output, materialAttributes.normalTexture);
-                    AssignTexture(material.occlusionTexture.index, model, output, materialAttributes.occlusionTexture);
-                    AssignTexture(material.emissiveTexture.index, model, output, materialAttributes.emissiveTexture);
-                }
-            }
-        }
-    }
+    // Only the buffers are needed, skip the loader: it would read every buffer and decode every image.
+    const nlohmann::json document = nlohmann::json::parse(json.begin(), json.end(), nullptr, false);
 
-    if (output.primitives.size() == 0)
+    if (document.is_discarded() || !document.is_object())
     {
-        ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Failed to initialize RHI Mesh from file: %s", fileName.c_str());
         return false;
     }
-    else
+
+    outUris.clear();
+
+    const auto buffers = document.find("buffers");
+
+    if (buffers == document.end() || !buffers->is_array())
     {
         return true;
     }
+
+    for (const nlohmann::json& buffer : *buffers)
+    {
+        const auto uri = buffer.find("uri");
+
+        if (uri == buffer.end() || !uri->is_string())
+        {
+            continue;
+        }
+
+        const String& encodedUri = uri->get_ref<const String&>();
+
+        if (encodedUri.starts_with("data:"))
+        {
+            continue;
+        }
+
+        // Same decoding the loader applies before opening the file.
+        String decodedUri;
+        tinygltf::URIDecode(encodedUri, &decodedUri, nullptr);
+
+        outUris.push_back(std::move(decodedUri));
+    }
+
+    return true;
 }
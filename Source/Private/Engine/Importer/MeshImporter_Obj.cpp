@@ -1,71 +1,62 @@
 #include <Znpch.h>
 #include <Engine/Importer/MeshImporter.h>
-#include <Core/Containers/Map.h>
+#include <Engine/Importer/ObjParser.h>
+#include <Core/Containers/FlatMap.h>
+#include <Core/IO/IO.h>
 #include <Rendering/RHI/RHIMesh.h>
 
-#define TINYOBJLOADER_IMPLEMENTATION
-#include <tiny_obj_loader.h>
-
 bool Zn::MeshImporter::Import_Obj(const String& fileName, RHIMesh& mesh)
 {
     ZN_TRACE_QUICKSCOPE();
 
-    // https://vkguide.dev/docs/chapter-3/obj_loading/
-
-    tinyobj::ObjReaderConfig readerConfig {};
-    readerConfig.mtl_search_path = "./";
+    const MappedFile file = IO::MapFile(fileName);
 
-    tinyobj::ObjReader reader;
-    if (!reader.ParseFromFile(fileName, readerConfig))
+    if (!file)
     {
-        if (!reader.Error().empty())
-        {
-            ZN_LOG(LogMeshImporter, ELogVerbosity::Error, reader.Error().c_str());
-        }
+        ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Failed to open OBJ %s", fileName.c_str());
         return false;
     }
 
-    if (!reader.Warning().empty())
+    ObjData data;
+
+    if (!ObjParser::Parse({reinterpret_cast<const char*>(file.GetData()), file.GetSize()}, data))
     {
-        ZN_LOG(LogMeshImporter, ELogVerbosity::Warning, reader.Warning().c_str());
+        ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Failed to parse OBJ %s", fileName.c_str());
+        return false;
     }
 
-    const tinyobj::attrib_t&                attrib    = reader.GetAttrib();
-    const std::vector<tinyobj::shape_t>&    shapes    = reader.GetShapes();
-    const std::vector<tinyobj::material_t>& materials = reader.GetMaterials();
+    // Corners sharing the same position, texcoord and normal indices are the same vertex, no need to compare the attributes.
+    FlatMap<ObjIndex, u32, ObjIndexHash> vertexIndices;
+    vertexIndices.reserve(data.positions.size());
 
-    // Hardcoding triangle loading
-    // If you use this code with a model that hasnt been triangulated, you will have issues.
-    static constexpr i32 kNumVertices = 3;
+    mesh.vertices.reserve(mesh.vertices.size() + data.positions.size());
+    mesh.indices.reserve(mesh.indices.size() + data.corners.size());
 
-    UnorderedMap<u64, sizet> computedVertices {};
-
-    for (const tinyobj::shape_t& shape : shapes)
+    for (const ObjIndex& corner : data.corners)
     {
-        mesh.vertices.reserve(mesh.vertices.size() + shape.mesh.indices.size());
+        const auto [it, bInserted] = vertexIndices.try_emplace(corner, static_cast<u32>(mesh.vertices.size()));
 
-        for (const tinyobj::index_t& index : shape.mesh.indices)
+        if (bInserted)
         {
-            RHIVertex vertex {
-                .position = glm::vec3(
-                    attrib.vertices[kNumVertices * index.vertex_index + 0], attrib.vertices[kNumVertices * index.vertex_index + 1],
-                    attrib.vertices[kNumVertices * index.vertex_index + 2]),
-                .normal = glm::vec3(
-                    attrib.normals[kNumVertices * index.normal_index + 0], attrib.normals[kNumVertices * index.normal_index + 1],
-                    attrib.normals[kNumVertices * index.normal_index + 2]),
-                .uv = glm::vec2 {attrib.texcoords[2 * index.texcoord_index + 0], 1.f - attrib.texcoords[2 * index.texcoord_index + 1]}};
+            RHIVertex& vertex = mesh.vertices.emplace_back();
 
-            // TODO: Setting vertex color as vertex normal (display purposes)
-            vertex.color = vertex.normal;
+            vertex.position = data.positions[corner.position];
+
+            if (corner.normal != ObjIndex::kNone)
+            {
+                vertex.normal = data.normals[corner.normal];
+            }
 
-            auto result = computedVertices.insert({HashCalculate(vertex), mesh.vertices.size()});
-            if (result.second)
+            if (corner.texcoord != ObjIndex::kNone)
             {
-                mesh.vertices.emplace_back(std::move(vertex));
+                vertex.uv = glm::vec2(data.texcoords[corner.texcoord].x, 1.f - data.texcoords[corner.texcoord].y);
             }
 
-            mesh.indices.emplace_back(result.first->second);
+            // TODO: Setting vertex color as vertex normal (display purposes)
+            vertex.color = vertex.normal;
         }
+
+        mesh.indices.emplace_back(static_cast<i32>(it->second));
     }
 
     return true;
@@ -0,0 +1,572 @@
+#include <Znpch.h>
+#include <Engine/Importer/MeshOptimizer.h>
+#include <Rendering/RHI/RHIMesh.h>
+#include <Core/Hash.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+using namespace Zn;
+
+namespace
+{
+// Simulated LRU cache of the vertex cache optimization, larger than the FIFO of the statistics so that the ordering doesn't
+// depend on a specific hardware cache size.
+constexpr u32 kOptimizerCacheSize = 32;
+
+constexpr f32 kLastTriangleScore = 0.75f;
+constexpr f32 kCacheDecayPower   = 1.5f;
+constexpr f32 kValenceBoostScale = 2.f;
+constexpr f32 kValenceBoostPower = 0.5f;
+
+f32 ComputeVertexScore(i32 cachePosition, u32 numRemainingTriangles)
+{
+    if (numRemainingTriangles == 0)
+    {
+        return -1.f;
+    }
+
+    f32 score = 0.f;
+
+    if (cachePosition >= 0)
+    {
+        // The vertices of the last triangle get a fixed score, so that the next triangle doesn't always share an edge with it,
+        // which would create long thin strips.
+        score = cachePosition < 3 ? kLastTriangleScore
+                                  : std::pow(1.f - static_cast<f32>(cachePosition - 3) / (kOptimizerCacheSize - 3), kCacheDecayPower);
+    }
+
+    // Favors vertices with few triangles left, so that they are finished off instead of being reloaded later.
+    return score + kValenceBoostScale * std::pow(static_cast<f32>(numRemainingTriangles), -kValenceBoostPower);
+}
+
+// FIFO cache simulation shared by the statistics and the overdraw clustering. Vertices are cached if they were transformed
+// less than kCacheSize misses ago.
+class FIFOCache
+{
+  public:
+    explicit FIFOCache(sizet numVertices)
+        : timestamps(numVertices, 0)
+    {
+    }
+
+    u32 AddTriangle(const u32* triangle)
+    {
+        u32 numMisses = 0;
+
+        for (u32 corner = 0; corner < 3; ++corner)
+        {
+            u32& vertexTimestamp = timestamps[triangle[corner]];
+
+            if (timestamp - vertexTimestamp > VertexCacheStatistics::kCacheSize)
+            {
+                vertexTimestamp = timestamp++;
+                ++numMisses;
+            }
+        }
+
+        return numMisses;
+    }
+
+    void Reset()
+    {
+        timestamp += VertexCacheStatistics::kCacheSize + 1;
+    }
+
+  private:
+    Vector<u32> timestamps;
+    u32         timestamp = VertexCacheStatistics::kCacheSize + 1;
+};
+
+template<typename Function>
+void ForEachStream(RHIPrimitive& primitive, Function&& function)
+{
+    function(primitive.position);
+    function(primitive.normal);
+    function(primitive.tangent);
+    function(primitive.uv);
+    function(primitive.color);
+}
+} // namespace
+
+VertexCacheStatistics& Zn::VertexCacheStatistics::operator+=(const VertexCacheStatistics& other)
+{
+    numTransformedVertices += other.numTransformedVertices;
+    numTriangles += other.numTriangles;
+    numVertices += other.numVertices;
+
+    return *this;
+}
+
+void Zn::MeshOptimizer::Optimize(RHIPrimitive& primitive, VertexCacheStatistics* outBefore, VertexCacheStatistics* outAfter)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    if (primitive.topology != PrimitiveTopology::Triangles || primitive.position.empty())
+    {
+        return;
+    }
+
+    if (primitive.indices.empty())
+    {
+        primitive.indices.resize(primitive.position.size());
+        std::iota(primitive.indices.begin(), primitive.indices.end(), 0);
+    }
+
+    if (primitive.indices.size() % 3 != 0)
+    {
+        return;
+    }
+
+    if (outBefore)
+    {
+        *outBefore = AnalyzeVertexCache(primitive.indices, primitive.position.size());
+    }
+
+    WeldVertices(primitive);
+    OptimizeVertexCache(primitive.indices, primitive.position.size());
+    OptimizeOverdraw(primitive.indices, primitive.position);
+    OptimizeVertexFetch(primitive);
+
+    if (outAfter)
+    {
+        *outAfter = AnalyzeVertexCache(primitive.indices, primitive.position.size());
+    }
+}
+
+void Zn::MeshOptimizer::WeldVertices(RHIPrimitive& primitive)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    const sizet numVertices = primitive.position.size();
+
+    Vector<u64> hashes(numVertices, 0);
+
+    ForEachStream(primitive,
+                  [&](const auto& stream)
+                  {
+                      if (stream.size() != numVertices)
+                      {
+                          check(stream.empty());
+                          return;
+                      }
+
+                      for (sizet vertex = 0; vertex < numVertices; ++vertex)
+                      {
+                          hashes[vertex] = HashBytes(&stream[vertex], sizeof(stream[vertex]), hashes[vertex]);
+                      }
+                  });
+
+    auto AreEqual = [&](u32 first, u32 second)
+    {
+        bool bEqual = true;
+
+        ForEachStream(primitive,
+                      [&](const auto& stream)
+                      {
+                          bEqual = bEqual &&
+                                   (stream.empty() || std::memcmp(&stream[first], &stream[second], sizeof(stream[first])) == 0);
+                      });
+
+        return bEqual;
+    };
+
+    // Identical vertices end up next to each other, with the lowest index first.
+    Vector<u32> order(numVertices);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(),
+              order.end(),
+              [&](u32 first, u32 second)
+              {
+                  return hashes[first] != hashes[second] ? hashes[first] < hashes[second] : first < second;
+              });
+
+    Vector<u32> remap(numVertices);
+
+    for (sizet begin = 0; begin < numVertices;)
+    {
+        sizet end = begin + 1;
+
+        while (end < numVertices && hashes[order[end]] == hashes[order[begin]])
+        {
+            ++end;
+        }
+
+        // Hash collisions between different vertices are rare, every vertex is compared to the distinct ones of its run.
+        for (sizet current = begin; current < end; ++current)
+        {
+            const u32 vertex = order[current];
+
+            remap[vertex] = vertex;
+
+            for (sizet previous = begin; previous < current; ++previous)
+            {
+                const u32 candidate = order[previous];
+
+                if (remap[candidate] == candidate && AreEqual(candidate, vertex))
+                {
+                    remap[vertex] = candidate;
+                    break;
+                }
+            }
+        }
+
+        begin = end;
+    }
+
+    for (u32& index : primitive.indices)
+    {
+        index = remap[index];
+    }
+}
+
+void Zn::MeshOptimizer::OptimizeVertexCache(std::span<u32> indices, sizet numVertices)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    const sizet numTriangles = indices.size() / 3;
+
+    if (numTriangles == 0)
+    {
+        return;
+    }
+
+    // Triangles adjacent to every vertex, the first numRemainingTriangles[vertex] ones are not emitted yet.
+    Vector<u32> numRemainingTriangles(numVertices, 0);
+
+    for (u32 index : indices)
+    {
+        ++numRemainingTriangles[index];
+    }
+
+    Vector<u32> adjacencyOffsets(numVertices + 1, 0);
+
+    for (sizet vertex = 0; vertex < numVertices; ++vertex)
+    {
+        adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + numRemainingTriangles[vertex];
+    }
+
+    Vector<u32> adjacency(indices.size());
+
+    {
+        Vector<u32> nextOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+
+        for (sizet index = 0; index < indices.size(); ++index)
+        {
+            adjacency[nextOffsets[indices[index]]++] = static_cast<u32>(index / 3);
+        }
+    }
+
+    Vector<i32> cachePositions(numVertices, -1);
+    Vector<f32> vertexScores(numVertices);
+
+    for (sizet vertex = 0; vertex < numVertices; ++vertex)
+    {
+        vertexScores[vertex] = ComputeVertexScore(-1, numRemainingTriangles[vertex]);
+    }
+
+    auto ComputeTriangleScore = [&](u32 triangle)
+    {
+        return vertexScores[indices[triangle * 3]] + vertexScores[indices[triangle * 3 + 1]] + vertexScores[indices[triangle * 3 + 2]];
+    };
+
+    Vector<f32> triangleScores(numTriangles);
+    Vector<u8>  emitted(numTriangles, 0);
+
+    u32 bestTriangle = 0;
+
+    for (u32 triangle = 0; triangle < numTriangles; ++triangle)
+    {
+        triangleScores[triangle] = ComputeTriangleScore(triangle);
+
+        if (triangleScores[triangle] > triangleScores[bestTriangle])
+        {
+            bestTriangle = triangle;
+        }
+    }
+
+    Vector<u32> output(indices.size());
+
+    // Most recently used first, with room for the 3 vertices pushed by a triangle before the least recent ones are evicted.
+    u32   cache[kOptimizerCacheSize + 3];
+    sizet cacheSize = 0;
+
+    sizet nextUnemitted = 0;
+
+    for (sizet outputTriangle = 0; outputTriangle < numTriangles; ++outputTriangle)
+    {
+        if (bestTriangle == u32_max)
+        {
+            // No triangle left around the cached vertices, restarts from the next triangle in input order.
+            while (emitted[nextUnemitted])
+            {
+                ++nextUnemitted;
+            }
+
+            bestTriangle = static_cast<u32>(nextUnemitted);
+        }
+
+        const u32* triangle = &indices[bestTriangle * 3];
+
+        std::copy(triangle, triangle + 3, &output[outputTriangle * 3]);
+        emitted[bestTriangle] = 1;
+
+        u32   newCache[kOptimizerCacheSize + 3];
+        sizet newCacheSize = 0;
+
+        for (u32 corner = 0; corner < 3; ++corner)
+        {
+            const u32 vertex = triangle[corner];
+
+            u32* const adjacentTriangles = &adjacency[adjacencyOffsets[vertex]];
+            u32* const last              = adjacentTriangles + --numRemainingTriangles[vertex];
+
+            std::iter_swap(std::find(adjacentTriangles, last, bestTriangle), last);
+
+            // Degenerate triangles reference the same vertex more than once.
+            if (std::find(newCache, newCache + newCacheSize, vertex) == newCache + newCacheSize)
+            {
+                newCache[newCacheSize++] = vertex;
+            }
+        }
+
+        for (sizet entry = 0; entry < cacheSize; ++entry)
+        {
+            if (std::find(triangle, triangle + 3, cache[entry]) == triangle + 3)
+            {
+                newCache[newCacheSize++] = cache[entry];
+            }
+        }
+
+        for (sizet entry = 0; entry < newCacheSize; ++entry)
+        {
+            const u32 vertex = newCache[entry];
+
+            cachePositions[vertex] = entry < kOptimizerCacheSize ? static_cast<i32>(entry) : -1;
+            vertexScores[vertex]   = ComputeVertexScore(cachePositions[vertex], numRemainingTriangles[vertex]);
+        }
+
+        // Only the triangles around the cached vertices changed score, the next one is picked among them.
+        bestTriangle  = u32_max;
+        f32 bestScore = -1.f;
+
+        for (sizet entry = 0; entry < newCacheSize; ++entry)
+        {
+            const u32  vertex            = newCache[entry];
+            const u32* adjacentTriangles = &adjacency[adjacencyOffsets[vertex]];
+
+            for (u32 adjacent = 0; adjacent < numRemainingTriangles[vertex]; ++adjacent)
+            {
+                const u32 candidate = adjacentTriangles[adjacent];
+
+                triangleScores[candidate] = ComputeTriangleScore(candidate);
+
+                if (triangleScores[candidate] > bestScore)
+                {
+                    bestTriangle = candidate;
+                    bestScore    = triangleScores[candidate];
+                }
+            }
+        }
+
+        cacheSize = std::min<sizet>(newCacheSize, kOptimizerCacheSize);
+        std::copy(newCache, newCache + cacheSize, cache);
+    }
+
+    std::copy(output.begin(), output.end(), indices.begin());
+}
+
+void Zn::MeshOptimizer::OptimizeOverdraw(std::span<u32> indices, std::span<const glm::vec3> positions, f32 threshold)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    const sizet numTriangles = indices.size() / 3;
+
+    if (numTriangles < 2)
+    {
+        return;
+    }
+
+    FIFOCache cache(positions.size());
+
+    // A triangle missing all its vertices is where the cache optimizer jumped to another part of the mesh.
+    Vector<u32> hardBoundaries;
+
+    for (u32 triangle = 0; triangle < numTriangles; ++triangle)
+    {
+        if (cache.AddTriangle(&indices[triangle * 3]) == 3 || triangle == 0)
+        {
+            hardBoundaries.push_back(triangle);
+        }
+    }
+
+    hardBoundaries.push_back(static_cast<u32>(numTriangles));
+
+    // Cuts every hard cluster as soon as the triangles since the last cut, starting with a cold cache, are close enough to the
+    // ACMR of the whole cluster.
+    Vector<u32> clusters;
+
+    for (sizet hardCluster = 0; hardCluster + 1 < hardBoundaries.size(); ++hardCluster)
+    {
+        const u32 begin = hardBoundaries[hardCluster];
+        const u32 end   = hardBoundaries[hardCluster + 1];
+
+        u32 numClusterMisses = 0;
+
+        cache.Reset();
+
+        for (u32 triangle = begin; triangle < end; ++triangle)
+        {
+            numClusterMisses += cache.AddTriangle(&indices[triangle * 3]);
+        }
+
+        const f32 maxACMR = threshold * numClusterMisses / (end - begin);
+
+        u32 clusterBegin = begin;
+        u32 numMisses    = 0;
+
+        clusters.push_back(begin);
+        cache.Reset();
+
+        for (u32 triangle = begin; triangle + 1 < end; ++triangle)
+        {
+            numMisses += cache.AddTriangle(&indices[triangle * 3]);
+
+            if (numMisses <= maxACMR * (triangle + 1 - clusterBegin))
+            {
+                clusterBegin = triangle + 1;
+                numMisses    = 0;
+
+                clusters.push_back(clusterBegin);
+                cache.Reset();
+            }
+        }
+    }
+
+    clusters.push_back(static_cast<u32>(numTriangles));
+
+    const sizet numClusters = clusters.size() - 1;
+
+    if (numClusters < 2)
+    {
+        return;
+    }
+
+    glm::vec3 meshCentroid(0.f);
+
+    for (u32 index : indices)
+    {
+        meshCentroid += positions[index];
+    }
+
+    meshCentroid = meshCentroid / static_cast<f32>(indices.size());
+
+    // Clusters facing away from the mesh center are likely to occlude the other ones, and are drawn first.
+    Vector<f32> sortKeys(numClusters);
+
+    for (sizet cluster = 0; cluster < numClusters; ++cluster)
+    {
+        glm::vec3 centroid(0.f);
+        glm::vec3 normal(0.f);
+
+        for (u32 triangle = clusters[cluster]; triangle < clusters[cluster + 1]; ++triangle)
+        {
+            const glm::vec3& a = positions[indices[triangle * 3]];
+            const glm::vec3& b = positions[indices[triangle * 3 + 1]];
+            const glm::vec3& c = positions[indices[triangle * 3 + 2]];
+
+            centroid += a + b + c;
+            normal += glm::cross(b - a, c - a);
+        }
+
+        centroid = centroid / static_cast<f32>((clusters[cluster + 1] - clusters[cluster]) * 3);
+
+        const f32 normalLength = glm::length(normal);
+
+        sortKeys[cluster] = normalLength > 0.f ? glm::dot(centroid - meshCentroid, normal / normalLength) : 0.f;
+    }
+
+    Vector<u32> clusterOrder(numClusters);
+    std::iota(clusterOrder.begin(), clusterOrder.end(), 0);
+    std::stable_sort(clusterOrder.begin(),
+                     clusterOrder.end(),
+                     [&](u32 first, u32 second)
+                     {
+                         return sortKeys[first] > sortKeys[second];
+                     });
+
+    const Vector<u32> source(indices.begin(), indices.end());
+
+    auto output = indices.begin();
+
+    for (u32 cluster : clusterOrder)
+    {
+        output = std::copy(source.begin() + clusters[cluster] * 3, source.begin() + clusters[cluster + 1] * 3, output);
+    }
+}
+
+void Zn::MeshOptimizer::OptimizeVertexFetch(RHIPrimitive& primitive)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    const sizet numVertices = primitive.position.size();
+
+    Vector<u32> remap(numVertices, u32_max);
+    u32         numUsedVertices = 0;
+
+    for (u32& index : primitive.indices)
+    {
+        if (remap[index] == u32_max)
+        {
+            remap[index] = numUsedVertices++;
+        }
+
+        index = remap[index];
+    }
+
+    ForEachStream(primitive,
+                  [&](auto& stream)
+                  {
+                      if (stream.size() != numVertices)
+                      {
+                          check(stream.empty());
+                          return;
+                      }
+
+                      std::remove_reference_t<decltype(stream)> reordered(numUsedVertices);
+
+                      for (sizet vertex = 0; vertex < numVertices; ++vertex)
+                      {
+                          if (remap[vertex] != u32_max)
+                          {
+                              reordered[remap[vertex]] = stream[vertex];
+                          }
+                      }
+
+                      stream = std::move(reordered);
+                  });
+}
+
+VertexCacheStatistics Zn::MeshOptimizer::AnalyzeVertexCache(std::span<const u32> indices, sizet numVertices)
+{
+    VertexCacheStatistics statistics;
+
+    FIFOCache  cache(numVertices);
+    Vector<u8> referenced(numVertices, 0);
+
+    for (sizet triangle = 0; triangle < indices.size() / 3; ++triangle)
+    {
+        statistics.numTransformedVertices += cache.AddTriangle(&indices[triangle * 3]);
+    }
+
+    for (u32 index : indices)
+    {
+        statistics.numVertices += referenced[index] == 0;
+        referenced[index] = 1;
+    }
+
+    statistics.numTriangles = indices.size() / 3;
+
+    return statistics;
+}
@@ -0,0 +1,544 @@
+#include <Znpch.h>
+#include <Engine/Importer/MeshSimplifier.h>
+#include <Engine/Importer/MeshOptimizer.h>
+#include <Rendering/RHI/RHIMesh.h>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+
+using namespace Zn;
+
+namespace
+{
+// Border edges are kept in place by planes orthogonal to their triangle, weighted above the triangle planes.
+constexpr f64 kBorderWeight = 10.0;
+
+// Collapses rotating the normal of a triangle by more than ~75 degrees are rejected, they would fold the surface over itself.
+constexpr f32 kMinNormalCosine = 0.25f;
+
+constexpr f32 kInvalidError = std::numeric_limits<f32>::max();
+
+// Symmetric 4x4 matrix accumulating squared distances to planes, weighted by area.
+struct Quadric
+{
+    f64 a2 = 0.0, b2 = 0.0, c2 = 0.0, d2 = 0.0;
+    f64 ab = 0.0, ac = 0.0, ad = 0.0;
+    f64 bc = 0.0, bd = 0.0, cd = 0.0;
+    f64 weight = 0.0;
+
+    static Quadric FromPlane(const glm::vec3& normal, const glm::vec3& point, f64 weight)
+    {
+        const f64 a = normal.x;
+        const f64 b = normal.y;
+        const f64 c = normal.z;
+        const f64 d = -(a * point.x + b * point.y + c * point.z);
+
+        return Quadric {
+            .a2     = a * a * weight,
+            .b2     = b * b * weight,
+            .c2     = c * c * weight,
+            .d2     = d * d * weight,
+            .ab     = a * b * weight,
+            .ac     = a * c * weight,
+            .ad     = a * d * weight,
+            .bc     = b * c * weight,
+            .bd     = b * d * weight,
+            .cd     = c * d * weight,
+            .weight = weight,
+        };
+    }
+
+    Quadric& operator+=(const Quadric& other)
+    {
+        a2 += other.a2;
+        b2 += other.b2;
+        c2 += other.c2;
+        d2 += other.d2;
+        ab += other.ab;
+        ac += other.ac;
+        ad += other.ad;
+        bc += other.bc;
+        bd += other.bd;
+        cd += other.cd;
+        weight += other.weight;
+
+        return *this;
+    }
+
+    // Weighted mean of the squared distances of point to the planes.
+    f64 Evaluate(const glm::vec3& point) const
+    {
+        const f64 x = point.x;
+        const f64 y = point.y;
+        const f64 z = point.z;
+
+        const f64 error =
+            a2 * x * x + b2 * y * y + c2 * z * z + d2 + 2.0 * (ab * x * y + ac * x * z + bc * y * z + ad * x + bd * y + cd * z);
+
+        return weight > 0.0 ? std::abs(error) / weight : 0.0;
+    }
+};
+
+enum class VertexKind : u8
+{
+    Manifold,
+    Border,
+    Locked
+};
+
+struct Collapse
+{
+    u32 from;
+    u32 to;
+    f32 error;
+};
+
+u64 MakeEdgeKey(u32 first, u32 second)
+{
+    return first < second ? (static_cast<u64>(first) << 32) | second : (static_cast<u64>(second) << 32) | first;
+}
+
+// Largest side of the bounding box, positions are scaled by its inverse so that errors don't depend on the mesh size.
+f32 ComputeExtent(std::span<const glm::vec3> positions)
+{
+    if (positions.empty())
+    {
+        return 0.f;
+    }
+
+    glm::vec3 min = positions[0];
+    glm::vec3 max = positions[0];
+
+    for (const glm::vec3& position : positions)
+    {
+        min = glm::min(min, position);
+        max = glm::max(max, position);
+    }
+
+    return std::max(max.x - min.x, std::max(max.y - min.y, max.z - min.z));
+}
+
+glm::vec3 ComputeNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+{
+    return glm::cross(b - a, c - a);
+}
+} // namespace
+
+void Zn::MeshSimplifier::GenerateLODs(RHIPrimitive& primitive)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    primitive.lods.clear();
+    primitive.lodIndices.clear();
+
+    if (primitive.topology != PrimitiveTopology::Triangles || primitive.indices.empty())
+    {
+        return;
+    }
+
+    const f32 extent = ComputeExtent(primitive.position);
+
+    Vector<u32> previous = primitive.indices;
+    f32         error    = 0.f;
+
+    for (u32 level = 0; level < kMaxLODs; ++level)
+    {
+        const sizet targetNumIndices = previous.size() / 6 * 3;
+
+        f32         levelError = 0.f;
+        Vector<u32> lod        = Simplify(previous, primitive.position, targetNumIndices, kMaxLODError - error, &levelError);
+
+        if (lod.empty() || lod.size() * 4 > previous.size() * 3)
+        {
+            break;
+        }
+
+        MeshOptimizer::OptimizeVertexCache(lod, primitive.position.size());
+
+        // Every level is simplified from the previous one, the errors add up.
+        error += levelError;
+
+        primitive.lods.push_back(RHIPrimitiveLOD {
+            .firstIndex = static_cast<u32>(primitive.lodIndices.size()),
+            .numIndices = static_cast<u32>(lod.size()),
+            .error      = error * extent,
+        });
+
+        primitive.lodIndices.insert(primitive.lodIndices.end(), lod.begin(), lod.end());
+
+        previous = std::move(lod);
+    }
+}
+
+Vector<u32> Zn::MeshSimplifier::Simplify(std::span<const u32>       indices,
+                                         std::span<const glm::vec3> positions_,
+                                         sizet                      targetNumIndices,
+                                         f32                        maxError,
+                                         f32*                       outError)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    check(indices.size() % 3 == 0);
+
+    const sizet numVertices = positions_.size();
+    const f32   extent      = ComputeExtent(positions_);
+
+    Vector<u32> result(indices.begin(), indices.end());
+
+    if (outError)
+    {
+        *outError = 0.f;
+    }
+
+    if (extent <= 0.f || result.size() <= targetNumIndices)
+    {
+        return result;
+    }
+
+    Vector<glm::vec3> positions(numVertices);
+
+    for (sizet vertex = 0; vertex < numVertices; ++vertex)
+    {
+        positions[vertex] = positions_[vertex] / extent;
+    }
+
+    // Vertices sharing a position with different attributes are seams, edges are identified by their canonical vertices so
+    // that the triangles on both sides of a seam are connected.
+    Vector<u32> canonical(numVertices);
+    Vector<u8>  locked(numVertices, 0);
+
+    {
+        Vector<u32> order(numVertices);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(),
+                  order.end(),
+                  [&](u32 first, u32 second)
+                  {
+                      const glm::vec3& a = positions_[first];
+                      const glm::vec3& b = positions_[second];
+
+                      return std::tie(a.x, a.y, a.z, first) < std::tie(b.x, b.y, b.z, second);
+                  });
+
+        for (sizet begin = 0; begin < numVertices;)
+        {
+            sizet end = begin + 1;
+
+            while (end < numVertices && positions_[order[end]] == positions_[order[begin]])
+            {
+                ++end;
+            }
+
+            for (sizet current = begin; current < end; ++current)
+            {
+                canonical[order[current]] = order[begin];
+                locked[order[current]]    = end - begin > 1;
+            }
+
+            begin = end;
+        }
+    }
+
+    Vector<Quadric> quadrics(numVertices);
+    Vector<u64>     edges;
+    Vector<u64>     borderEdges;
+    Vector<u8>      vertexKinds(numVertices);
+
+    // Sorted canonical edges of the current triangles, those used once are borders and those used more than twice are not
+    // manifold, their vertices are locked.
+    auto ClassifyEdges = [&]()
+    {
+        edges.clear();
+        borderEdges.clear();
+
+        for (sizet index = 0; index < result.size(); ++index)
+        {
+            const sizet next = index % 3 == 2 ? index - 2 : index + 1;
+
+            edges.push_back(MakeEdgeKey(canonical[result[index]], canonical[result[next]]));
+        }
+
+        std::sort(edges.begin(), edges.end());
+
+        for (sizet vertex = 0; vertex < numVertices; ++vertex)
+        {
+            vertexKinds[vertex] = static_cast<u8>(locked[vertex] ? VertexKind::Locked : VertexKind::Manifold);
+        }
+
+        Vector<u8> canonicalKinds(numVertices, static_cast<u8>(VertexKind::Manifold));
+
+        for (sizet begin = 0; begin < edges.size();)
+        {
+            sizet end = begin + 1;
+
+            while (end < edges.size() && edges[end] == edges[begin])
+            {
+                ++end;
+            }
+
+            const u32 first  = static_cast<u32>(edges[begin] >> 32);
+            const u32 second = static_cast<u32>(edges[begin]);
+
+            if (end - begin == 1)
+            {
+                borderEdges.push_back(edges[begin]);
+
+                canonicalKinds[first]  = std::max(canonicalKinds[first], static_cast<u8>(VertexKind::Border));
+                canonicalKinds[second] = std::max(canonicalKinds[second], static_cast<u8>(VertexKind::Border));
+            }
+            else if (end - begin > 2)
+            {
+                canonicalKinds[first]  = static_cast<u8>(VertexKind::Locked);
+                canonicalKinds[second] = static_cast<u8>(VertexKind::Locked);
+            }
+
+            begin = end;
+        }
+
+        for (sizet vertex = 0; vertex < numVertices; ++vertex)
+        {
+            vertexKinds[vertex] = std::max(vertexKinds[vertex], canonicalKinds[canonical[vertex]]);
+        }
+    };
+
+    auto IsBorderEdge = [&](u32 first, u32 second)
+    {
+        return std::binary_search(borderEdges.begin(), borderEdges.end(), MakeEdgeKey(canonical[first], canonical[second]));
+    };
+
+    ClassifyEdges();
+
+    for (sizet triangle = 0; triangle < result.size() / 3; ++triangle)
+    {
+        const u32* corners = &result[triangle * 3];
+
+        const glm::vec3 normal = ComputeNormal(positions[corners[0]], positions[corners[1]], positions[corners[2]]);
+        const f32       area   = glm::length(normal);
+
+        if (area <= 0.f)
+        {
+            continue;
+        }
+
+        const glm::vec3 unitNormal = normal / area;
+
+        for (u32 corner = 0; corner < 3; ++corner)
+        {
+            quadrics[corners[corner]] += Quadric::FromPlane(unitNormal, positions[corners[corner]], area);
+        }
+
+        for (u32 corner = 0; corner < 3; ++corner)
+        {
+            const u32 first  = corners[corner];
+            const u32 second = corners[(corner + 1) % 3];
+
+            if (!IsBorderEdge(first, second))
+            {
+                continue;
+            }
+
+            const glm::vec3 edge       = positions[second] - positions[first];
+            const f32       edgeLength = glm::length(edge);
+
+            if (edgeLength > 0.f)
+            {
+                const glm::vec3 borderNormal = glm::normalize(glm::cross(edge, unitNormal));
+                const Quadric   border       = Quadric::FromPlane(borderNormal, positions[first], kBorderWeight * edgeLength * edgeLength);
+
+                quadrics[first] += border;
+                quadrics[second] += border;
+            }
+        }
+    }
+
+    const f32 maxSquaredError = maxError * maxError;
+    f32       resultError     = 0.f;
+
+    Vector<u32>      remap(numVertices);
+    Vector<u32>      adjacencyOffsets(numVertices + 1);
+    Vector<u32>      adjacency;
+    Vector<Collapse> collapses;
+    Vector<u8>       touched(numVertices);
+
+    auto CanCollapse = [&](u32 from, u32 to)
+    {
+        switch (static_cast<VertexKind>(vertexKinds[from]))
+        {
+        case VertexKind::Manifold:
+            return true;
+        case VertexKind::Border:
+            return IsBorderEdge(from, to);
+        default:
+            return false;
+        }
+    };
+
+    // Moving from onto to must not flip the triangles around from that don't degenerate.
+    auto FlipsTriangles = [&](u32 from, u32 to)
+    {
+        for (u32 adjacent = adjacencyOffsets[from]; adjacent < adjacencyOffsets[from + 1]; ++adjacent)
+        {
+            const u32* corners = &result[adjacency[adjacent] * 3];
+
+            if (std::find(corners, corners + 3, to) != corners + 3)
+            {
+                continue;
+            }
+
+            glm::vec3 moved[3];
+
+            for (u32 corner = 0; corner < 3; ++corner)
+            {
+                moved[corner] = positions[corners[corner] == from ? to : corners[corner]];
+            }
+
+            const glm::vec3 before = ComputeNormal(positions[corners[0]], positions[corners[1]], positions[corners[2]]);
+            const glm::vec3 after  = ComputeNormal(moved[0], moved[1], moved[2]);
+
+            if (glm::dot(before, after) <= kMinNormalCosine * glm::length(before) * glm::length(after))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    while (result.size() > targetNumIndices)
+    {
+        // Triangles around every vertex.
+        std::fill(adjacencyOffsets.begin(), adjacencyOffsets.end(), 0);
+
+        for (u32 index : result)
+        {
+            ++adjacencyOffsets[index + 1];
+        }
+
+        std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+
+        adjacency.resize(result.size());
+
+        {
+            Vector<u32> nextOffsets(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+
+            for (sizet index = 0; index < result.size(); ++index)
+            {
+                adjacency[nextOffsets[result[index]]++] = static_cast<u32>(index / 3);
+            }
+        }
+
+        // Cheapest direction of every edge, the shared ones are evaluated from both triangles and skipped the second time.
+        collapses.clear();
+
+        for (sizet index = 0; index < result.size(); ++index)
+        {
+            const u32 first  = result[index];
+            const u32 second = result[index % 3 == 2 ? index - 2 : index + 1];
+
+            const bool bFirstCollapses  = CanCollapse(first, second);
+            const bool bSecondCollapses = CanCollapse(second, first);
+
+            if (!bFirstCollapses && !bSecondCollapses)
+            {
+                continue;
+            }
+
+            Quadric quadric = quadrics[first];
+            quadric += quadrics[second];
+
+            const f32 firstError  = bFirstCollapses ? static_cast<f32>(quadric.Evaluate(positions[second])) : kInvalidError;
+            const f32 secondError = bSecondCollapses ? static_cast<f32>(quadric.Evaluate(positions[first])) : kInvalidError;
+
+            if (firstError <= secondError && firstError <= maxSquaredError)
+            {
+                collapses.push_back(Collapse {first, second, firstError});
+            }
+            else if (secondError < firstError && secondError <= maxSquaredError)
+            {
+                collapses.push_back(Collapse {second, first, secondError});
+            }
+        }
+
+        std::sort(collapses.begin(),
+                  collapses.end(),
+                  [](const Collapse& first, const Collapse& second)
+                  {
+                      return first.error < second.error;
+                  });
+
+        std::iota(remap.begin(), remap.end(), 0);
+        std::fill(touched.begin(), touched.end(), 0);
+
+        sizet numTriangles       = result.size() / 3;
+        sizet numCollapses       = 0;
+        sizet targetNumTriangles = targetNumIndices / 3;
+
+        for (const Collapse& collapse : collapses)
+        {
+            if (numTriangles <= targetNumTriangles)
+            {
+                break;
+            }
+
+            // The triangles around every collapsed vertex stay as they were at the start of the pass, so that the flip tests
+            // see the current positions.
+            if (touched[collapse.from] || touched[collapse.to] || FlipsTriangles(collapse.from, collapse.to))
+            {
+                continue;
+            }
+
+            remap[collapse.from] = collapse.to;
+            quadrics[collapse.to] += quadrics[collapse.from];
+            resultError = std::max(resultError, collapse.error);
+
+            for (u32 adjacent = adjacencyOffsets[collapse.from]; adjacent < adjacencyOffsets[collapse.from + 1]; ++adjacent)
+            {
+                const u32* corners = &result[adjacency[adjacent] * 3];
+
+                numTriangles -= std::find(corners, corners + 3, collapse.to) != corners + 3;
+
+                for (u32 corner = 0; corner < 3; ++corner)
+                {
+                    touched[corners[corner]] = 1;
+                }
+            }
+
+            touched[collapse.to] = 1;
+
+            ++numCollapses;
+        }
+
+        if (numCollapses == 0)
+        {
+            break;
+        }
+
+        sizet numIndices = 0;
+
+        for (sizet index = 0; index < result.size(); index += 3)
+        {
+            const u32 a = remap[result[index]];
+            const u32 b = remap[result[index + 1]];
+            const u32 c = remap[result[index + 2]];
+
+            if (a != b && b != c && c != a)
+            {
+                result[numIndices++] = a;
+                result[numIndices++] = b;
+                result[numIndices++] = c;
+            }
+        }
+
+        result.resize(numIndices);
+
+        ClassifyEdges();
+    }
+
+    if (outError)
+    {
+        *outError = std::sqrt(resultError);
+    }
+
+    return result;
+}
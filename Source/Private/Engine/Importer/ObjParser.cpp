@@ -0,0 +1,329 @@
+#include <Znpch.h>
+#include <Engine/Importer/ObjParser.h>
+#include <Engine/Importer/MeshImporter.h>
+#include <Core/Async/ThreadPool.h>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <string_view>
+
+using namespace Zn;
+
+namespace
+{
+struct ObjCounts
+{
+    u32 positions = 0;
+    u32 texcoords = 0;
+    u32 normals   = 0;
+};
+
+enum class ObjKeyword : u8
+{
+    Position,
+    Texcoord,
+    Normal,
+    Face,
+    Other
+};
+
+// Lines end with '\n', a '\r' before it is treated as whitespace.
+bool IsSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+const char* SkipSpaces(const char* it, const char* end)
+{
+    while (it != end && IsSpace(*it))
+    {
+        ++it;
+    }
+
+    return it;
+}
+
+const char* FindLineEnd(const char* it, const char* end)
+{
+    const void* lineEnd = memchr(it, '\n', end - it);
+
+    return lineEnd ? static_cast<const char*>(lineEnd) : end;
+}
+
+// Moves it past the keyword at the start of the line.
+ObjKeyword ReadKeyword(const char*& it, const char* lineEnd)
+{
+    it = SkipSpaces(it, lineEnd);
+
+    const char* keywordEnd = it;
+
+    while (keywordEnd != lineEnd && !IsSpace(*keywordEnd))
+    {
+        ++keywordEnd;
+    }
+
+    const std::string_view keyword(it, keywordEnd - it);
+
+    it = keywordEnd;
+
+    if (keyword == "v")
+    {
+        return ObjKeyword::Position;
+    }
+    else if (keyword == "vt")
+    {
+        return ObjKeyword::Texcoord;
+    }
+    else if (keyword == "vn")
+    {
+        return ObjKeyword::Normal;
+    }
+    else if (keyword == "f")
+    {
+        return ObjKeyword::Face;
+    }
+
+    return ObjKeyword::Other;
+}
+
+// std::from_chars is locale independent and doesn't allocate, unlike the stream and strtod based parsers.
+bool ReadFloat(const char*& it, const char* lineEnd, f32& outValue)
+{
+    it = SkipSpaces(it, lineEnd);
+
+    if (it != lineEnd && *it == '+')
+    {
+        ++it;
+    }
+
+    const auto [next, error] = std::from_chars(it, lineEnd, outValue);
+
+    it = next;
+
+    return error == std::errc();
+}
+
+// Positive indices are 1 based, negative ones are relative to the last attribute defined so far.
+bool ReadIndex(const char*& it, const char* lineEnd, u32 numDefined, u32 numTotal, u32& outIndex)
+{
+    i64 value = 0;
+
+    const auto [next, error] = std::from_chars(it, lineEnd, value);
+
+    it = next;
+
+    if (error != std::errc() || value == 0)
+    {
+        return false;
+    }
+
+    const i64 index = value > 0 ? value - 1 : numDefined + value;
+
+    outIndex = static_cast<u32>(index);
+
+    return index >= 0 && index < numTotal;
+}
+
+ObjCounts CountAttributes(const char* begin, const char* end)
+{
+    ObjCounts counts;
+
+    for (const char* it = begin; it != end;)
+    {
+        const char* lineEnd = FindLineEnd(it, end);
+
+        switch (ReadKeyword(it, lineEnd))
+        {
+        case ObjKeyword::Position:
+            ++counts.positions;
+            break;
+        case ObjKeyword::Texcoord:
+            ++counts.texcoords;
+            break;
+        case ObjKeyword::Normal:
+            ++counts.normals;
+            break;
+        default:
+            break;
+        }
+
+        it = lineEnd == end ? end : lineEnd + 1;
+    }
+
+    return counts;
+}
+
+// Attributes are written from the first ones of the chunk, found by the counting pass.
+bool ParseChunk(const char* begin, const char* end, const ObjCounts& first, ObjData& data, Vector<ObjIndex>& outCorners)
+{
+    ObjCounts defined = first;
+
+    const ObjCounts total {
+        .positions = static_cast<u32>(data.positions.size()),
+        .texcoords = static_cast<u32>(data.texcoords.size()),
+        .normals   = static_cast<u32>(data.normals.size()),
+    };
+
+    for (const char* it = begin; it != end;)
+    {
+        const char* lineBegin = it;
+        const char* lineEnd   = FindLineEnd(it, end);
+
+        bool bValid = true;
+
+        switch (ReadKeyword(it, lineEnd))
+        {
+        case ObjKeyword::Position:
+        {
+            glm::vec3& position = data.positions[defined.positions++];
+            bValid = ReadFloat(it, lineEnd, position.x) && ReadFloat(it, lineEnd, position.y) && ReadFloat(it, lineEnd, position.z);
+            break;
+        }
+        case ObjKeyword::Texcoord:
+        {
+            glm::vec2& texcoord = data.texcoords[defined.texcoords++];
+            bValid              = ReadFloat(it, lineEnd, texcoord.x) && ReadFloat(it, lineEnd, texcoord.y);
+            break;
+        }
+        case ObjKeyword::Normal:
+        {
+            glm::vec3& normal = data.normals[defined.normals++];
+            bValid            = ReadFloat(it, lineEnd, normal.x) && ReadFloat(it, lineEnd, normal.y) && ReadFloat(it, lineEnd, normal.z);
+            break;
+        }
+        case ObjKeyword::Face:
+        {
+            ObjIndex firstCorner;
+            ObjIndex previousCorner;
+            u32      numCorners = 0;
+
+            for (it = SkipSpaces(it, lineEnd); bValid && it != lineEnd; it = SkipSpaces(it, lineEnd))
+            {
+                // v, v/vt, v//vn or v/vt/vn.
+                ObjIndex corner;
+
+                bValid = ReadIndex(it, lineEnd, defined.positions, total.positions, corner.position);
+
+                if (bValid && it != lineEnd && *it == '/')
+                {
+                    ++it;
+
+                    if (it != lineEnd && *it != '/')
+                    {
+                        bValid = ReadIndex(it, lineEnd, defined.texcoords, total.texcoords, corner.texcoord);
+                    }
+
+                    if (bValid && it != lineEnd && *it == '/')
+                    {
+                        ++it;
+                        bValid = ReadIndex(it, lineEnd, defined.normals, total.normals, corner.normal);
+                    }
+                }
+
+                if (numCorners >= 2)
+                {
+                    outCorners.insert(outCorners.end(), {firstCorner, previousCorner, corner});
+                }
+                else if (numCorners == 0)
+                {
+                    firstCorner = corner;
+                }
+
+                previousCorner = corner;
+                ++numCorners;
+            }
+
+            break;
+        }
+        default:
+            break;
+        }
+
+        if (!bValid)
+        {
+            ZN_LOG(LogMeshImporter, ELogVerbosity::Error, "Invalid OBJ line: %.*s", static_cast<i32>(lineEnd - lineBegin), lineBegin);
+            return false;
+        }
+
+        it = lineEnd == end ? end : lineEnd + 1;
+    }
+
+    return true;
+}
+} // namespace
+
+bool Zn::ObjParser::Parse(std::span<const char> text, ObjData& outData, sizet chunkSize)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    check(chunkSize > 0);
+
+    const char* const textBegin = text.data();
+    const char* const textEnd   = text.data() + text.size();
+
+    // Every chunk starts at the beginning of a line.
+    Vector<const char*> chunkBegins {textBegin};
+
+    while (chunkBegins.back() != textEnd)
+    {
+        const char* chunkEnd = textBegin + std::min<sizet>(text.size(), chunkBegins.back() - textBegin + chunkSize);
+
+        chunkEnd = FindLineEnd(chunkEnd, textEnd);
+        chunkBegins.push_back(chunkEnd == textEnd ? textEnd : chunkEnd + 1);
+    }
+
+    const sizet numChunks = chunkBegins.size() - 1;
+
+    ThreadPool& workerPool = ThreadPool::GetWorkerPool();
+
+    Vector<ObjCounts> chunkCounts(numChunks + 1);
+
+    workerPool.ParallelFor(numChunks,
+                           [&](sizet chunk)
+                           {
+                               chunkCounts[chunk + 1] = CountAttributes(chunkBegins[chunk], chunkBegins[chunk + 1]);
+                           });
+
+    // Turns the counts into the first attribute of every chunk, the last entry being the totals.
+    for (sizet chunk = 1; chunk <= numChunks; ++chunk)
+    {
+        chunkCounts[chunk].positions += chunkCounts[chunk - 1].positions;
+        chunkCounts[chunk].texcoords += chunkCounts[chunk - 1].texcoords;
+        chunkCounts[chunk].normals += chunkCounts[chunk - 1].normals;
+    }
+
+    outData.positions.resize(chunkCounts[numChunks].positions);
+    outData.texcoords.resize(chunkCounts[numChunks].texcoords);
+    outData.normals.resize(chunkCounts[numChunks].normals);
+
+    Vector<Vector<ObjIndex>> chunkCorners(numChunks);
+    Vector<u8>               parsed(numChunks, 0);
+
+    workerPool.ParallelFor(numChunks,
+                           [&](sizet chunk)
+                           {
+                               parsed[chunk] =
+                                   ParseChunk(chunkBegins[chunk], chunkBegins[chunk + 1], chunkCounts[chunk], outData, chunkCorners[chunk]);
+                           });
+
+    if (std::find(parsed.begin(), parsed.end(), 0) != parsed.end())
+    {
+        return false;
+    }
+
+    sizet numCorners = 0;
+
+    for (const Vector<ObjIndex>& corners : chunkCorners)
+    {
+        numCorners += corners.size();
+    }
+
+    outData.corners.reserve(numCorners);
+
+    for (const Vector<ObjIndex>& corners : chunkCorners)
+    {
+        outData.corners.insert(outData.corners.end(), corners.begin(), corners.end());
+    }
+
+    return true;
+}
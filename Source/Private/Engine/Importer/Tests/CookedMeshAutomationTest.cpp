@@ -0,0 +1,157 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/CookedMesh.h"
+#include "Engine/Importer/MeshImporter.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace Zn::Automation
+{
+// Cooks a synthetic import output, loads it back and compares every stream, material and texture.
+class CookedMeshAutomationTest : public AutomationTest
+{
+  public:
+    CookedMeshAutomationTest(u32 numPrimitives_, u32 numVertices_)
+        : numPrimitives(numPrimitives_)
+        , numVertices(numVertices_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        directory = std::filesystem::temp_directory_path() / "ZnCookedMeshAutomationTest";
+        std::filesystem::create_directories(directory);
+
+        MaterialAttributes materials[2];
+        materials[0].baseColor = glm::vec4(1.f, 0.f, 0.f, 1.f);
+        materials[1].roughness = 0.5f;
+        materials[1].alphaMode = AlphaMode::Mask;
+
+        for (u32 primitiveIndex = 0; primitiveIndex < numPrimitives; ++primitiveIndex)
+        {
+            RHIPrimitive& primitive = output.primitives.emplace_back(RHIPrimitive {});
+
+            primitive.matrix             = glm::mat4(static_cast<f32>(primitiveIndex + 1));
+            primitive.topology           = PrimitiveTopology::Triangles;
+            primitive.materialAttributes = materials[primitiveIndex % 2];
+
+            for (u32 vertex = 0; vertex < numVertices; ++vertex)
+            {
+                const f32 value = static_cast<f32>(vertex + primitiveIndex);
+
+                primitive.position.push_back(glm::vec3(value, value * 2.f, value * 3.f));
+                primitive.normal.push_back(glm::vec3(0.f, 1.f, value));
+                primitive.uv.push_back(glm::vec2(value, -value));
+                primitive.indices.push_back(numVertices - vertex - 1);
+            }
+
+            // Leave one primitive without tangents nor levels of detail, empty streams have to survive the round trip too.
+            if (primitiveIndex > 0)
+            {
+                primitive.tangent.assign(numVertices, glm::vec4(1.f, 0.f, 0.f, 1.f));
+
+                primitive.lodIndices.assign(primitive.indices.begin(), primitive.indices.begin() + numVertices / 2);
+                primitive.lods.push_back(RHIPrimitiveLOD {.firstIndex = 0, .numIndices = numVertices / 2, .error = 0.5f});
+                primitive.lods.push_back(RHIPrimitiveLOD {.firstIndex = 0, .numIndices = numVertices / 4, .error = 1.f});
+            }
+        }
+
+        output.textures.insert({"textures/albedo.png", nullptr});
+        output.samplers.insert({"textures/albedo.png", TextureSampler {.minification = SamplerFilter::Nearest}});
+        output.textureSettings.insert(
+            {"textures/albedo.png", TextureImportSettings {.alphaCutoff = 0.25f, .bSRGB = true, .bPreserveAlphaCoverage = true}});
+
+        cookedPath = (directory / "mesh.znmesh").string();
+    }
+
+    virtual void Execute() override
+    {
+        Vector<u8> cookedBlob;
+        bool       bMatches = CookedMesh::Cook(output, cookedBlob);
+
+        {
+            std::ofstream file(cookedPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(cookedBlob.data()), cookedBlob.size());
+        }
+
+        {
+            CookedMesh cookedMesh;
+            bMatches &= CookedMesh::Load(cookedPath, cookedMesh);
+
+            const Vector<RHIPrimitiveView>& primitives = cookedMesh.GetPrimitives();
+            bMatches &= primitives.size() == output.primitives.size();
+
+            for (sizet index = 0; bMatches && index < primitives.size(); ++index)
+            {
+                const RHIPrimitive&     source = output.primitives[index];
+                const RHIPrimitiveView& cooked = primitives[index];
+
+                bMatches &= cooked.matrix == source.matrix && cooked.topology == source.topology &&
+                            cooked.materialAttributes == source.materialAttributes;
+                bMatches &= std::ranges::equal(cooked.position, source.position) && std::ranges::equal(cooked.normal, source.normal) &&
+                            std::ranges::equal(cooked.tangent, source.tangent) && std::ranges::equal(cooked.uv, source.uv) &&
+                            std::ranges::equal(cooked.color, source.color) && std::ranges::equal(cooked.indices, source.indices);
+                bMatches &= std::ranges::equal(cooked.lods, source.lods) && std::ranges::equal(cooked.lodIndices, source.lodIndices);
+
+                bMatches &= reinterpret_cast<uintptr_t>(cooked.position.data()) % CookedMesh::kStreamAlignment == 0;
+            }
+
+            const Vector<CookedMeshTexture>& textures = cookedMesh.GetTextures();
+            bMatches &= textures.size() == 1 && textures[0].uri == "textures/albedo.png" &&
+                        textures[0].sampler.minification == SamplerFilter::Nearest &&
+                        textures[0].settings == output.textureSettings.at("textures/albedo.png");
+        }
+
+        {
+            // A truncated blob must be rejected instead of handing out spans past the end of the file.
+            std::filesystem::resize_file(cookedPath, std::filesystem::file_size(cookedPath) / 2);
+
+            CookedMesh cookedMesh;
+            bMatches &= !CookedMesh::Load(cookedPath, cookedMesh) && cookedMesh.GetPrimitives().empty();
+        }
+
+        {
+            // Indices past the last vertex would make the GPU read outside of the vertex buffer.
+            MeshImporterOutput outOfRange = output;
+            outOfRange.primitives.back().indices.back() = numVertices;
+
+            bMatches &= CookedMesh::Cook(outOfRange, cookedBlob);
+
+            {
+                std::ofstream file(cookedPath, std::ios::binary | std::ios::trunc);
+                file.write(reinterpret_cast<const char*>(cookedBlob.data()), cookedBlob.size());
+            }
+
+            CookedMesh cookedMesh;
+            bMatches &= !CookedMesh::Load(cookedPath, cookedMesh) && cookedMesh.GetPrimitives().empty();
+        }
+
+        {
+            MeshImporterOutput embedded;
+            embedded.textures.insert({"", nullptr});
+
+            bMatches &= !CookedMesh::Cook(embedded, cookedBlob);
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+  private:
+    u32 numPrimitives = 0;
+    u32 numVertices   = 0;
+
+    std::filesystem::path directory;
+    String                cookedPath;
+    MeshImporterOutput    output;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(CookedMeshAutomationTest, Zn::Automation::CookedMeshAutomationTest, 4, 1024);
@@ -0,0 +1,185 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/MeshImporter.h"
+#include "Engine/Importer/TextureImporter.h"
+#include "Rendering/RHI/RHIMesh.h"
+#include "Core/Memory/Memory.h"
+#include <filesystem>
+#include <fstream>
+
+namespace Zn::Automation
+{
+// Writes a single triangle .glb, below a parent node, with positions and normals interleaved in one buffer view, normalized u16 uvs
+// and u16 indices, then imports it back. The same triangle is written as a .gltf with its buffer in a .bin file. The base color is a
+// 1x1 TGA stored in a buffer view, the normal map is a missing file and is left out of the textures.
+class GLTFImporterAutomationTest : public AutomationTest
+{
+  public:
+    virtual void Prepare() override
+    {
+        directory = std::filesystem::temp_directory_path() / "ZnGLTFImporterAutomationTest";
+        std::filesystem::create_directories(directory);
+
+        static_assert(sizeof(positions) + sizeof(normals) + sizeof(uvs) + sizeof(indices) + sizeof(image) == 112);
+
+        Vector<u8> binary;
+
+        for (sizet index = 0; index < 3; ++index)
+        {
+            Append(binary, &positions[index], sizeof(glm::vec3));
+            Append(binary, &normals[index], sizeof(glm::vec3));
+        }
+
+        Append(binary, uvs, sizeof(uvs));
+        Append(binary, indices, sizeof(indices));
+        Append(binary, image, sizeof(image));
+
+        const String json = R"({
+            "asset": {"version": "2.0"},
+            "scene": 0,
+            "scenes": [{"nodes": [0]}],
+            "nodes": [{"translation": [1, 2, 3], "children": [1]}, {"scale": [2, 2, 2], "mesh": 0}],
+            "meshes": [{"primitives": [{"attributes": {"POSITION": 0, "NORMAL": 3, "TEXCOORD_0": 1}, "indices": 2, "material": 0}]}],
+            "materials": [{"pbrMetallicRoughness": {"baseColorTexture": {"index": 0}}, "normalTexture": {"index": 1}}],
+            "textures": [{"source": 0}, {"source": 1}],
+            "images": [{"bufferView": 3, "mimeType": "image/x-tga"}, {"uri": "Missing.png"}],
+            "buffers": [{"byteLength": 112 BUFFER_URI}],
+            "bufferViews": [
+                {"buffer": 0, "byteOffset": 0, "byteLength": 72, "byteStride": 24},
+                {"buffer": 0, "byteOffset": 72, "byteLength": 12},
+                {"buffer": 0, "byteOffset": 84, "byteLength": 6},
+                {"buffer": 0, "byteOffset": 90, "byteLength": 22}
+            ],
+            "accessors": [
+                {"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3", "min": [0, 0, 0], "max": [1, 1, 0]},
+                {"bufferView": 1, "componentType": 5123, "normalized": true, "count": 3, "type": "VEC2"},
+                {"bufferView": 2, "componentType": 5123, "count": 3, "type": "SCALAR"},
+                {"bufferView": 0, "byteOffset": 12, "componentType": 5126, "count": 3, "type": "VEC3"}
+            ]
+        })";
+
+        {
+            const String gltfJson = ReplaceBufferUri(json, R"(, "uri": "Triangle.bin")");
+
+            std::ofstream gltfFile(GetFileName(".gltf"), std::ios::binary | std::ios::trunc);
+            gltfFile.write(gltfJson.data(), gltfJson.size());
+
+            std::ofstream binaryFile(directory / "Triangle.bin", std::ios::binary | std::ios::trunc);
+            binaryFile.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+        }
+
+        const String glbJson = ReplaceBufferUri(json, "");
+
+        // Chunks are 4 bytes aligned, the JSON is padded with spaces and the binary with zeros.
+        Vector<u8> jsonChunk(glbJson.begin(), glbJson.end());
+        jsonChunk.resize(Memory::Align(jsonChunk.size(), 4), ' ');
+        binary.resize(Memory::Align(binary.size(), 4), 0);
+
+        const u32 header[3]            = {0x46546C67, 2, static_cast<u32>(12 + 8 + jsonChunk.size() + 8 + binary.size())};
+        const u32 jsonChunkHeader[2]   = {static_cast<u32>(jsonChunk.size()), 0x4E4F534A};
+        const u32 binaryChunkHeader[2] = {static_cast<u32>(binary.size()), 0x004E4942};
+
+        std::ofstream file(GetFileName(".glb"), std::ios::binary | std::ios::trunc);
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(jsonChunkHeader), sizeof(jsonChunkHeader));
+        file.write(reinterpret_cast<const char*>(jsonChunk.data()), jsonChunk.size());
+        file.write(reinterpret_cast<const char*>(binaryChunkHeader), sizeof(binaryChunkHeader));
+        file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+    }
+
+    virtual void Execute() override
+    {
+        bool bMatches = true;
+
+        for (cstring extension : {".glb", ".gltf"})
+        {
+            MeshImporterOutput output;
+
+            bMatches &= MeshImporter::ImportAll(GetFileName(extension), output) && Verify(output);
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+  private:
+    static bool Verify(const MeshImporterOutput& output)
+    {
+        bool bMatches = output.primitives.size() == 1;
+
+        if (bMatches)
+        {
+            const RHIPrimitive& primitive = output.primitives[0];
+
+            const glm::mat4 expectedMatrix = glm::scale(glm::translate(glm::mat4 {1.f}, glm::vec3(1.f, 2.f, 3.f)), glm::vec3(2.f));
+
+            for (i32 column = 0; column < 4; ++column)
+            {
+                bMatches &= glm::all(glm::epsilonEqual(primitive.matrix[column], expectedMatrix[column], 1e-5f));
+            }
+
+            bMatches &= primitive.position == Vector<glm::vec3>(std::begin(positions), std::end(positions));
+            bMatches &= primitive.normal == Vector<glm::vec3>(std::begin(normals), std::end(normals));
+            bMatches &= primitive.indices == Vector<u32> {0, 1, 2};
+            const glm::vec2 expectedUvs[3] = {{0.f, 0.f}, {1.f, 0.f}, {0.f, 1.f}};
+
+            bMatches &= primitive.uv.size() == 3;
+
+            for (sizet index = 0; bMatches && index < 3; ++index)
+            {
+                bMatches &= glm::all(glm::epsilonEqual(primitive.uv[index], expectedUvs[index], 1e-5f));
+            }
+
+            const String imageKey = "data:bufferView,3";
+
+            bMatches &= output.textures.size() == 1 && output.textures.contains(imageKey);
+            bMatches &= primitive.materialAttributes.baseColorTexture == ResourceHandle(HashCalculate(imageKey));
+        }
+
+        if (bMatches)
+        {
+            const TextureSource& texture = *output.textures.at("data:bufferView,3");
+
+            bMatches &= texture.width == 1 && texture.height == 1 && texture.data.GetSize() > 0;
+        }
+
+        return bMatches;
+    }
+
+    static String ReplaceBufferUri(String json, const String& uri)
+    {
+        const String placeholder = " BUFFER_URI";
+
+        return json.replace(json.find(placeholder), placeholder.size(), uri);
+    }
+
+    static void Append(Vector<u8>& binary, const void* data, sizet size)
+    {
+        binary.insert(binary.end(), static_cast<const u8*>(data), static_cast<const u8*>(data) + size);
+    }
+
+    String GetFileName(cstring extension) const
+    {
+        return (directory / "Triangle").replace_extension(extension).string();
+    }
+
+    static constexpr glm::vec3 positions[3] = {{0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}, {0.f, 1.f, 0.f}};
+    static constexpr glm::vec3 normals[3]   = {{0.f, 0.f, 1.f}, {0.f, 0.6f, 0.8f}, {0.6f, 0.f, 0.8f}};
+    static constexpr u16       uvs[6]       = {0, 0, 65535, 0, 0, 65535};
+    static constexpr u16       indices[3]   = {0, 1, 2};
+
+    // Uncompressed true color TGA, a single opaque red texel stored BGRA.
+    static constexpr u8 image[22] = {0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 32, 0x28, 0, 0, 255, 255};
+
+    std::filesystem::path directory;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(GLTFImporterAutomationTest, Zn::Automation::GLTFImporterAutomationTest);
@@ -0,0 +1,75 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/MeshImporter.h"
+#include <filesystem>
+#include <fstream>
+
+namespace Zn::Automation
+{
+// Writes a .gltf referencing a buffer in a subfolder and an embedded one, next to a .bin it doesn't reference.
+// The cooked key has to follow the referenced buffer only.
+class CookedMeshKeyAutomationTest : public AutomationTest
+{
+  public:
+    virtual void Prepare() override
+    {
+        directory = std::filesystem::temp_directory_path() / "ZnCookedMeshKeyAutomationTest";
+        std::filesystem::create_directories(directory / "buffers");
+
+        Write("Mesh.gltf", R"({
+            "asset": {"version": "2.0"},
+            "buffers": [
+                {"byteLength": 4, "uri": "buffers/Mesh%20Data.bin"},
+                {"byteLength": 4, "uri": "data:application/octet-stream;base64,AAAAAA=="}
+            ]
+        })");
+
+        Write("buffers/Mesh Data.bin", "0123");
+        Write("Unrelated.bin", "0123");
+    }
+
+    virtual void Execute() override
+    {
+        const String fileName = (directory / "Mesh.gltf").string();
+
+        u64 key          = 0;
+        u64 unrelatedKey = 0;
+        u64 editedKey    = 0;
+
+        bool bMatches = MeshImporter::CalculateCookedKey(fileName, key);
+
+        Write("Unrelated.bin", "4567");
+
+        bMatches &= MeshImporter::CalculateCookedKey(fileName, unrelatedKey) && unrelatedKey == key;
+
+        Write("buffers/Mesh Data.bin", "4567");
+
+        bMatches &= MeshImporter::CalculateCookedKey(fileName, editedKey) && editedKey != key;
+
+        // The import can't succeed without the buffer, nothing must be cached for it.
+        std::filesystem::remove(directory / "buffers" / "Mesh Data.bin");
+
+        bMatches &= !MeshImporter::CalculateCookedKey(fileName, editedKey);
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+  private:
+    void Write(const String& relativePath, const String& content) const
+    {
+        std::ofstream file(directory / relativePath, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), content.size());
+    }
+
+    std::filesystem::path directory;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(CookedMeshKeyAutomationTest, Zn::Automation::CookedMeshKeyAutomationTest);
@@ -0,0 +1,159 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/MeshOptimizer.h"
+#include "Rendering/RHI/RHIMesh.h"
+#include <algorithm>
+#include <array>
+#include <random>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_MeshOptimizer, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Optimizes a grid exported with a vertex per triangle corner and shuffled triangles, with a uv seam down the middle.
+// Checks that the same triangles are drawn with the same winding, that only the vertices across the seam are kept apart, and
+// that the cache efficiency improves.
+class MeshOptimizerAutomationTest : public AutomationTest
+{
+  public:
+    MeshOptimizerAutomationTest(u32 numQuadsPerSide_, bool bIndexed_)
+        : numQuadsPerSide(numQuadsPerSide_)
+        , bIndexed(bIndexed_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        std::mt19937 gen(0x0D7);
+
+        Vector<std::array<u32, 2>> quads;
+
+        for (u32 y = 0; y < numQuadsPerSide; ++y)
+        {
+            for (u32 x = 0; x < numQuadsPerSide; ++x)
+            {
+                quads.push_back({x, y});
+            }
+        }
+
+        std::shuffle(quads.begin(), quads.end(), gen);
+
+        primitive          = RHIPrimitive {};
+        primitive.topology = PrimitiveTopology::Triangles;
+
+        for (const auto& [x, y] : quads)
+        {
+            const u32 corners[2][3][2] = {{{x, y}, {x + 1, y}, {x + 1, y + 1}}, {{x, y}, {x + 1, y + 1}, {x, y + 1}}};
+
+            for (const auto& triangle : corners)
+            {
+                for (const auto& corner : triangle)
+                {
+                    // Both sides of the seam use their own uv range.
+                    const f32 u = static_cast<f32>(corner[0]) + (x < numQuadsPerSide / 2 ? 0.f : 100.f);
+
+                    primitive.position.emplace_back(static_cast<f32>(corner[0]), static_cast<f32>(corner[1]), 0.f);
+                    primitive.uv.emplace_back(u, static_cast<f32>(corner[1]));
+                }
+            }
+        }
+
+        if (bIndexed)
+        {
+            primitive.indices.resize(primitive.position.size());
+
+            for (u32 index = 0; index < primitive.indices.size(); ++index)
+            {
+                primitive.indices[index] = index;
+            }
+        }
+
+        referenceTriangles = GetTriangles(primitive);
+    }
+
+    virtual void Execute() override
+    {
+        VertexCacheStatistics before;
+        VertexCacheStatistics after;
+
+        MeshOptimizer::Optimize(primitive, &before, &after);
+
+        const u32 numVerticesPerSide = numQuadsPerSide + 1;
+
+        bool bMatches = GetTriangles(primitive) == referenceTriangles;
+
+        bMatches &= primitive.position.size() == numVerticesPerSide * numVerticesPerSide + numVerticesPerSide;
+        bMatches &= primitive.uv.size() == primitive.position.size() && primitive.normal.empty();
+
+        bMatches &= before.numTriangles == after.numTriangles && after.numVertices == primitive.position.size();
+        bMatches &= after.GetACMR() < before.GetACMR() && after.GetACMR() < 1.f;
+
+        // Vertices are fetched in order.
+        u32 numFetchedVertices = 0;
+
+        for (u32 index : primitive.indices)
+        {
+            bMatches &= index <= numFetchedVertices;
+            numFetchedVertices = std::max(numFetchedVertices, index + 1);
+        }
+
+        ZN_LOG(LogAutomationTest_MeshOptimizer,
+               ELogVerbosity::Log,
+               "MeshOptimizer %u triangles, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+               static_cast<u32>(after.numTriangles),
+               before.GetACMR(),
+               after.GetACMR(),
+               before.GetATVR(),
+               after.GetATVR());
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        primitive = RHIPrimitive {};
+        referenceTriangles.clear();
+    }
+
+  private:
+    using Corner   = std::array<f32, 5>;
+    using Triangle = std::array<Corner, 3>;
+
+    // Sorted triangles, each one rotated to start from its smallest corner so that the winding is kept.
+    static Vector<Triangle> GetTriangles(const RHIPrimitive& primitive)
+    {
+        const sizet numCorners = primitive.indices.empty() ? primitive.position.size() : primitive.indices.size();
+
+        Vector<Triangle> triangles(numCorners / 3);
+
+        for (sizet corner = 0; corner < numCorners; ++corner)
+        {
+            const u32 vertex = primitive.indices.empty() ? static_cast<u32>(corner) : primitive.indices[corner];
+
+            const glm::vec3& position = primitive.position[vertex];
+            const glm::vec2& uv       = primitive.uv[vertex];
+
+            triangles[corner / 3][corner % 3] = {position.x, position.y, position.z, uv.x, uv.y};
+        }
+
+        for (Triangle& triangle : triangles)
+        {
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        }
+
+        std::sort(triangles.begin(), triangles.end());
+
+        return triangles;
+    }
+
+    u32  numQuadsPerSide = 0;
+    bool bIndexed        = false;
+
+    RHIPrimitive     primitive;
+    Vector<Triangle> referenceTriangles;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(MeshOptimizerAutomationTest, Zn::Automation::MeshOptimizerAutomationTest, 32, true);
+DEFINE_AUTOMATION_STARTUP_TEST(MeshOptimizerNonIndexedAutomationTest, Zn::Automation::MeshOptimizerAutomationTest, 32, false);
@@ -0,0 +1,195 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/MeshSimplifier.h"
+#include "Rendering/RHI/RHIMesh.h"
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_MeshSimplifier, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Generates the levels of detail of a uv sphere, with a uv seam along a meridian, and checks that every level stays closed and
+// outward facing, that the seam is kept and that the errors grow within bounds.
+class MeshSimplifierAutomationTest : public AutomationTest
+{
+  public:
+    explicit MeshSimplifierAutomationTest(u32 numSegments_)
+        : numSegments(numSegments_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        primitive          = RHIPrimitive {};
+        primitive.topology = PrimitiveTopology::Triangles;
+
+        const u32 numRings   = numSegments / 2;
+        const u32 numColumns = numSegments + 1;
+        const f32 pi         = 3.14159265f;
+
+        // Ring 0 and numRings are the poles, a single vertex each.
+        primitive.position.emplace_back(0.f, 1.f, 0.f);
+        primitive.uv.emplace_back(0.5f, 0.f);
+
+        for (u32 ring = 1; ring < numRings; ++ring)
+        {
+            const f32 latitude = pi * ring / numRings;
+
+            for (u32 column = 0; column < numColumns; ++column)
+            {
+                // The last column duplicates the first one with another uv, that's the seam.
+                const f32 longitude = 2.f * pi * (column % numSegments) / numSegments;
+
+                primitive.position.emplace_back(std::sin(latitude) * std::cos(longitude),
+                                                std::cos(latitude),
+                                                std::sin(latitude) * std::sin(longitude));
+                primitive.uv.emplace_back(static_cast<f32>(column) / numSegments, static_cast<f32>(ring) / numRings);
+            }
+        }
+
+        primitive.position.emplace_back(0.f, -1.f, 0.f);
+        primitive.uv.emplace_back(0.5f, 1.f);
+
+        const u32 southPole = static_cast<u32>(primitive.position.size() - 1);
+
+        auto GetVertex = [&](u32 ring, u32 column)
+        {
+            return ring == 0 ? 0 : ring == numRings ? southPole : 1 + (ring - 1) * numColumns + column;
+        };
+
+        for (u32 ring = 0; ring < numRings; ++ring)
+        {
+            for (u32 column = 0; column < numSegments; ++column)
+            {
+                const u32 a = GetVertex(ring, column);
+                const u32 b = GetVertex(ring, column + 1);
+                const u32 c = GetVertex(ring + 1, column);
+                const u32 d = GetVertex(ring + 1, column + 1);
+
+                if (ring > 0)
+                {
+                    primitive.indices.insert(primitive.indices.end(), {a, b, c});
+                }
+
+                if (ring + 1 < numRings)
+                {
+                    primitive.indices.insert(primitive.indices.end(), {b, d, c});
+                }
+            }
+        }
+    }
+
+    virtual void Execute() override
+    {
+        bool bMatches = IsClosedAndOutward(primitive.indices);
+
+        MeshSimplifier::GenerateLODs(primitive);
+
+        bMatches &= !primitive.lods.empty() && primitive.lods.size() <= MeshSimplifier::kMaxLODs;
+
+        sizet numIndices = primitive.indices.size();
+        f32   error      = 0.f;
+
+        for (const RHIPrimitiveLOD& lod : primitive.lods)
+        {
+            if (!bMatches || lod.firstIndex + lod.numIndices > primitive.lodIndices.size())
+            {
+                bMatches = false;
+                break;
+            }
+
+            const std::span<const u32> indices(primitive.lodIndices.data() + lod.firstIndex, lod.numIndices);
+
+            bMatches &= lod.numIndices % 3 == 0 && lod.numIndices < numIndices && lod.error >= error;
+            bMatches &= IsClosedAndOutward(indices);
+
+            // Seam vertices are never collapsed.
+            for (u32 ring = 1; ring < numSegments / 2; ++ring)
+            {
+                const u32 seamVertex = ring * (numSegments + 1);
+
+                bMatches &= std::find(indices.begin(), indices.end(), seamVertex) != indices.end();
+            }
+
+            ZN_LOG(LogAutomationTest_MeshSimplifier,
+                   ELogVerbosity::Log,
+                   "MeshSimplifier LOD %u triangles, error %.4f",
+                   lod.numIndices / 3,
+                   lod.error);
+
+            numIndices = lod.numIndices;
+            error      = lod.error;
+        }
+
+        // The sphere is 2 units wide.
+        bMatches &= error <= MeshSimplifier::kMaxLODError * 2.f;
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        primitive = RHIPrimitive {};
+    }
+
+  private:
+    // Every edge is shared by exactly two triangles, walking it in opposite directions, and no triangle faces the center.
+    bool IsClosedAndOutward(std::span<const u32> indices) const
+    {
+        auto GetPositionKey = [&](u32 vertex)
+        {
+            // Seam vertices share their position with the first column.
+            const glm::vec3& position = primitive.position[vertex];
+
+            return std::make_tuple(position.x, position.y, position.z);
+        };
+
+        using PositionKey = decltype(GetPositionKey(0));
+
+        Vector<std::pair<PositionKey, PositionKey>> edges;
+
+        for (sizet index = 0; index < indices.size(); index += 3)
+        {
+            const glm::vec3& a = primitive.position[indices[index]];
+            const glm::vec3& b = primitive.position[indices[index + 1]];
+            const glm::vec3& c = primitive.position[indices[index + 2]];
+
+            if (glm::dot(glm::cross(b - a, c - a), a + b + c) <= 0.f)
+            {
+                return false;
+            }
+
+            for (u32 corner = 0; corner < 3; ++corner)
+            {
+                edges.emplace_back(GetPositionKey(indices[index + corner]), GetPositionKey(indices[index + (corner + 1) % 3]));
+            }
+        }
+
+        std::sort(edges.begin(), edges.end());
+
+        for (const auto& [first, second] : edges)
+        {
+            const bool bHasTwin = std::binary_search(edges.begin(), edges.end(), std::make_pair(second, first));
+            const bool bUnique  = std::upper_bound(edges.begin(), edges.end(), std::make_pair(first, second)) -
+                                     std::lower_bound(edges.begin(), edges.end(), std::make_pair(first, second)) ==
+                                 1;
+
+            if (!bHasTwin || !bUnique)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    u32          numSegments = 0;
+    RHIPrimitive primitive;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(MeshSimplifierAutomationTest, Zn::Automation::MeshSimplifierAutomationTest, 32);
+DEFINE_AUTOMATION_STARTUP_TEST(MeshSimplifierLargeAutomationTest, Zn::Automation::MeshSimplifierAutomationTest, 256);
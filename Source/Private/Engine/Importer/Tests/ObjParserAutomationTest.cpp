@@ -0,0 +1,208 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/MeshImporter.h"
+#include "Engine/Importer/ObjParser.h"
+#include "Rendering/RHI/RHIMesh.h"
+#include "Core/Time/Time.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_ObjParser, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Parses a small OBJ with every face syntax, relative indices, CRLF line endings and ignored statements, split in chunks of
+// chunkSize bytes so that relative indices cross chunk boundaries.
+class ObjParserAutomationTest : public AutomationTest
+{
+  public:
+    explicit ObjParserAutomationTest(sizet chunkSize_)
+        : chunkSize(chunkSize_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        static constexpr char kText[] = "# Quad\n"
+                                        "mtllib quad.mtl\n"
+                                        "o Quad\n"
+                                        "v 0 0 0\n"
+                                        "v 1.0 0 0\r\n"
+                                        "  v 1 1 0 1\n"
+                                        "v 0 1e0 -0\n"
+                                        "vt 0 0\n"
+                                        "vt 1 0\n"
+                                        "vt 1 1 0\n"
+                                        "vt 0 1\n"
+                                        "vn 0 0 1\n"
+                                        "g Group\n"
+                                        "usemtl Default\n"
+                                        "s off\n"
+                                        "f 1/1/1 2/2/1 3/3/1 4/4/1\r\n"
+                                        "\n"
+                                        "f -4//-1 -2//-1 -1//-1\n"
+                                        "v +2 0 0\n"
+                                        "f 2 5 3";
+
+        ObjData data;
+        bool    bMatches = ObjParser::Parse({kText, sizeof(kText) - 1}, data, chunkSize);
+
+        bMatches &=
+            data.positions == Vector<glm::vec3> {{0.f, 0.f, 0.f}, {1.f, 0.f, 0.f}, {1.f, 1.f, 0.f}, {0.f, 1.f, 0.f}, {2.f, 0.f, 0.f}};
+        bMatches &= data.texcoords == Vector<glm::vec2> {{0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f}};
+        bMatches &= data.normals == Vector<glm::vec3> {{0.f, 0.f, 1.f}};
+
+        constexpr u32 kNone = ObjIndex::kNone;
+
+        const Vector<ObjIndex> expectedCorners {
+            {0, 0, 0},
+            {1, 1, 0},
+            {2, 2, 0},
+            {0, 0, 0},
+            {2, 2, 0},
+            {3, 3, 0},
+            {0, kNone, 0},
+            {2, kNone, 0},
+            {3, kNone, 0},
+            {1, kNone, kNone},
+            {4, kNone, kNone},
+            {2, kNone, kNone},
+        };
+
+        bMatches &= data.corners == expectedCorners;
+
+        // Out of range indices and malformed numbers are errors.
+        ObjData invalid;
+        bMatches &= !ObjParser::Parse(std::string_view("v 0 0 0\nf 1 1 2\n"), invalid, chunkSize);
+        bMatches &= !ObjParser::Parse(std::string_view("v 0 x 0\n"), invalid, chunkSize);
+        bMatches &= !ObjParser::Parse(std::string_view("v 0 0 0\nf 1 -2 1\n"), invalid, chunkSize);
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+  private:
+    sizet chunkSize = 0;
+};
+
+// Imports a large grid written as OBJ, parsed as a single chunk then in parallel chunks.
+class ObjImporterBenchmarkAutomationTest : public AutomationTest
+{
+  public:
+    explicit ObjImporterBenchmarkAutomationTest(u32 numQuadsPerSide_)
+        : numQuadsPerSide(numQuadsPerSide_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        const u32 numVerticesPerSide = numQuadsPerSide + 1;
+
+        text.clear();
+
+        for (u32 y = 0; y < numVerticesPerSide; ++y)
+        {
+            for (u32 x = 0; x < numVerticesPerSide; ++x)
+            {
+                const f32 u = static_cast<f32>(x) / numQuadsPerSide;
+                const f32 v = static_cast<f32>(y) / numQuadsPerSide;
+
+                text += "v " + std::to_string(u) + ' ' + std::to_string(v) + ' ' + std::to_string(u * v) + '\n';
+                text += "vt " + std::to_string(u) + ' ' + std::to_string(v) + '\n';
+                text += "vn 0 0 1\n";
+            }
+        }
+
+        for (u32 y = 0; y < numQuadsPerSide; ++y)
+        {
+            for (u32 x = 0; x < numQuadsPerSide; ++x)
+            {
+                const u32 corners[4] = {y * numVerticesPerSide + x + 1,
+                                        y * numVerticesPerSide + x + 2,
+                                        (y + 1) * numVerticesPerSide + x + 2,
+                                        (y + 1) * numVerticesPerSide + x + 1};
+
+                text += 'f';
+
+                for (u32 corner : corners)
+                {
+                    text += ' ' + std::to_string(corner) + '/' + std::to_string(corner) + "/1";
+                }
+
+                text += '\n';
+            }
+        }
+
+        directory = std::filesystem::temp_directory_path() / "ZnObjImporterBenchmarkAutomationTest";
+        std::filesystem::create_directories(directory);
+
+        std::ofstream file(GetFileName(), std::ios::binary | std::ios::trunc);
+        file.write(text.data(), text.size());
+    }
+
+    virtual void Execute() override
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        ObjData singleChunkData;
+        ObjData chunkedData;
+        RHIMesh mesh;
+
+        auto start = SystemClock::now();
+
+        bool bMatches = ObjParser::Parse(text, singleChunkData, text.size());
+
+        auto singleChunkEnd = SystemClock::now();
+
+        bMatches &= ObjParser::Parse(text, chunkedData);
+
+        auto chunkedEnd = SystemClock::now();
+
+        bMatches &= MeshImporter::Import(GetFileName(), mesh);
+
+        auto importEnd = SystemClock::now();
+
+        ZN_LOG(LogAutomationTest_ObjParser,
+               ELogVerbosity::Log,
+               "[%.1f MB, %zu triangles] single chunk: %.2fms chunked: %.2fms import: %.2fms",
+               text.size() / (1024. * 1024.),
+               chunkedData.corners.size() / 3,
+               Milliseconds(singleChunkEnd - start).count(),
+               Milliseconds(chunkedEnd - singleChunkEnd).count(),
+               Milliseconds(importEnd - chunkedEnd).count());
+
+        const sizet numVertices = static_cast<sizet>(numQuadsPerSide + 1) * (numQuadsPerSide + 1);
+
+        bMatches &= singleChunkData.positions == chunkedData.positions && singleChunkData.texcoords == chunkedData.texcoords &&
+                    singleChunkData.normals == chunkedData.normals && singleChunkData.corners == chunkedData.corners;
+        bMatches &= mesh.vertices.size() == numVertices && mesh.indices.size() == static_cast<sizet>(numQuadsPerSide) * numQuadsPerSide * 6;
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        text.clear();
+        text.shrink_to_fit();
+
+        std::error_code error;
+        std::filesystem::remove_all(directory, error);
+    }
+
+  private:
+    String GetFileName() const
+    {
+        return (directory / "Grid.obj").string();
+    }
+
+    u32                   numQuadsPerSide = 0;
+    String                text;
+    std::filesystem::path directory;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(ObjParserAutomationTest, Zn::Automation::ObjParserAutomationTest, 1);
+DEFINE_AUTOMATION_STARTUP_TEST(ObjParserSmallChunksAutomationTest, Zn::Automation::ObjParserAutomationTest, 16);
+DEFINE_AUTOMATION_STARTUP_TEST(ObjParserSingleChunkAutomationTest, Zn::Automation::ObjParserAutomationTest, ObjParser::kDefaultChunkSize);
+DEFINE_AUTOMATION_STARTUP_TEST(ObjImporterBenchmarkAutomationTest, Zn::Automation::ObjImporterBenchmarkAutomationTest, 400);
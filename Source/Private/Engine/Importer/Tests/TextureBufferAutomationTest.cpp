@@ -0,0 +1,98 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/TextureCompressor.h"
+#include "Engine/Importer/TextureImporter.h"
+#include "Engine/Importer/TextureMipGenerator.h"
+#include <algorithm>
+
+namespace Zn::Automation
+{
+// Hands texels over to texture buffers and checks that they are adopted rather than copied, freed once, and that the mips and the
+// compression of a texture source match the ones built from a plain vector.
+class TextureBufferAutomationTest : public AutomationTest
+{
+  public:
+    TextureBufferAutomationTest(u32 width_, u32 height_)
+        : width(width_)
+        , height(height_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        pixels.resize(static_cast<sizet>(width) * height * 4);
+
+        for (sizet index = 0; index < pixels.size(); ++index)
+        {
+            pixels[index] = static_cast<u8>(index * 7 % 251);
+        }
+    }
+
+    virtual void Execute() override
+    {
+        // A vector keeps its storage through the adoption and the moves.
+        Vector<u8>    decoded        = pixels;
+        const u8*     decodedStorage = decoded.data();
+        TextureBuffer adopted(std::move(decoded));
+        TextureBuffer moved = std::move(adopted);
+
+        bool bMatches = moved.GetData() == decodedStorage && moved.GetSize() == pixels.size();
+        bMatches &= adopted.GetData() == nullptr && adopted.GetSize() == 0;
+
+        // Foreign memory is freed by its deleter, exactly once.
+        static u32 numDeleted = 0;
+        numDeleted            = 0;
+
+        {
+            TextureBuffer foreign(new u8[16],
+                                  16,
+                                  [](void* data)
+                                  {
+                                      delete[] static_cast<u8*>(data);
+                                      ++numDeleted;
+                                  });
+            TextureBuffer owner = std::move(foreign);
+        }
+
+        bMatches &= numDeleted == 1;
+
+        const TextureImportSettings settings {.bSRGB = true, .compression = TextureCompression::BC1};
+
+        TextureSource texture {
+            .width    = static_cast<i32>(width),
+            .height   = static_cast<i32>(height),
+            .channels = 4,
+            .data     = std::move(moved),
+        };
+
+        TextureImporter::GenerateMips(texture, settings);
+
+        Vector<u8> reference = pixels;
+        const u32  numMips   = TextureMipGenerator::Generate(reference, width, height, settings);
+
+        bMatches &= texture.numMips == numMips && std::ranges::equal(texture.data.GetView(), reference);
+
+        TextureImporter::Compress(texture, settings);
+
+        const Vector<u8> referenceBlocks = TextureCompressor::Compress(reference, width, height, numMips, settings.compression);
+
+        bMatches &= texture.compression == settings.compression && std::ranges::equal(texture.data.GetView(), referenceBlocks);
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        pixels.clear();
+        pixels.shrink_to_fit();
+    }
+
+  private:
+    u32        width  = 0;
+    u32        height = 0;
+    Vector<u8> pixels;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(TextureBufferAutomationTest, Zn::Automation::TextureBufferAutomationTest, 45, 30);
@@ -0,0 +1,157 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/TextureCompressor.h"
+#include "Engine/Importer/TextureMipGenerator.h"
+#include <cmath>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_TextureCompressor, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+static const char* kCompressionNames[] = {"None", "BC1", "BC3", "BC5", "BC7"};
+
+// Compresses the mip chain of a width x height texture of smooth gradients and noise, decodes it back and checks the error of the
+// channels the format keeps.
+class TextureCompressorAutomationTest : public AutomationTest
+{
+  public:
+    TextureCompressorAutomationTest(TextureCompression compression_, u32 width_, u32 height_, f32 maxError_)
+        : compression(compression_)
+        , width(width_)
+        , height(height_)
+        , maxError(maxError_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        pixels.resize(static_cast<sizet>(width) * height * 4);
+
+        u32 noise = 0x9E3779B9;
+
+        for (u32 y = 0; y < height; ++y)
+        {
+            for (u32 x = 0; x < width; ++x)
+            {
+                u8* pixel = &pixels[(static_cast<sizet>(y) * width + x) * 4];
+
+                noise = noise * 1664525 + 1013904223;
+
+                pixel[0] = static_cast<u8>(x * 255 / width);
+                pixel[1] = static_cast<u8>(y * 255 / height);
+                pixel[2] = static_cast<u8>(std::clamp<i32>(128 + static_cast<i32>((x + y) % 64) - static_cast<i32>(noise >> 29), 0, 255));
+                pixel[3] = static_cast<u8>(255 - (x + y) * 255 / (width + height));
+            }
+        }
+
+        numMips = TextureMipGenerator::Generate(pixels, width, height, TextureImportSettings {});
+    }
+
+    virtual void Execute() override
+    {
+        const Vector<u8> blocks  = TextureCompressor::Compress(pixels, width, height, numMips, compression);
+        const Vector<u8> decoded = TextureCompressor::Decompress(blocks, width, height, numMips, compression);
+
+        bool bMatches = blocks.size() == TextureCompressor::CalculateMipChainSize(compression, width, height, numMips);
+        bMatches &= decoded.size() == pixels.size();
+
+        // BC1 drops alpha, BC5 keeps red and green only.
+        const u32 numChannels = compression == TextureCompression::BC1 ? 3 : compression == TextureCompression::BC5 ? 2 : 4;
+
+        f64 squaredError = 0.0;
+
+        for (sizet texel = 0; bMatches && texel < pixels.size() / 4; ++texel)
+        {
+            for (u32 channel = 0; channel < numChannels; ++channel)
+            {
+                const f64 difference = static_cast<f64>(decoded[texel * 4 + channel]) - pixels[texel * 4 + channel];
+
+                squaredError += difference * difference;
+            }
+        }
+
+        const f64 rootMeanSquaredError = std::sqrt(squaredError / (pixels.size() / 4 * numChannels));
+
+        ZN_LOG(LogAutomationTest_TextureCompressor,
+               ELogVerbosity::Log,
+               "[%s %ux%u] %zu bytes, RMSE: %f",
+               kCompressionNames[static_cast<u32>(compression)],
+               width,
+               height,
+               blocks.size(),
+               rootMeanSquaredError);
+
+        bMatches &= rootMeanSquaredError <= maxError;
+
+        // A solid block decodes to its color, within 1 for BC7 whose channels share the lowest bit, within the 565 precision for the
+        // others.
+        u8 solid[64];
+        u8 block[16];
+        u8 solidDecoded[64];
+
+        for (u32 texel = 0; texel < 16; ++texel)
+        {
+            solid[texel * 4]     = 200;
+            solid[texel * 4 + 1] = 77;
+            solid[texel * 4 + 2] = 13;
+            solid[texel * 4 + 3] = 128;
+        }
+
+        TextureCompressor::EncodeBlock(compression, solid, block);
+        TextureCompressor::DecodeBlock(compression, block, solidDecoded);
+
+        for (u32 index = 0; index < 64; ++index)
+        {
+            const u32 channel   = index % 4;
+            const i32 tolerance = compression == TextureCompression::BC7 ? 1 : channel == 1 ? 2 : 4;
+
+            if (channel < numChannels)
+            {
+                bMatches &= std::abs(solidDecoded[index] - solid[index]) <= tolerance;
+            }
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        pixels.clear();
+        pixels.shrink_to_fit();
+    }
+
+  private:
+    TextureCompression compression = TextureCompression::None;
+    u32                width       = 0;
+    u32                height      = 0;
+    f32                maxError    = 0.f;
+    u32                numMips     = 0;
+    Vector<u8>         pixels;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(TextureCompressorBC1AutomationTest,
+                               Zn::Automation::TextureCompressorAutomationTest,
+                               Zn::TextureCompression::BC1,
+                               256,
+                               256,
+                               3.f);
+DEFINE_AUTOMATION_STARTUP_TEST(TextureCompressorBC3AutomationTest,
+                               Zn::Automation::TextureCompressorAutomationTest,
+                               Zn::TextureCompression::BC3,
+                               37,
+                               21,
+                               7.5f);
+DEFINE_AUTOMATION_STARTUP_TEST(TextureCompressorBC5AutomationTest,
+                               Zn::Automation::TextureCompressorAutomationTest,
+                               Zn::TextureCompression::BC5,
+                               256,
+                               256,
+                               0.5f);
+DEFINE_AUTOMATION_STARTUP_TEST(TextureCompressorBC7AutomationTest,
+                               Zn::Automation::TextureCompressorAutomationTest,
+                               Zn::TextureCompression::BC7,
+                               256,
+                               256,
+                               2.f);
@@ -0,0 +1,171 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/TextureCompressor.h"
+#include "Engine/Importer/TextureImportQueue.h"
+#include "Engine/Importer/TextureMipGenerator.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_TextureImportQueue, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Writes textures of various sizes as TGA files and imports them through a queue, plus a missing one. Checks every texture against
+// TextureImporter::Import, that the bytes in flight stay within the budget and that the callbacks run once each, on the calling
+// thread.
+class TextureImportQueueAutomationTest : public AutomationTest
+{
+  public:
+    TextureImportQueueAutomationTest(u32 numTextures_, sizet budget_)
+        : numTextures(numTextures_)
+        , budget(budget_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        directory = std::filesystem::temp_directory_path() / "ZnTextureImportQueueAutomationTest";
+        std::filesystem::create_directories(directory);
+
+        static const TextureImportSettings kSettings[] = {
+            TextureImportSettings {},
+            TextureImportSettings {.bSRGB = true, .compression = TextureCompression::BC1},
+            TextureImportSettings {.bSRGB = true, .bPreserveAlphaCoverage = true, .compression = TextureCompression::BC3},
+        };
+
+        for (u32 index = 0; index < numTextures; ++index)
+        {
+            const u16 width  = static_cast<u16>(16 + index * 37 % 240);
+            const u16 height = static_cast<u16>(8 + index * 53 % 248);
+
+            paths.push_back((directory / ("texture" + std::to_string(index) + ".tga")).string());
+            settings.push_back(kSettings[index % std::size(kSettings)]);
+
+            WriteTGA(paths.back(), width, height, index);
+        }
+    }
+
+    virtual void Execute() override
+    {
+        TextureImportQueue queue(budget);
+
+        for (u32 index = 0; index < numTextures; ++index)
+        {
+            queue.Add(paths[index], settings[index]);
+        }
+
+        const sizet missingIndex = queue.Add((directory / "missing.tga").string());
+
+        const std::thread::id callingThread = std::this_thread::get_id();
+
+        Vector<Vector<u8>> destinations(numTextures + 1);
+        Vector<u32>        numCompleted(numTextures + 1, 0);
+        Vector<u8>         succeeded(numTextures + 1, 0);
+        sizet              maxCost             = 0;
+        bool               bOnCallingThread    = true;
+        bool               bAllocatedOnce      = true;
+        bool               bMatchesDescription = true;
+
+        const bool bSucceeded = queue.Run(
+            [&](sizet index, const TextureDescription& description)
+            {
+                bOnCallingThread &= std::this_thread::get_id() == callingThread;
+                bAllocatedOnce &= destinations[index].empty();
+
+                bMatchesDescription &=
+                    description.size == TextureCompressor::CalculateMipChainSize(
+                                            description.compression, description.width, description.height, description.numMips);
+
+                maxCost = std::max(maxCost,
+                                   TextureMipGenerator::CalculateMipChainSize(description.width, description.height, description.numMips) +
+                                       description.size);
+
+                destinations[index].resize(description.size);
+
+                return std::span<u8>(destinations[index]);
+            },
+            [&](sizet index, const TextureDescription&, bool bImported)
+            {
+                bOnCallingThread &= std::this_thread::get_id() == callingThread;
+
+                ++numCompleted[index];
+                succeeded[index] = bImported;
+            });
+
+        ZN_LOG(LogAutomationTest_TextureImportQueue,
+               ELogVerbosity::Log,
+               "[%u textures] Peak of %zu bytes in flight, budget %zu",
+               numTextures,
+               queue.GetPeakBytesInFlight(),
+               budget);
+
+        bool bMatches = !bSucceeded && bOnCallingThread && bAllocatedOnce && bMatchesDescription;
+
+        bMatches &= queue.GetPeakBytesInFlight() <= std::max(budget, maxCost);
+        bMatches &= numCompleted[missingIndex] == 1 && !succeeded[missingIndex] && destinations[missingIndex].empty();
+
+        for (u32 index = 0; bMatches && index < numTextures; ++index)
+        {
+            const SharedPtr<TextureSource> texture = TextureImporter::Import(paths[index], settings[index]);
+
+            bMatches &= numCompleted[index] == 1 && succeeded[index];
+            bMatches &= texture && texture->compression == settings[index].compression;
+            bMatches &= texture && std::ranges::equal(texture->data.GetView(), destinations[index]);
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        std::error_code errorCode;
+        std::filesystem::remove_all(directory, errorCode);
+
+        paths.clear();
+        settings.clear();
+    }
+
+  private:
+    // Uncompressed 32 bits TGA, top left origin.
+    static void WriteTGA(const String& path, u16 width, u16 height, u32 seed)
+    {
+        u8 header[18] = {};
+        header[2]     = 2;
+        header[12]    = static_cast<u8>(width);
+        header[13]    = static_cast<u8>(width >> 8);
+        header[14]    = static_cast<u8>(height);
+        header[15]    = static_cast<u8>(height >> 8);
+        header[16]    = 32;
+        header[17]    = 0x28;
+
+        Vector<u8> texels(static_cast<sizet>(width) * height * 4);
+
+        for (sizet texel = 0; texel < texels.size() / 4; ++texel)
+        {
+            const u32 x = static_cast<u32>(texel % width);
+            const u32 y = static_cast<u32>(texel / width);
+
+            texels[texel * 4]     = static_cast<u8>(x * 255 / width);
+            texels[texel * 4 + 1] = static_cast<u8>(y * 255 / height);
+            texels[texel * 4 + 2] = static_cast<u8>((x * 7 + y * 13 + seed * 29) % 256);
+            texels[texel * 4 + 3] = static_cast<u8>((x ^ y) * 31 % 256);
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(texels.data()), texels.size());
+    }
+
+    u32                           numTextures = 0;
+    sizet                         budget      = 0;
+    std::filesystem::path         directory;
+    Vector<String>                paths;
+    Vector<TextureImportSettings> settings;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(TextureImportQueueAutomationTest, Zn::Automation::TextureImportQueueAutomationTest, 12, 1024 * 1024);
+DEFINE_AUTOMATION_STARTUP_TEST(TextureImportQueueSerialAutomationTest, Zn::Automation::TextureImportQueueAutomationTest, 6, 0);
@@ -0,0 +1,189 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/Importer/TextureImporter.h"
+#include "Engine/Importer/TextureMipGenerator.h"
+#include "Core/Time/Time.h"
+#include <chrono>
+#include <cmath>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_TextureMipGenerator, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Generates the mip chain of a width x height texture and checks every level against a reference chain filtered in double, each
+// texel averaging the texels of the previous level it covers. Then checks the sRGB average of black and white and that a mask
+// keeps its alpha coverage down the chain.
+class TextureMipGeneratorAutomationTest : public AutomationTest
+{
+  public:
+    TextureMipGeneratorAutomationTest(u32 width_, u32 height_)
+        : width(width_)
+        , height(height_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        pixels.resize(static_cast<sizet>(width) * height * 4);
+
+        for (u32 y = 0; y < height; ++y)
+        {
+            for (u32 x = 0; x < width; ++x)
+            {
+                u8* pixel = &pixels[(static_cast<sizet>(y) * width + x) * 4];
+
+                pixel[0] = static_cast<u8>(x * 255 / width);
+                pixel[1] = static_cast<u8>(y * 255 / height);
+                pixel[2] = static_cast<u8>((x * 7 + y * 13) % 256);
+                pixel[3] = static_cast<u8>((x ^ y) * 31 % 256);
+            }
+        }
+    }
+
+    virtual void Execute() override
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+
+        Vector<u8> linearPixels = pixels;
+
+        auto start = SystemClock::now();
+
+        const u32 numMips = TextureMipGenerator::Generate(linearPixels, width, height, TextureImportSettings {});
+
+        auto end = SystemClock::now();
+
+        ZN_LOG(LogAutomationTest_TextureMipGenerator,
+               ELogVerbosity::Log,
+               "[%ux%u] %u mips in %.2fms",
+               width,
+               height,
+               numMips,
+               Milliseconds(end - start).count());
+
+        bool bMatches = numMips == TextureMipGenerator::CalculateNumMips(width, height);
+        bMatches &= TextureMipGenerator::GetMipWidth(width, numMips - 1) == 1;
+        bMatches &= TextureMipGenerator::GetMipHeight(height, numMips - 1) == 1;
+        bMatches &= linearPixels.size() == TextureMipGenerator::CalculateMipChainSize(width, height, numMips);
+        bMatches &= std::equal(pixels.begin(), pixels.end(), linearPixels.begin());
+
+        Vector<f64> reference(pixels.begin(), pixels.end());
+        Vector<f64> previousReference;
+
+        sizet levelOffset = reference.size();
+
+        for (u32 mip = 1; bMatches && mip < numMips; ++mip)
+        {
+            const u32 sourceWidth = TextureMipGenerator::GetMipWidth(width, mip - 1);
+            const u32 levelWidth  = TextureMipGenerator::GetMipWidth(width, mip);
+            const u32 levelHeight = TextureMipGenerator::GetMipHeight(height, mip);
+
+            std::swap(previousReference, reference);
+            reference.resize(static_cast<sizet>(levelWidth) * levelHeight * 4);
+
+            const LevelSize source {sourceWidth, TextureMipGenerator::GetMipHeight(height, mip - 1)};
+
+            for (u32 y = 0; y < levelHeight; ++y)
+            {
+                for (u32 x = 0; x < levelWidth; ++x)
+                {
+                    const sizet index = (static_cast<sizet>(y) * levelWidth + x) * 4;
+
+                    for (u32 channel = 0; channel < 4; ++channel)
+                    {
+                        reference[index + channel] =
+                            AverageFootprint(previousReference, source, LevelSize {levelWidth, levelHeight}, x, y, channel);
+
+                        bMatches &= std::abs(linearPixels[levelOffset + index + channel] - reference[index + channel]) <= 0.5 + 1e-3;
+                    }
+                }
+            }
+
+            levelOffset += reference.size();
+        }
+
+        // Black and white average to the sRGB encoding of 0.5 linear, not to 128.
+        Vector<u8> checker = {0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 255};
+
+        bMatches &= TextureMipGenerator::Generate(checker, 2, 2, TextureImportSettings {.bSRGB = true}) == 2;
+        bMatches &= checker.size() == 20 && checker[16] == 188 && checker[17] == 188 && checker[18] == 188 && checker[19] == 255;
+
+        // A mask whose alpha drops below the cutoff when plainly averaged.
+        Vector<u8> mask(pixels.size());
+
+        for (sizet texel = 0; texel < mask.size() / 4; ++texel)
+        {
+            mask[texel * 4 + 3] = texel % 3 == 0 ? 255 : 64;
+        }
+
+        const TextureImportSettings maskSettings {.alphaCutoff = 0.5f, .bSRGB = true, .bPreserveAlphaCoverage = true};
+        const f32                   coverage = TextureMipGenerator::CalculateAlphaCoverage(mask, maskSettings.alphaCutoff);
+
+        TextureMipGenerator::Generate(mask, width, height, maskSettings);
+
+        levelOffset = 0;
+
+        for (u32 mip = 0; mip < numMips; ++mip)
+        {
+            const sizet levelSize = static_cast<sizet>(TextureMipGenerator::GetMipWidth(width, mip)) *
+                                    TextureMipGenerator::GetMipHeight(height, mip) * 4;
+
+            const f32 levelCoverage =
+                TextureMipGenerator::CalculateAlphaCoverage(std::span(mask).subspan(levelOffset, levelSize), maskSettings.alphaCutoff);
+
+            // A level of n texels can only get within 1 / n of the coverage.
+            bMatches &= std::abs(levelCoverage - coverage) <= 4.f / (levelSize / 4) + 0.02f;
+
+            levelOffset += levelSize;
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        pixels.clear();
+        pixels.shrink_to_fit();
+    }
+
+  private:
+    struct LevelSize
+    {
+        u32 width;
+        u32 height;
+    };
+
+    // Area weighted average of the source texels covered by the texel (x, y) of the level.
+    static f64 AverageFootprint(const Vector<f64>& texels, LevelSize source, LevelSize level, u32 x, u32 y, u32 channel)
+    {
+        const f64 beginX = static_cast<f64>(x) * source.width / level.width;
+        const f64 endX   = static_cast<f64>(x + 1) * source.width / level.width;
+        const f64 beginY = static_cast<f64>(y) * source.height / level.height;
+        const f64 endY   = static_cast<f64>(y + 1) * source.height / level.height;
+
+        f64 sum = 0.0;
+
+        for (u32 sourceY = static_cast<u32>(beginY); sourceY < endY; ++sourceY)
+        {
+            const f64 weightY = std::min<f64>(endY, sourceY + 1) - std::max<f64>(beginY, sourceY);
+
+            for (u32 sourceX = static_cast<u32>(beginX); sourceX < endX; ++sourceX)
+            {
+                const f64 weightX = std::min<f64>(endX, sourceX + 1) - std::max<f64>(beginX, sourceX);
+
+                sum += texels[(static_cast<sizet>(sourceY) * source.width + sourceX) * 4 + channel] * weightX * weightY;
+            }
+        }
+
+        return sum / ((endX - beginX) * (endY - beginY));
+    }
+
+    u32        width  = 0;
+    u32        height = 0;
+    Vector<u8> pixels;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(TextureMipGeneratorAutomationTest, Zn::Automation::TextureMipGeneratorAutomationTest, 64, 64);
+DEFINE_AUTOMATION_STARTUP_TEST(TextureMipGeneratorOddSizeAutomationTest, Zn::Automation::TextureMipGeneratorAutomationTest, 37, 5);
+DEFINE_AUTOMATION_STARTUP_TEST(TextureMipGeneratorLargeAutomationTest, Zn::Automation::TextureMipGeneratorAutomationTest, 1024, 1024);
@@ -0,0 +1,930 @@
+#include <Znpch.h>
+#include <Engine/Importer/TextureCompressor.h>
+#include <Engine/Importer/TextureMipGenerator.h>
+#include <Core/Async/ThreadPool.h>
+#include <array>
+#include <cmath>
+
+using namespace Zn;
+
+namespace
+{
+static constexpr u32 kBlockDimension = TextureCompressor::kBlockDimension;
+static constexpr u32 kTexelsPerBlock = kBlockDimension * kBlockDimension;
+
+// Rows of blocks of a level are handed to the workers in groups of at least this many blocks.
+static constexpr u32 kMinBlocksPerTask = 1024;
+
+// Interpolation weights of the BC7 4 bit indices, in 64ths.
+static constexpr u32 kBC7Weights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+// Weight of color0 for each BC1 index of the 4 color mode.
+static constexpr f32 kBC1Weights[4] = {1.f, 0.f, 2.f / 3.f, 1.f / 3.f};
+
+template<sizet N>
+using Point = std::array<f32, N>;
+
+u32 GetNumBlocks(u32 size)
+{
+    return (size + kBlockDimension - 1) / kBlockDimension;
+}
+
+// The first N channels of a RGBA8 texel.
+template<sizet N>
+Point<N> ToPoint(const u8* texel)
+{
+    Point<N> point;
+
+    for (u32 channel = 0; channel < N; ++channel)
+    {
+        point[channel] = texel[channel];
+    }
+
+    return point;
+}
+
+template<sizet N>
+f32 SquaredDistance(const Point<N>& lhs, const Point<N>& rhs)
+{
+    f32 distance = 0.f;
+
+    for (u32 channel = 0; channel < N; ++channel)
+    {
+        distance += (lhs[channel] - rhs[channel]) * (lhs[channel] - rhs[channel]);
+    }
+
+    return distance;
+}
+
+template<sizet N>
+void ClampEndpoint(Point<N>& endpoint)
+{
+    for (f32& value : endpoint)
+    {
+        value = std::clamp(value, 0.f, 255.f);
+    }
+}
+
+// Endpoints at the extremes of the points projected on their principal axis, found by power iteration on their covariance.
+template<sizet N>
+void FitEndpoints(const Point<N>* points, Point<N>& outLow, Point<N>& outHigh)
+{
+    Point<N> mean {};
+    Point<N> min = points[0];
+    Point<N> max = points[0];
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        for (u32 channel = 0; channel < N; ++channel)
+        {
+            mean[channel] += points[texel][channel] / kTexelsPerBlock;
+            min[channel] = std::min(min[channel], points[texel][channel]);
+            max[channel] = std::max(max[channel], points[texel][channel]);
+        }
+    }
+
+    f32 covariance[N][N] = {};
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        for (u32 row = 0; row < N; ++row)
+        {
+            for (u32 column = 0; column < N; ++column)
+            {
+                covariance[row][column] += (points[texel][row] - mean[row]) * (points[texel][column] - mean[column]);
+            }
+        }
+    }
+
+    // The diagonal of the bounds is a good first guess, and is never orthogonal to the axis unless the points are a single color.
+    Point<N> axis;
+
+    for (u32 channel = 0; channel < N; ++channel)
+    {
+        axis[channel] = max[channel] - min[channel];
+    }
+
+    for (u32 iteration = 0; iteration < 8; ++iteration)
+    {
+        Point<N> next {};
+        f32      length = 0.f;
+
+        for (u32 row = 0; row < N; ++row)
+        {
+            for (u32 column = 0; column < N; ++column)
+            {
+                next[row] += covariance[row][column] * axis[column];
+            }
+
+            length = std::max(length, std::abs(next[row]));
+        }
+
+        if (length == 0.f)
+        {
+            break;
+        }
+
+        for (u32 channel = 0; channel < N; ++channel)
+        {
+            axis[channel] = next[channel] / length;
+        }
+    }
+
+    f32 axisLength = 0.f;
+
+    for (f32 value : axis)
+    {
+        axisLength += value * value;
+    }
+
+    if (axisLength == 0.f)
+    {
+        outLow  = mean;
+        outHigh = mean;
+        return;
+    }
+
+    f32 minProjection = 0.f;
+    f32 maxProjection = 0.f;
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        f32 projection = 0.f;
+
+        for (u32 channel = 0; channel < N; ++channel)
+        {
+            projection += (points[texel][channel] - mean[channel]) * axis[channel];
+        }
+
+        minProjection = std::min(minProjection, projection / axisLength);
+        maxProjection = std::max(maxProjection, projection / axisLength);
+    }
+
+    for (u32 channel = 0; channel < N; ++channel)
+    {
+        outLow[channel]  = mean[channel] + axis[channel] * minProjection;
+        outHigh[channel] = mean[channel] + axis[channel] * maxProjection;
+    }
+
+    ClampEndpoint(outLow);
+    ClampEndpoint(outHigh);
+}
+
+// Endpoints minimizing the squared error of the points for fixed interpolation weights, 0 at low and 1 at high.
+template<sizet N>
+bool RefineEndpoints(const Point<N>* points, const f32* weights, Point<N>& outLow, Point<N>& outHigh)
+{
+    f32      lowLow   = 0.f;
+    f32      highHigh = 0.f;
+    f32      lowHigh  = 0.f;
+    Point<N> lowSum {};
+    Point<N> highSum {};
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        const f32 high = weights[texel];
+        const f32 low  = 1.f - high;
+
+        lowLow += low * low;
+        highHigh += high * high;
+        lowHigh += low * high;
+
+        for (u32 channel = 0; channel < N; ++channel)
+        {
+            lowSum[channel] += low * points[texel][channel];
+            highSum[channel] += high * points[texel][channel];
+        }
+    }
+
+    const f32 determinant = lowLow * highHigh - lowHigh * lowHigh;
+
+    // Every point on the same weight, the endpoints are not constrained.
+    if (std::abs(determinant) < 1e-6f)
+    {
+        return false;
+    }
+
+    for (u32 channel = 0; channel < N; ++channel)
+    {
+        outLow[channel]  = (lowSum[channel] * highHigh - highSum[channel] * lowHigh) / determinant;
+        outHigh[channel] = (highSum[channel] * lowLow - lowSum[channel] * lowHigh) / determinant;
+    }
+
+    ClampEndpoint(outLow);
+    ClampEndpoint(outHigh);
+
+    return true;
+}
+
+// Blocks on the edges of levels that are not a multiple of 4 repeat the last row and column.
+void LoadBlock(const u8* level, u32 width, u32 height, u32 blockX, u32 blockY, u8* outTexels)
+{
+    for (u32 y = 0; y < kBlockDimension; ++y)
+    {
+        const u32 levelY = std::min(blockY * kBlockDimension + y, height - 1);
+
+        for (u32 x = 0; x < kBlockDimension; ++x)
+        {
+            const u32 levelX = std::min(blockX * kBlockDimension + x, width - 1);
+
+            memcpy(outTexels + (y * kBlockDimension + x) * 4, level + (static_cast<sizet>(levelY) * width + levelX) * 4, 4);
+        }
+    }
+}
+
+void StoreBlock(const u8* texels, u32 width, u32 height, u32 blockX, u32 blockY, u8* outLevel)
+{
+    for (u32 y = 0; y < kBlockDimension && blockY * kBlockDimension + y < height; ++y)
+    {
+        const u32 levelY = blockY * kBlockDimension + y;
+
+        for (u32 x = 0; x < kBlockDimension && blockX * kBlockDimension + x < width; ++x)
+        {
+            const u32 levelX = blockX * kBlockDimension + x;
+
+            memcpy(outLevel + (static_cast<sizet>(levelY) * width + levelX) * 4, texels + (y * kBlockDimension + x) * 4, 4);
+        }
+    }
+}
+
+//// BC1
+
+u16 PackRGB565(const Point<3>& color)
+{
+    const u32 r = static_cast<u32>(color[0] * 31.f / 255.f + 0.5f);
+    const u32 g = static_cast<u32>(color[1] * 63.f / 255.f + 0.5f);
+    const u32 b = static_cast<u32>(color[2] * 31.f / 255.f + 0.5f);
+
+    return static_cast<u16>((r << 11) | (g << 5) | b);
+}
+
+// Expands the 5 and 6 bit channels to 8 bits by repeating their highest bits.
+std::array<u32, 3> UnpackRGB565(u16 color)
+{
+    const u32 r = (color >> 11) & 31;
+    const u32 g = (color >> 5) & 63;
+    const u32 b = color & 31;
+
+    return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+// Color palette of a BC1 block, BC3 blocks always use the 4 color mode.
+void BuildColorPalette(u16 color0, u16 color1, bool bAllowThreeColors, u8 (&outPalette)[4][4])
+{
+    const std::array<u32, 3> endpoint0 = UnpackRGB565(color0);
+    const std::array<u32, 3> endpoint1 = UnpackRGB565(color1);
+
+    const bool bFourColors = !bAllowThreeColors || color0 > color1;
+
+    for (u32 channel = 0; channel < 3; ++channel)
+    {
+        const u32 value0 = endpoint0[channel];
+        const u32 value1 = endpoint1[channel];
+
+        outPalette[0][channel] = static_cast<u8>(value0);
+        outPalette[1][channel] = static_cast<u8>(value1);
+        outPalette[2][channel] = static_cast<u8>(bFourColors ? (2 * value0 + value1) / 3 : (value0 + value1) / 2);
+        outPalette[3][channel] = static_cast<u8>(bFourColors ? (value0 + 2 * value1) / 3 : 0);
+    }
+
+    // The 3 color mode makes the last index transparent black.
+    for (u32 index = 0; index < 4; ++index)
+    {
+        outPalette[index][3] = index < 3 || bFourColors ? 255 : 0;
+    }
+}
+
+f32 FindColorIndices(const Point<3>* colors, u16 color0, u16 color1, u32& outIndices)
+{
+    u8 palette[4][4];
+    BuildColorPalette(color0, color1, false, palette);
+
+    Point<3> paletteColors[4];
+
+    for (u32 index = 0; index < 4; ++index)
+    {
+        paletteColors[index] = ToPoint<3>(palette[index]);
+    }
+
+    f32 error  = 0.f;
+    outIndices = 0;
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        u32 bestIndex = 0;
+        f32 bestError = std::numeric_limits<f32>::max();
+
+        for (u32 index = 0; index < 4; ++index)
+        {
+            const f32 indexError = SquaredDistance(colors[texel], paletteColors[index]);
+
+            if (indexError < bestError)
+            {
+                bestIndex = index;
+                bestError = indexError;
+            }
+        }
+
+        outIndices |= bestIndex << (texel * 2);
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Always written in the 4 color mode, the alpha of BC1 textures is dropped.
+void EncodeColorBlock(const u8* texels, u8* outBlock)
+{
+    Point<3> colors[kTexelsPerBlock];
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        colors[texel] = ToPoint<3>(texels + texel * 4);
+    }
+
+    Point<3> low;
+    Point<3> high;
+    FitEndpoints(colors, low, high);
+
+    u16 color0  = PackRGB565(high);
+    u16 color1  = PackRGB565(low);
+    u32 indices = 0;
+    f32 error   = FindColorIndices(colors, color0, color1, indices);
+
+    f32 weights[kTexelsPerBlock];
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        weights[texel] = kBC1Weights[(indices >> (texel * 2)) & 3];
+    }
+
+    if (RefineEndpoints(colors, weights, low, high))
+    {
+        const u16 refinedColor0  = PackRGB565(high);
+        const u16 refinedColor1  = PackRGB565(low);
+        u32       refinedIndices = 0;
+
+        if (FindColorIndices(colors, refinedColor0, refinedColor1, refinedIndices) < error)
+        {
+            color0  = refinedColor0;
+            color1  = refinedColor1;
+            indices = refinedIndices;
+        }
+    }
+
+    if (color0 < color1)
+    {
+        // Swapping the endpoints mirrors the palette, 0 <-> 1 and 2 <-> 3.
+        std::swap(color0, color1);
+        indices ^= 0x55555555;
+    }
+    else if (color0 == color1)
+    {
+        indices = 0;
+    }
+
+    memcpy(outBlock, &color0, sizeof(u16));
+    memcpy(outBlock + 2, &color1, sizeof(u16));
+    memcpy(outBlock + 4, &indices, sizeof(u32));
+}
+
+void DecodeColorBlock(const u8* block, bool bAllowThreeColors, u8* outTexels)
+{
+    u16 color0  = 0;
+    u16 color1  = 0;
+    u32 indices = 0;
+
+    memcpy(&color0, block, sizeof(u16));
+    memcpy(&color1, block + 2, sizeof(u16));
+    memcpy(&indices, block + 4, sizeof(u32));
+
+    u8 palette[4][4];
+    BuildColorPalette(color0, color1, bAllowThreeColors, palette);
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        memcpy(outTexels + texel * 4, palette[(indices >> (texel * 2)) & 3], 4);
+    }
+}
+
+//// BC4, the alpha of BC3 and each channel of BC5
+
+void BuildChannelPalette(u8 value0, u8 value1, u8 (&outPalette)[8])
+{
+    outPalette[0] = value0;
+    outPalette[1] = value1;
+
+    if (value0 > value1)
+    {
+        for (u32 step = 1; step < 7; ++step)
+        {
+            outPalette[step + 1] = static_cast<u8>(((7 - step) * value0 + step * value1) / 7);
+        }
+    }
+    else
+    {
+        for (u32 step = 1; step < 5; ++step)
+        {
+            outPalette[step + 1] = static_cast<u8>(((5 - step) * value0 + step * value1) / 5);
+        }
+
+        outPalette[6] = 0;
+        outPalette[7] = 255;
+    }
+}
+
+// The bounds of the channel are exact endpoints, the 8 value mode then leaves at most 1/14th of the range of error.
+void EncodeChannelBlock(const u8* texels, u32 channel, u8* outBlock)
+{
+    u8 min = 255;
+    u8 max = 0;
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        min = std::min(min, texels[texel * 4 + channel]);
+        max = std::max(max, texels[texel * 4 + channel]);
+    }
+
+    u8 palette[8];
+    BuildChannelPalette(max, min, palette);
+
+    u64 indices = 0;
+
+    for (u32 texel = 0; texel < kTexelsPerBlock && max != min; ++texel)
+    {
+        const i32 value = texels[texel * 4 + channel];
+
+        u64 bestIndex = 0;
+
+        for (u64 index = 1; index < 8; ++index)
+        {
+            if (std::abs(palette[index] - value) < std::abs(palette[bestIndex] - value))
+            {
+                bestIndex = index;
+            }
+        }
+
+        indices |= bestIndex << (texel * 3);
+    }
+
+    outBlock[0] = max;
+    outBlock[1] = min;
+
+    for (u32 byte = 0; byte < 6; ++byte)
+    {
+        outBlock[byte + 2] = static_cast<u8>(indices >> (byte * 8));
+    }
+}
+
+void DecodeChannelBlock(const u8* block, u32 channel, u8* outTexels)
+{
+    u8 palette[8];
+    BuildChannelPalette(block[0], block[1], palette);
+
+    u64 indices = 0;
+
+    for (u32 byte = 0; byte < 6; ++byte)
+    {
+        indices |= static_cast<u64>(block[byte + 2]) << (byte * 8);
+    }
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        outTexels[texel * 4 + channel] = palette[(indices >> (texel * 3)) & 7];
+    }
+}
+
+//// BC7 mode 6
+
+// Fields are packed from the least significant bit of the first byte.
+struct BitWriter
+{
+    u8* block;
+    u32 position = 0;
+
+    void Write(u32 value, u32 numBits)
+    {
+        for (u32 bit = 0; bit < numBits; ++bit, ++position)
+        {
+            block[position / 8] |= static_cast<u8>(((value >> bit) & 1) << (position % 8));
+        }
+    }
+};
+
+struct BitReader
+{
+    const u8* block;
+    u32       position = 0;
+
+    u32 Read(u32 numBits)
+    {
+        u32 value = 0;
+
+        for (u32 bit = 0; bit < numBits; ++bit, ++position)
+        {
+            value |= ((block[position / 8] >> (position % 8)) & 1) << bit;
+        }
+
+        return value;
+    }
+};
+
+using BC7Endpoint = std::array<u8, 4>;
+
+// Mode 6 endpoints are 7 bits per channel plus a p-bit shared by the channels, which picks the lowest bit of all of them.
+BC7Endpoint QuantizeBC7Endpoint(const Point<4>& endpoint)
+{
+    BC7Endpoint best {};
+    f32         bestError = std::numeric_limits<f32>::max();
+
+    for (u32 pBit = 0; pBit < 2; ++pBit)
+    {
+        BC7Endpoint quantized;
+        f32         error = 0.f;
+
+        for (u32 channel = 0; channel < 4; ++channel)
+        {
+            const u32 value = std::min(static_cast<u32>(std::max(endpoint[channel] - pBit, 0.f) / 2.f + 0.5f), 127u);
+
+            quantized[channel] = static_cast<u8>((value << 1) | pBit);
+            error += (quantized[channel] - endpoint[channel]) * (quantized[channel] - endpoint[channel]);
+        }
+
+        if (error < bestError)
+        {
+            best      = quantized;
+            bestError = error;
+        }
+    }
+
+    return best;
+}
+
+f32 FindBC7Indices(const Point<4>* texels, const BC7Endpoint& endpoint0, const BC7Endpoint& endpoint1, u8* outIndices)
+{
+    Point<4> palette[16];
+
+    for (u32 index = 0; index < 16; ++index)
+    {
+        for (u32 channel = 0; channel < 4; ++channel)
+        {
+            palette[index][channel] =
+                static_cast<f32>(((64 - kBC7Weights[index]) * endpoint0[channel] + kBC7Weights[index] * endpoint1[channel] + 32) >> 6);
+        }
+    }
+
+    f32 error = 0.f;
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        u8  bestIndex = 0;
+        f32 bestError = std::numeric_limits<f32>::max();
+
+        for (u8 index = 0; index < 16; ++index)
+        {
+            const f32 indexError = SquaredDistance(texels[texel], palette[index]);
+
+            if (indexError < bestError)
+            {
+                bestIndex = index;
+                bestError = indexError;
+            }
+        }
+
+        outIndices[texel] = bestIndex;
+        error += bestError;
+    }
+
+    return error;
+}
+
+void EncodeBC7Block(const u8* texels, u8* outBlock)
+{
+    Point<4> points[kTexelsPerBlock];
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        points[texel] = ToPoint<4>(texels + texel * 4);
+    }
+
+    Point<4> low;
+    Point<4> high;
+    FitEndpoints(points, low, high);
+
+    BC7Endpoint endpoint0 = QuantizeBC7Endpoint(low);
+    BC7Endpoint endpoint1 = QuantizeBC7Endpoint(high);
+    u8          indices[kTexelsPerBlock];
+    f32         error = FindBC7Indices(points, endpoint0, endpoint1, indices);
+
+    f32 weights[kTexelsPerBlock];
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        weights[texel] = kBC7Weights[indices[texel]] / 64.f;
+    }
+
+    if (RefineEndpoints(points, weights, low, high))
+    {
+        const BC7Endpoint refinedEndpoint0 = QuantizeBC7Endpoint(low);
+        const BC7Endpoint refinedEndpoint1 = QuantizeBC7Endpoint(high);
+        u8                refinedIndices[kTexelsPerBlock];
+
+        if (FindBC7Indices(points, refinedEndpoint0, refinedEndpoint1, refinedIndices) < error)
+        {
+            endpoint0 = refinedEndpoint0;
+            endpoint1 = refinedEndpoint1;
+            memcpy(indices, refinedIndices, sizeof(indices));
+        }
+    }
+
+    // The highest bit of the first index is implicitly 0, swapping the endpoints mirrors the indices.
+    if (indices[0] >= 8)
+    {
+        std::swap(endpoint0, endpoint1);
+
+        for (u8& index : indices)
+        {
+            index = 15 - index;
+        }
+    }
+
+    memset(outBlock, 0, 16);
+
+    BitWriter writer {.block = outBlock};
+    writer.Write(1 << 6, 7);
+
+    for (u32 channel = 0; channel < 4; ++channel)
+    {
+        writer.Write(endpoint0[channel] >> 1, 7);
+        writer.Write(endpoint1[channel] >> 1, 7);
+    }
+
+    writer.Write(endpoint0[0] & 1, 1);
+    writer.Write(endpoint1[0] & 1, 1);
+    writer.Write(indices[0], 3);
+
+    for (u32 texel = 1; texel < kTexelsPerBlock; ++texel)
+    {
+        writer.Write(indices[texel], 4);
+    }
+}
+
+void DecodeBC7Block(const u8* block, u8* outTexels)
+{
+    if ((block[0] & 0x7F) != 0x40)
+    {
+        memset(outTexels, 0, kTexelsPerBlock * 4);
+        return;
+    }
+
+    BitReader reader {.block = block, .position = 7};
+
+    BC7Endpoint endpoint0;
+    BC7Endpoint endpoint1;
+
+    for (u32 channel = 0; channel < 4; ++channel)
+    {
+        endpoint0[channel] = static_cast<u8>(reader.Read(7) << 1);
+        endpoint1[channel] = static_cast<u8>(reader.Read(7) << 1);
+    }
+
+    const u32 pBit0 = reader.Read(1);
+    const u32 pBit1 = reader.Read(1);
+
+    for (u32 channel = 0; channel < 4; ++channel)
+    {
+        endpoint0[channel] |= pBit0;
+        endpoint1[channel] |= pBit1;
+    }
+
+    for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+    {
+        const u32 weight = kBC7Weights[reader.Read(texel == 0 ? 3 : 4)];
+
+        for (u32 channel = 0; channel < 4; ++channel)
+        {
+            outTexels[texel * 4 + channel] = static_cast<u8>(((64 - weight) * endpoint0[channel] + weight * endpoint1[channel] + 32) >> 6);
+        }
+    }
+}
+
+// Runs function(levelWidth, levelHeight, blockX, blockY, levelOffset, blockOffset) on every block of every level, levelOffset
+// being the offset of the level in RGBA8 and blockOffset in blocks. Rows of blocks are split on the workers.
+template<typename TFunction>
+void ForEachBlock(u32 width, u32 height, u32 numMips, TextureCompression compression, TFunction&& function)
+{
+    ThreadPool& workerPool = ThreadPool::GetWorkerPool();
+
+    sizet levelOffset = 0;
+    sizet blockOffset = 0;
+
+    for (u32 mip = 0; mip < numMips; ++mip)
+    {
+        const u32 levelWidth  = TextureMipGenerator::GetMipWidth(width, mip);
+        const u32 levelHeight = TextureMipGenerator::GetMipHeight(height, mip);
+        const u32 numBlocksX  = GetNumBlocks(levelWidth);
+        const u32 numBlocksY  = GetNumBlocks(levelHeight);
+
+        const u32 rowsPerTask = std::max(kMinBlocksPerTask / numBlocksX, 1u);
+        const u32 numTasks    = (numBlocksY + rowsPerTask - 1) / rowsPerTask;
+
+        workerPool.ParallelFor(numTasks,
+                               [&](sizet task)
+                               {
+                                   const u32 firstRow = static_cast<u32>(task) * rowsPerTask;
+                                   const u32 lastRow  = std::min(firstRow + rowsPerTask, numBlocksY);
+
+                                   for (u32 blockY = firstRow; blockY < lastRow; ++blockY)
+                                   {
+                                       for (u32 blockX = 0; blockX < numBlocksX; ++blockX)
+                                       {
+                                           function(levelWidth, levelHeight, blockX, blockY, levelOffset, blockOffset);
+                                       }
+                                   }
+                               });
+
+        levelOffset += TextureCompressor::CalculateLevelSize(TextureCompression::None, levelWidth, levelHeight);
+        blockOffset += TextureCompressor::CalculateLevelSize(compression, levelWidth, levelHeight);
+    }
+}
+} // namespace
+
+u32 Zn::TextureCompressor::GetBlockSize(TextureCompression compression)
+{
+    switch (compression)
+    {
+    case TextureCompression::BC1:
+        return 8;
+    case TextureCompression::BC3:
+    case TextureCompression::BC5:
+    case TextureCompression::BC7:
+        return 16;
+    case TextureCompression::None:
+    case TextureCompression::COUNT:
+    default:
+        return 0;
+    }
+}
+
+sizet Zn::TextureCompressor::CalculateLevelSize(TextureCompression compression, u32 width, u32 height)
+{
+    if (compression == TextureCompression::None)
+    {
+        return static_cast<sizet>(width) * height * 4;
+    }
+
+    return static_cast<sizet>(GetNumBlocks(width)) * GetNumBlocks(height) * GetBlockSize(compression);
+}
+
+sizet Zn::TextureCompressor::CalculateMipChainSize(TextureCompression compression, u32 width, u32 height, u32 numMips)
+{
+    sizet size = 0;
+
+    for (u32 mip = 0; mip < numMips; ++mip)
+    {
+        const u32 levelWidth  = TextureMipGenerator::GetMipWidth(width, mip);
+        const u32 levelHeight = TextureMipGenerator::GetMipHeight(height, mip);
+
+        size += CalculateLevelSize(compression, levelWidth, levelHeight);
+    }
+
+    return size;
+}
+
+Vector<u8> Zn::TextureCompressor::Compress(std::span<const u8> pixels, u32 width, u32 height, u32 numMips, TextureCompression compression)
+{
+    if (compression == TextureCompression::None)
+    {
+        return Vector<u8>(pixels.begin(), pixels.end());
+    }
+
+    Vector<u8> blocks(CalculateMipChainSize(compression, width, height, numMips));
+
+    Compress(pixels, width, height, numMips, compression, blocks);
+
+    return blocks;
+}
+
+void Zn::TextureCompressor::Compress(
+    std::span<const u8> pixels, u32 width, u32 height, u32 numMips, TextureCompression compression, std::span<u8> outBlocks)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    const sizet size = CalculateMipChainSize(compression, width, height, numMips);
+
+    check(pixels.size() >= CalculateMipChainSize(TextureCompression::None, width, height, numMips));
+    check(outBlocks.size() >= size);
+
+    if (compression == TextureCompression::None)
+    {
+        memcpy(outBlocks.data(), pixels.data(), size);
+        return;
+    }
+
+    const u32 blockSize = GetBlockSize(compression);
+
+    ForEachBlock(width,
+                 height,
+                 numMips,
+                 compression,
+                 [&](u32 levelWidth, u32 levelHeight, u32 blockX, u32 blockY, sizet levelOffset, sizet blockOffset)
+                 {
+                     u8 texels[kTexelsPerBlock * 4];
+                     LoadBlock(pixels.data() + levelOffset, levelWidth, levelHeight, blockX, blockY, texels);
+
+                     const sizet block = static_cast<sizet>(blockY) * GetNumBlocks(levelWidth) + blockX;
+
+                     EncodeBlock(compression, texels, outBlocks.data() + blockOffset + block * blockSize);
+                 });
+}
+
+Vector<u8> Zn::TextureCompressor::Decompress(std::span<const u8> blocks, u32 width, u32 height, u32 numMips, TextureCompression compression)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    check(blocks.size() >= CalculateMipChainSize(compression, width, height, numMips));
+
+    if (compression == TextureCompression::None)
+    {
+        return Vector<u8>(blocks.begin(), blocks.end());
+    }
+
+    const u32 blockSize = GetBlockSize(compression);
+
+    Vector<u8> pixels(CalculateMipChainSize(TextureCompression::None, width, height, numMips));
+
+    ForEachBlock(width,
+                 height,
+                 numMips,
+                 compression,
+                 [&](u32 levelWidth, u32 levelHeight, u32 blockX, u32 blockY, sizet levelOffset, sizet blockOffset)
+                 {
+                     const sizet block = static_cast<sizet>(blockY) * GetNumBlocks(levelWidth) + blockX;
+
+                     u8 texels[kTexelsPerBlock * 4];
+                     DecodeBlock(compression, blocks.data() + blockOffset + block * blockSize, texels);
+
+                     StoreBlock(texels, levelWidth, levelHeight, blockX, blockY, pixels.data() + levelOffset);
+                 });
+
+    return pixels;
+}
+
+void Zn::TextureCompressor::EncodeBlock(TextureCompression compression, const u8* texels, u8* outBlock)
+{
+    switch (compression)
+    {
+    case TextureCompression::BC1:
+        EncodeColorBlock(texels, outBlock);
+        break;
+    case TextureCompression::BC3:
+        EncodeChannelBlock(texels, 3, outBlock);
+        EncodeColorBlock(texels, outBlock + 8);
+        break;
+    case TextureCompression::BC5:
+        EncodeChannelBlock(texels, 0, outBlock);
+        EncodeChannelBlock(texels, 1, outBlock + 8);
+        break;
+    case TextureCompression::BC7:
+        EncodeBC7Block(texels, outBlock);
+        break;
+    case TextureCompression::None:
+    case TextureCompression::COUNT:
+    default:
+        check(false);
+        break;
+    }
+}
+
+void Zn::TextureCompressor::DecodeBlock(TextureCompression compression, const u8* block, u8* outTexels)
+{
+    switch (compression)
+    {
+    case TextureCompression::BC1:
+        DecodeColorBlock(block, true, outTexels);
+        break;
+    case TextureCompression::BC3:
+        DecodeColorBlock(block + 8, false, outTexels);
+        DecodeChannelBlock(block, 3, outTexels);
+        break;
+    case TextureCompression::BC5:
+        // Sampled as (r, g, 0, 1).
+        for (u32 texel = 0; texel < kTexelsPerBlock; ++texel)
+        {
+            outTexels[texel * 4 + 2] = 0;
+            outTexels[texel * 4 + 3] = 255;
+        }
+
+        DecodeChannelBlock(block, 0, outTexels);
+        DecodeChannelBlock(block + 8, 1, outTexels);
+        break;
+    case TextureCompression::BC7:
+        DecodeBC7Block(block, outTexels);
+        break;
+    case TextureCompression::None:
+    case TextureCompression::COUNT:
+    default:
+        check(false);
+        break;
+    }
+}
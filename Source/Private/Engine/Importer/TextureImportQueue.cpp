@@ -0,0 +1,172 @@
+#include <Znpch.h>
+#include <Engine/Importer/TextureImportQueue.h>
+#include <Engine/Importer/TextureMipGenerator.h>
+#include <Core/Async/ThreadPool.h>
+#include <Core/IO/IO.h>
+#include <Core/CommandLine.h>
+
+using namespace Zn;
+
+namespace
+{
+constexpr sizet kDefaultBudget = 256ull * 1024 * 1024;
+
+struct CompletedImport
+{
+    sizet index      = 0;
+    bool  bSucceeded = false;
+};
+} // namespace
+
+sizet Zn::TextureImportQueue::GetDefaultBudget()
+{
+    if (String budgetValue; CommandLine::Get().Value("-textureImportBudget", budgetValue))
+    {
+        return std::strtoull(budgetValue.c_str(), nullptr, 10) * 1024 * 1024;
+    }
+
+    return kDefaultBudget;
+}
+
+Zn::TextureImportQueue::TextureImportQueue(sizet budget_)
+    : budget(budget_)
+{
+}
+
+sizet Zn::TextureImportQueue::Add(const String& path, const TextureImportSettings& settings)
+{
+    requests.push_back(Request {.path = path, .settings = settings});
+
+    return requests.size() - 1;
+}
+
+bool Zn::TextureImportQueue::Run(const AllocateFunction& allocate, const CompleteFunction& complete)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    ThreadPool& workerPool = ThreadPool::GetWorkerPool();
+
+    Vector<String> paths;
+    paths.reserve(requests.size());
+
+    for (const Request& request : requests)
+    {
+        paths.push_back(request.path);
+    }
+
+    // The sources are read on the IO threads in the order the workers open them, so reading overlaps hashing.
+    Vector<std::future<IOReadResult>> reads = IO::ReadBinaryFilesAsync(paths);
+
+    // Opening hashes the whole source to look it up in the cache, as much work as some decodes.
+    workerPool.ParallelFor(requests.size(),
+                           [this, &reads](sizet index)
+                           {
+                               Request&     request = requests[index];
+                               IOReadResult read    = reads[index].get();
+
+                               request.bOpened = read.success && request.job.Open(std::move(read.file), request.settings);
+                           });
+
+    std::mutex              mutex;
+    std::condition_variable condition;
+    Vector<CompletedImport> completedImports;
+    Vector<CompletedImport> finishedImports;
+
+    sizet nextRequest   = 0;
+    sizet numInFlight   = 0;
+    sizet bytesInFlight = 0;
+    bool  bSucceeded    = true;
+
+    peakBytesInFlight = 0;
+
+    while (nextRequest < requests.size() || numInFlight > 0)
+    {
+        for (; nextRequest < requests.size(); ++nextRequest)
+        {
+            const Request&            request     = requests[nextRequest];
+            const TextureDescription& description = request.job.GetDescription();
+
+            if (!request.bOpened)
+            {
+                complete(nextRequest, description, false);
+                bSucceeded = false;
+                continue;
+            }
+
+            const sizet cost = GetCost(description);
+
+            if (numInFlight > 0 && bytesInFlight + cost > budget)
+            {
+                break;
+            }
+
+            const std::span<u8> destination = allocate(nextRequest, description);
+
+            bytesInFlight += cost;
+            ++numInFlight;
+
+            peakBytesInFlight = std::max(peakBytesInFlight, bytesInFlight);
+
+            workerPool.Enqueue(
+                [this, &mutex, &condition, &completedImports, index = nextRequest, destination]()
+                {
+                    const bool bImported = requests[index].job.ImportTo(destination);
+
+                    std::lock_guard lock(mutex);
+                    completedImports.push_back(CompletedImport {.index = index, .bSucceeded = bImported});
+                    condition.notify_one();
+                });
+        }
+
+        if (numInFlight == 0)
+        {
+            continue;
+        }
+
+        // Help with the queue while waiting, the imports split their levels on the workers too.
+        while (finishedImports.empty())
+        {
+            {
+                std::unique_lock lock(mutex);
+
+                if (!completedImports.empty())
+                {
+                    std::swap(finishedImports, completedImports);
+                    break;
+                }
+            }
+
+            if (!workerPool.TryRunPendingTask())
+            {
+                std::unique_lock lock(mutex);
+                condition.wait(lock,
+                               [&completedImports]()
+                               {
+                                   return !completedImports.empty();
+                               });
+            }
+        }
+
+        for (const CompletedImport& completedImport : finishedImports)
+        {
+            const TextureDescription& description = requests[completedImport.index].job.GetDescription();
+
+            complete(completedImport.index, description, completedImport.bSucceeded);
+
+            bSucceeded &= completedImport.bSucceeded;
+            bytesInFlight -= GetCost(description);
+            --numInFlight;
+        }
+
+        finishedImports.clear();
+    }
+
+    requests.clear();
+
+    return bSucceeded;
+}
+
+sizet Zn::TextureImportQueue::GetCost(const TextureDescription& description) const
+{
+    return TextureMipGenerator::CalculateMipChainSize(description.width, description.height, description.numMips) + description.size;
+}
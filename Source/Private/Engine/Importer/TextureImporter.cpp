@@ -1,8 +1,14 @@
 #include <Znpch.h>
 
 #include <Engine/Importer/TextureImporter.h>
+#include <Engine/Importer/TextureCompressor.h>
+#include <Engine/Importer/TextureMipGenerator.h>
+#include <Core/IO/DerivedDataCache.h>
+#include <Core/IO/IO.h>
+#include <Core/CommandLine.h>
 
 #include <stb_image.h>
+#include <utility>
 
 using namespace Zn;
 
@@ -16,9 +22,15 @@ struct STBILoader
     i32 size     = 0;
     u8* data     = nullptr;
 
-    STBILoader(const String& path)
+    STBILoader(const MappedFile& file)
     {
-        data = stbi_load(path.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+        // Decode straight from the mapped file, stdio would copy it through its own buffers first.
+        if (!file || file.GetSize() > static_cast<sizet>(i32_max))
+        {
+            return;
+        }
+
+        data = stbi_load_from_memory(file.GetData(), static_cast<i32>(file.GetSize()), &width, &height, &channels, STBI_rgb_alpha);
 
         if (data)
         {
@@ -39,21 +51,333 @@ struct STBILoader
         return data != nullptr;
     }
 };
+
+// Cooked texture as stored in the derived data cache, followed by every mip in the compression format. Uploaded as is.
+struct CachedTextureHeader
+{
+    u32                magic;
+    u32                version;
+    i32                width;
+    i32                height;
+    i32                channels;
+    u32                numMips;
+    TextureCompression compression;
+    u8                 padding[7];
+    u64                size;
+};
+
+constexpr u32 kCachedTextureMagic = 0x5845545A; // ZTEX
+
+// Returns the header of the cached texture, nullptr if it doesn't match the texels that follow it.
+const CachedTextureHeader* FindCachedTextureHeader(const MappedFile& cachedFile)
+{
+    if (!cachedFile || cachedFile.GetSize() < sizeof(CachedTextureHeader))
+    {
+        return nullptr;
+    }
+
+    const CachedTextureHeader* header = reinterpret_cast<const CachedTextureHeader*>(cachedFile.GetData());
+
+    if (header->magic != kCachedTextureMagic || header->version != TextureImporter::kImporterVersion || header->width <= 0 ||
+        header->height <= 0 || header->compression >= TextureCompression::COUNT ||
+        header->size != cachedFile.GetSize() - sizeof(CachedTextureHeader) ||
+        header->size != TextureCompressor::CalculateMipChainSize(header->compression, header->width, header->height, header->numMips))
+    {
+        return nullptr;
+    }
+
+    return header;
+}
+
+CachedTextureHeader MakeCachedTextureHeader(const TextureDescription& description)
+{
+    return CachedTextureHeader {
+        .magic       = kCachedTextureMagic,
+        .version     = TextureImporter::kImporterVersion,
+        .width       = description.width,
+        .height      = description.height,
+        .channels    = description.channels,
+        .numMips     = description.numMips,
+        .compression = description.compression,
+        .padding     = {},
+        .size        = description.size,
+    };
+}
 } // namespace
 
-SharedPtr<TextureSource> Zn::TextureImporter::Import(const String& path)
+Zn::TextureBuffer::TextureBuffer(Vector<u8>&& data_)
+    : vector(std::move(data_))
+    , data(vector.data())
+    , size(vector.size())
+{
+}
+
+Zn::TextureBuffer::TextureBuffer(u8* data_, sizet size_, Deleter deleter_)
+    : data(data_)
+    , size(size_)
+    , deleter(deleter_)
+{
+}
+
+TextureBuffer Zn::TextureBuffer::Allocate(sizet size)
+{
+    return TextureBuffer(new u8[size],
+                         size,
+                         [](void* data)
+                         {
+                             delete[] static_cast<u8*>(data);
+                         });
+}
+
+Zn::TextureBuffer::~TextureBuffer()
+{
+    Reset();
+}
+
+Zn::TextureBuffer::TextureBuffer(TextureBuffer&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+TextureBuffer& Zn::TextureBuffer::operator=(TextureBuffer&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+
+        // Moving a vector keeps its storage, data still points to it.
+        vector  = std::move(other.vector);
+        data    = std::exchange(other.data, nullptr);
+        size    = std::exchange(other.size, 0);
+        deleter = std::exchange(other.deleter, nullptr);
+    }
+
+    return *this;
+}
+
+void Zn::TextureBuffer::Reset()
+{
+    if (deleter)
+    {
+        deleter(data);
+    }
+
+    vector.clear();
+    vector.shrink_to_fit();
+
+    data    = nullptr;
+    size    = 0;
+    deleter = nullptr;
+}
+
+SharedPtr<TextureSource> Zn::TextureImporter::Import(const String& path, const TextureImportSettings& settings)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    TextureImportJob job;
+
+    if (!job.Open(path, settings))
+    {
+        return nullptr;
+    }
+
+    const TextureDescription& description = job.GetDescription();
+
+    SharedPtr<TextureSource> texture(new TextureSource {
+        .width       = description.width,
+        .height      = description.height,
+        .channels    = description.channels,
+        .data        = TextureBuffer::Allocate(description.size),
+        .numMips     = description.numMips,
+        .compression = description.compression,
+    });
+
+    return job.ImportTo(texture->data.GetView()) ? texture : nullptr;
+}
+
+void Zn::TextureImporter::GenerateMips(TextureSource& texture, const TextureImportSettings& settings)
+{
+    const sizet level0Size = static_cast<sizet>(texture.width) * texture.height * 4;
+    const u32   numMips    = TextureMipGenerator::CalculateNumMips(texture.width, texture.height);
+
+    check(texture.numMips == 1 && texture.data.GetSize() >= level0Size);
+
+    TextureBuffer mipChain = TextureBuffer::Allocate(TextureMipGenerator::CalculateMipChainSize(texture.width, texture.height, numMips));
+
+    memcpy(mipChain.GetData(), texture.data.GetData(), level0Size);
+
+    TextureMipGenerator::Generate(
+        texture.data.GetView().first(level0Size), texture.width, texture.height, settings, mipChain.GetView().subspan(level0Size));
+
+    texture.data    = std::move(mipChain);
+    texture.numMips = numMips;
+}
+
+void Zn::TextureImporter::Compress(TextureSource& texture, const TextureImportSettings& settings)
+{
+    if (settings.compression == TextureCompression::None || texture.compression != TextureCompression::None)
+    {
+        return;
+    }
+
+    TextureBuffer blocks = TextureBuffer::Allocate(
+        TextureCompressor::CalculateMipChainSize(settings.compression, texture.width, texture.height, texture.numMips));
+
+    TextureCompressor::Compress(
+        texture.data.GetView(), texture.width, texture.height, texture.numMips, settings.compression, blocks.GetView());
+
+    texture.data        = std::move(blocks);
+    texture.compression = settings.compression;
+}
+
+TextureCompression Zn::TextureImporter::SelectCompression(TextureUsage usage)
+{
+    if (CommandLine::Get().Param("-noTextureCompression"))
+    {
+        return TextureCompression::None;
+    }
+
+    const bool bHighQuality = CommandLine::Get().Param("-highQualityTextures");
+
+    switch (usage)
+    {
+    case TextureUsage::Color:
+        return bHighQuality ? TextureCompression::BC7 : TextureCompression::BC1;
+    case TextureUsage::ColorAlpha:
+        return bHighQuality ? TextureCompression::BC7 : TextureCompression::BC3;
+    case TextureUsage::Normal:
+        return TextureCompression::BC5;
+    case TextureUsage::Linear:
+        return TextureCompression::BC1;
+    case TextureUsage::COUNT:
+    default:
+        return TextureCompression::None;
+    }
+}
+
+bool Zn::TextureImportJob::Open(const String& path, const TextureImportSettings& settings_)
+{
+    return Open(IO::MapFile(path), settings_);
+}
+
+bool Zn::TextureImportJob::Open(MappedFile&& source, const TextureImportSettings& settings_)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    settings = settings_;
+    file     = std::move(source);
+
+    if (!file || file.GetSize() > static_cast<sizet>(i32_max))
+    {
+        return false;
+    }
+
+    // Every texture is decoded to RGBA8, the mips and their compression depend on the settings.
+    key = HashCombine(HashCalculate("TextureImporter"),
+                      HashCalculate(TextureImporter::kImporterVersion),
+                      HashCalculate(STBI_rgb_alpha),
+                      HashBytes(&settings, sizeof(TextureImportSettings)),
+                      HashBytes(file.GetData(), file.GetSize()));
+
+    if (DerivedDataCache& cache = DerivedDataCache::Get(); cache.IsEnabled())
+    {
+        cachedFile = cache.Load(key);
+
+        if (const CachedTextureHeader* header = FindCachedTextureHeader(cachedFile))
+        {
+            description = TextureDescription {
+                .width       = header->width,
+                .height      = header->height,
+                .channels    = header->channels,
+                .numMips     = header->numMips,
+                .compression = header->compression,
+                .size        = header->size,
+            };
+
+            return true;
+        }
+
+        cachedFile = MappedFile();
+    }
+
+    i32 width    = 0;
+    i32 height   = 0;
+    i32 channels = 0;
+
+    // Only parses the header, the texels are decoded by ImportTo.
+    if (!stbi_info_from_memory(file.GetData(), static_cast<i32>(file.GetSize()), &width, &height, &channels) || width <= 0 || height <= 0)
+    {
+        return false;
+    }
+
+    const u32 numMips = TextureMipGenerator::CalculateNumMips(width, height);
+
+    description = TextureDescription {
+        .width       = width,
+        .height      = height,
+        .channels    = channels,
+        .numMips     = numMips,
+        .compression = settings.compression,
+        .size        = TextureCompressor::CalculateMipChainSize(settings.compression, width, height, numMips),
+    };
+
+    return true;
+}
+
+bool Zn::TextureImportJob::ImportTo(std::span<u8> destination) const
 {
-    const STBILoader loader(path);
+    ZN_TRACE_QUICKSCOPE();
+
+    check(destination.size() >= description.size);
 
-    if (loader)
+    if (cachedFile)
     {
-        return SharedPtr<TextureSource>(new TextureSource {
-            .width    = loader.width,
-            .height   = loader.height,
-            .channels = loader.channels,
-            .data     = Vector<u8>(loader.data, loader.data + loader.size),
-        });
+        memcpy(destination.data(), cachedFile.GetData() + sizeof(CachedTextureHeader), description.size);
+        return true;
     }
 
-    return nullptr;
+    const STBILoader loader(file);
+
+    if (!loader || loader.width != description.width || loader.height != description.height)
+    {
+        return false;
+    }
+
+    // The levels are built apart: the destination is usually write-combined staging memory, reading it back for the cache would be
+    // slow. It is then written once, sequentially.
+    TextureBuffer       levelsBuffer = TextureBuffer::Allocate(description.size);
+    const std::span<u8> levels       = levelsBuffer.GetView();
+
+    const std::span<const u8> level0(loader.data, loader.size);
+
+    if (description.compression == TextureCompression::None)
+    {
+        memcpy(levels.data(), level0.data(), level0.size());
+        TextureMipGenerator::Generate(level0, description.width, description.height, settings, levels.subspan(level0.size()));
+    }
+    else
+    {
+        Vector<u8> pixels(TextureMipGenerator::CalculateMipChainSize(description.width, description.height, description.numMips));
+
+        memcpy(pixels.data(), level0.data(), level0.size());
+        TextureMipGenerator::Generate(
+            level0, description.width, description.height, settings, std::span(pixels).subspan(level0.size()));
+        TextureCompressor::Compress(pixels, description.width, description.height, description.numMips, description.compression, levels);
+    }
+
+    if (DerivedDataCache& cache = DerivedDataCache::Get(); cache.IsEnabled())
+    {
+        const CachedTextureHeader header = MakeCachedTextureHeader(description);
+
+        const std::span<const u8> parts[] = {
+            std::span(reinterpret_cast<const u8*>(&header), sizeof(CachedTextureHeader)),
+            levels,
+        };
+
+        cache.Store(key, parts);
+    }
+
+    memcpy(destination.data(), levels.data(), levels.size());
+
+    return true;
 }
@@ -0,0 +1,397 @@
+#include <Znpch.h>
+#include <Engine/Importer/TextureMipGenerator.h>
+#include <Engine/Importer/TextureImporter.h>
+#include <Core/Async/ThreadPool.h>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ZN_TEXTURE_MIP_GENERATOR_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define ZN_TEXTURE_MIP_GENERATOR_SSE2 0
+#endif
+
+using namespace Zn;
+
+namespace
+{
+// Rows of a level are handed to the workers in blocks of at least this many texels.
+static constexpr u32 kMinTexelsPerTask = 16 * 1024;
+
+// Halving a size covers 2 texels of the previous level, 3 when the previous size is odd.
+static constexpr u32 kMaxTaps = 3;
+
+// Texels of the previous level covered by a texel along one axis.
+struct FilterTaps
+{
+    u32 first             = 0;
+    u32 count             = 0;
+    f32 weights[kMaxTaps] = {};
+};
+
+// Texel bounds are compared in units of 1 / dstSize source texels, so that the weights are the exact overlaps.
+Vector<FilterTaps> ComputeFilterTaps(u32 srcSize, u32 dstSize)
+{
+    Vector<FilterTaps> taps(dstSize);
+
+    for (u32 dst = 0; dst < dstSize; ++dst)
+    {
+        const u64 begin = static_cast<u64>(dst) * srcSize;
+        const u64 end   = begin + srcSize;
+
+        FilterTaps& tap = taps[dst];
+        tap.first       = static_cast<u32>(begin / dstSize);
+
+        for (u64 src = tap.first; src * dstSize < end; ++src)
+        {
+            check(tap.count < kMaxTaps);
+
+            const u64 overlap = std::min(end, (src + 1) * dstSize) - std::max(begin, src * dstSize);
+
+            tap.weights[tap.count++] = static_cast<f32>(overlap) / srcSize;
+        }
+    }
+
+    return taps;
+}
+
+f32 SRGBToLinear(f32 value)
+{
+    return value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+}
+
+struct ColorTables
+{
+    f32 unormToFloat[256];
+    f32 srgbToLinear[256];
+
+    // Smallest linear value encoded as each sRGB value, rounding to the nearest in sRGB space. The first entry is unused.
+    f32 srgbThresholds[256];
+
+    ColorTables()
+    {
+        for (u32 value = 0; value < 256; ++value)
+        {
+            unormToFloat[value]   = value / 255.f;
+            srgbToLinear[value]   = SRGBToLinear(value / 255.f);
+            srgbThresholds[value] = value > 0 ? SRGBToLinear((value - 0.5f) / 255.f) : 0.f;
+        }
+    }
+};
+
+const ColorTables& GetColorTables()
+{
+    static const ColorTables tables;
+    return tables;
+}
+
+u8 EncodeUnorm(f32 value)
+{
+    return static_cast<u8>(std::clamp(value, 0.f, 1.f) * 255.f + 0.5f);
+}
+
+u8 EncodeSRGB(const ColorTables& tables, f32 value)
+{
+    return static_cast<u8>(std::upper_bound(tables.srgbThresholds + 1, tables.srgbThresholds + 256, value) - (tables.srgbThresholds + 1));
+}
+
+#if ZN_TEXTURE_MIP_GENERATOR_SSE2
+// A RGBA texel in a single register.
+using Texel = __m128;
+
+Texel ZeroTexel()
+{
+    return _mm_setzero_ps();
+}
+
+Texel MakeTexel(f32 r, f32 g, f32 b, f32 a)
+{
+    return _mm_setr_ps(r, g, b, a);
+}
+
+Texel LoadTexel(const glm::vec4& texel)
+{
+    return _mm_loadu_ps(&texel.x);
+}
+
+void StoreTexel(glm::vec4& outTexel, Texel texel)
+{
+    _mm_storeu_ps(&outTexel.x, texel);
+}
+
+Texel MultiplyAdd(Texel sum, Texel texel, f32 weight)
+{
+    return _mm_add_ps(sum, _mm_mul_ps(texel, _mm_set1_ps(weight)));
+}
+#else
+using Texel = glm::vec4;
+
+Texel ZeroTexel()
+{
+    return glm::vec4(0.f);
+}
+
+Texel MakeTexel(f32 r, f32 g, f32 b, f32 a)
+{
+    return glm::vec4(r, g, b, a);
+}
+
+Texel LoadTexel(const glm::vec4& texel)
+{
+    return texel;
+}
+
+void StoreTexel(glm::vec4& outTexel, Texel texel)
+{
+    outTexel = texel;
+}
+
+Texel MultiplyAdd(Texel sum, Texel texel, f32 weight)
+{
+    return sum + texel * weight;
+}
+#endif
+
+// Level 0, decoded to linear float as it is read so that it is never converted as a whole.
+struct ByteLevel
+{
+    const u8*  pixels;
+    u32        width;
+    const f32* colorTable;
+    const f32* alphaTable;
+
+    Texel Load(u32 x, u32 y) const
+    {
+        const u8* pixel = pixels + (static_cast<sizet>(y) * width + x) * 4;
+
+        return MakeTexel(colorTable[pixel[0]], colorTable[pixel[1]], colorTable[pixel[2]], alphaTable[pixel[3]]);
+    }
+};
+
+struct FloatLevel
+{
+    const glm::vec4* texels;
+    u32              width;
+
+    Texel Load(u32 x, u32 y) const
+    {
+        return LoadTexel(texels[static_cast<sizet>(y) * width + x]);
+    }
+};
+
+template<typename TLevel>
+void FilterRow(const TLevel& source, const FilterTaps& rowTaps, const Vector<FilterTaps>& columnTaps, glm::vec4* outRow)
+{
+    for (sizet x = 0; x < columnTaps.size(); ++x)
+    {
+        const FilterTaps& taps = columnTaps[x];
+
+        Texel sum = ZeroTexel();
+
+        for (u32 row = 0; row < rowTaps.count; ++row)
+        {
+            Texel rowSum = ZeroTexel();
+
+            for (u32 column = 0; column < taps.count; ++column)
+            {
+                rowSum = MultiplyAdd(rowSum, source.Load(taps.first + column, rowTaps.first + row), taps.weights[column]);
+            }
+
+            sum = MultiplyAdd(sum, rowSum, rowTaps.weights[row]);
+        }
+
+        StoreTexel(outRow[x], sum);
+    }
+}
+
+void EncodeRow(const glm::vec4* texels, u32 count, const ColorTables* srgbTables, f32 alphaScale, u8* outPixels)
+{
+    for (u32 x = 0; x < count; ++x)
+    {
+        const glm::vec4& texel = texels[x];
+        u8*              pixel = outPixels + x * 4;
+
+        for (u32 channel = 0; channel < 3; ++channel)
+        {
+            pixel[channel] = srgbTables ? EncodeSRGB(*srgbTables, texel[channel]) : EncodeUnorm(texel[channel]);
+        }
+
+        pixel[3] = EncodeUnorm(texel.w * alphaScale);
+    }
+}
+
+// Scaling alpha by s passes the texels whose alpha is at least alphaCutoff / s, so the scale is given by the alpha ranked at the
+// number of texels that have to pass.
+f32 CalculateAlphaScale(const Vector<glm::vec4>& texels, f32 alphaCutoff, f32 targetCoverage, Vector<f32>& scratch)
+{
+    const sizet numPassing = static_cast<sizet>(std::round(targetCoverage * texels.size()));
+
+    if (numPassing == 0)
+    {
+        return 1.f;
+    }
+
+    scratch.resize(texels.size());
+
+    for (sizet index = 0; index < texels.size(); ++index)
+    {
+        scratch[index] = texels[index].w;
+    }
+
+    std::nth_element(scratch.begin(), scratch.begin() + (numPassing - 1), scratch.end(), std::greater<f32>());
+
+    const f32 threshold = scratch[numPassing - 1];
+
+    return threshold > 0.f ? alphaCutoff / threshold : 1.f;
+}
+} // namespace
+
+u32 Zn::TextureMipGenerator::CalculateNumMips(u32 width, u32 height)
+{
+    u32 numMips = 1;
+
+    for (u32 size = std::max(width, height); size > 1; size >>= 1)
+    {
+        ++numMips;
+    }
+
+    return numMips;
+}
+
+sizet Zn::TextureMipGenerator::CalculateMipChainSize(u32 width, u32 height, u32 numMips)
+{
+    sizet size = 0;
+
+    for (u32 mip = 0; mip < numMips; ++mip)
+    {
+        size += static_cast<sizet>(GetMipWidth(width, mip)) * GetMipHeight(height, mip) * 4;
+    }
+
+    return size;
+}
+
+u32 Zn::TextureMipGenerator::Generate(Vector<u8>& inOutPixels, u32 width, u32 height, const TextureImportSettings& settings)
+{
+    const sizet level0Size = static_cast<sizet>(width) * height * 4;
+
+    check(width > 0 && height > 0 && inOutPixels.size() >= level0Size);
+
+    // Level 0 is read in place, nothing may reallocate the pixels past this point.
+    inOutPixels.resize(CalculateMipChainSize(width, height, CalculateNumMips(width, height)));
+
+    const std::span<u8> pixels(inOutPixels);
+
+    return Generate(pixels.first(level0Size), width, height, settings, pixels.subspan(level0Size));
+}
+
+u32 Zn::TextureMipGenerator::Generate(
+    std::span<const u8> level0, u32 width, u32 height, const TextureImportSettings& settings, std::span<u8> outLevels)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    const u32 numMips = CalculateNumMips(width, height);
+
+    check(width > 0 && height > 0 && level0.size() == static_cast<sizet>(width) * height * 4);
+    check(outLevels.size() >= CalculateMipChainSize(width, height, numMips) - static_cast<sizet>(width) * height * 4);
+
+    const ColorTables& tables         = GetColorTables();
+    const f32          targetCoverage = settings.bPreserveAlphaCoverage ? CalculateAlphaCoverage(level0, settings.alphaCutoff) : 0.f;
+
+    ThreadPool& workerPool = ThreadPool::GetWorkerPool();
+
+    Vector<glm::vec4> previousLevel;
+    Vector<glm::vec4> level;
+    Vector<f32>       scratch;
+
+    sizet levelOffset = 0;
+
+    for (u32 mip = 1; mip < numMips; ++mip)
+    {
+        const u32 sourceWidth  = GetMipWidth(width, mip - 1);
+        const u32 sourceHeight = GetMipHeight(height, mip - 1);
+        const u32 levelWidth   = GetMipWidth(width, mip);
+        const u32 levelHeight  = GetMipHeight(height, mip);
+
+        const Vector<FilterTaps> columnTaps = ComputeFilterTaps(sourceWidth, levelWidth);
+        const Vector<FilterTaps> rowTaps    = ComputeFilterTaps(sourceHeight, levelHeight);
+
+        const u32 rowsPerTask = std::max(kMinTexelsPerTask / levelWidth, 1u);
+        const u32 numTasks    = (levelHeight + rowsPerTask - 1) / rowsPerTask;
+
+        level.resize(static_cast<sizet>(levelWidth) * levelHeight);
+
+        auto FilterLevel = [&](const auto& source)
+        {
+            workerPool.ParallelFor(numTasks,
+                                   [&](sizet task)
+                                   {
+                                       const u32 firstRow = static_cast<u32>(task) * rowsPerTask;
+                                       const u32 lastRow  = std::min(firstRow + rowsPerTask, levelHeight);
+
+                                       for (u32 y = firstRow; y < lastRow; ++y)
+                                       {
+                                           FilterRow(source, rowTaps[y], columnTaps, level.data() + static_cast<sizet>(y) * levelWidth);
+                                       }
+                                   });
+        };
+
+        if (mip == 1)
+        {
+            FilterLevel(ByteLevel {
+                .pixels     = level0.data(),
+                .width      = sourceWidth,
+                .colorTable = settings.bSRGB ? tables.srgbToLinear : tables.unormToFloat,
+                .alphaTable = tables.unormToFloat,
+            });
+        }
+        else
+        {
+            FilterLevel(FloatLevel {.texels = previousLevel.data(), .width = sourceWidth});
+        }
+
+        // The scale only applies to the stored level, the next one is filtered from the original alpha.
+        const f32 alphaScale =
+            settings.bPreserveAlphaCoverage ? CalculateAlphaScale(level, settings.alphaCutoff, targetCoverage, scratch) : 1.f;
+
+        u8* const levelPixels = outLevels.data() + levelOffset;
+
+        workerPool.ParallelFor(numTasks,
+                               [&](sizet task)
+                               {
+                                   const u32   firstRow = static_cast<u32>(task) * rowsPerTask;
+                                   const u32   lastRow  = std::min(firstRow + rowsPerTask, levelHeight);
+                                   const sizet first    = static_cast<sizet>(firstRow) * levelWidth;
+
+                                   EncodeRow(level.data() + first,
+                                             (lastRow - firstRow) * levelWidth,
+                                             settings.bSRGB ? &tables : nullptr,
+                                             alphaScale,
+                                             levelPixels + first * 4);
+                               });
+
+        levelOffset += level.size() * 4;
+
+        std::swap(previousLevel, level);
+    }
+
+    return numMips;
+}
+
+f32 Zn::TextureMipGenerator::CalculateAlphaCoverage(std::span<const u8> pixels, f32 alphaCutoff)
+{
+    const sizet numTexels = pixels.size() / 4;
+
+    if (numTexels == 0)
+    {
+        return 0.f;
+    }
+
+    sizet numPassing = 0;
+
+    for (sizet texel = 0; texel < numTexels; ++texel)
+    {
+        numPassing += pixels[texel * 4 + 3] / 255.f >= alphaCutoff;
+    }
+
+    return static_cast<f32>(numPassing) / numTexels;
+}
@@ -0,0 +1,138 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Engine/TransformHierarchy.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace Zn::Automation
+{
+// Builds a random forest with shuffled node indices, so that parents don't come first in the input, and checks the world
+// matrices against a recursive evaluation after construction and after updating random subtrees.
+class TransformHierarchyAutomationTest : public AutomationTest
+{
+  public:
+    TransformHierarchyAutomationTest(u32 numNodes_, u32 numRoots_)
+        : numNodes(numNodes_)
+        , numRoots(numRoots_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        gen.seed(0x7EE);
+
+        Vector<u32> order(numNodes);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), gen);
+
+        parents.assign(numNodes, TransformHierarchy::kNoParent);
+        localMatrices.resize(numNodes);
+
+        for (u32 index = 0; index < numNodes; ++index)
+        {
+            if (index >= numRoots)
+            {
+                parents[order[index]] = order[std::uniform_int_distribution<u32>(0, index - 1)(gen)];
+            }
+
+            localMatrices[order[index]] = RandomMatrix();
+        }
+    }
+
+    virtual void Execute() override
+    {
+        bool bMatches = true;
+
+        TransformHierarchy hierarchy(parents, localMatrices);
+
+        bMatches &= hierarchy.GetNumNodes() == numNodes && !hierarchy.IsDirty() && MatchesReference(hierarchy);
+
+        for (u32 iteration = 0; iteration < 4; ++iteration)
+        {
+            for (u32 change = 0; change < 1 + numNodes / 64; ++change)
+            {
+                const u32 node = std::uniform_int_distribution<u32>(0, numNodes - 1)(gen);
+
+                localMatrices[node] = RandomMatrix();
+                hierarchy.SetLocalMatrix(node, localMatrices[node]);
+            }
+
+            bMatches &= hierarchy.IsDirty();
+
+            hierarchy.Update();
+
+            bMatches &= !hierarchy.IsDirty() && MatchesReference(hierarchy);
+        }
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        parents.clear();
+        localMatrices.clear();
+    }
+
+  private:
+    glm::mat4 RandomMatrix()
+    {
+        std::uniform_real_distribution<f32> distribution(-1.f, 1.f);
+
+        const glm::vec3 translation(distribution(gen), distribution(gen), distribution(gen));
+        const glm::vec3 axis(distribution(gen), 2.f, distribution(gen));
+
+        return glm::rotate(glm::translate(glm::mat4 {1.f}, translation), distribution(gen), glm::normalize(axis));
+    }
+
+    bool MatchesReference(const TransformHierarchy& hierarchy) const
+    {
+        Vector<glm::mat4> worldMatrices(numNodes);
+        Vector<u8>        computed(numNodes, 0);
+
+        auto ComputeWorld = [&](u32 node, auto& self) -> const glm::mat4&
+        {
+            if (!computed[node])
+            {
+                worldMatrices[node] = parents[node] == TransformHierarchy::kNoParent
+                                          ? localMatrices[node]
+                                          : self(parents[node], self) * localMatrices[node];
+                computed[node]      = 1;
+            }
+
+            return worldMatrices[node];
+        };
+
+        for (u32 node = 0; node < numNodes; ++node)
+        {
+            const glm::mat4& world = ComputeWorld(node, ComputeWorld);
+
+            for (i32 column = 0; column < 4; ++column)
+            {
+                if (!glm::all(glm::epsilonEqual(world[column], hierarchy.GetWorldMatrix(node)[column], 1e-4f)))
+                {
+                    return false;
+                }
+            }
+
+            if (localMatrices[node] != hierarchy.GetLocalMatrix(node))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    u32 numNodes = 0;
+    u32 numRoots = 0;
+
+    std::mt19937      gen;
+    Vector<u32>       parents;
+    Vector<glm::mat4> localMatrices;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(TransformHierarchyAutomationTest, Zn::Automation::TransformHierarchyAutomationTest, 200, 3);
+DEFINE_AUTOMATION_STARTUP_TEST(TransformHierarchyLargeAutomationTest, Zn::Automation::TransformHierarchyAutomationTest, 20000, 16);
@@ -0,0 +1,169 @@
+#include <Znpch.h>
+#include <Engine/TransformHierarchy.h>
+#include <Core/Async/ThreadPool.h>
+#include <algorithm>
+
+using namespace Zn;
+
+Zn::TransformHierarchy::TransformHierarchy(std::span<const u32> parents_, std::span<const glm::mat4> localMatrices_)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    check(parents_.size() == localMatrices_.size());
+
+    const u32 numNodes = static_cast<u32>(parents_.size());
+
+    static constexpr u32 kUnknownDepth = u32_max;
+
+    Vector<u32> depths(numNodes, kUnknownDepth);
+    Vector<u32> chain;
+
+    u32 maxDepth = 0;
+
+    for (u32 node = 0; node < numNodes; ++node)
+    {
+        // Walks up to the first ancestor with a known depth, then resolves the depths on the way back down.
+        u32 current = node;
+        chain.clear();
+
+        while (depths[current] == kUnknownDepth && parents_[current] != kNoParent)
+        {
+            if (chain.size() == numNodes)
+            {
+                checkMsg(false, "Cycle in the transform hierarchy, node %u is treated as a root.", current);
+                break;
+            }
+
+            chain.push_back(current);
+            current = parents_[current];
+
+            check(current < numNodes);
+        }
+
+        if (depths[current] == kUnknownDepth)
+        {
+            depths[current] = 0;
+        }
+
+        for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+        {
+            depths[*it] = depths[current] + 1;
+            current     = *it;
+        }
+
+        maxDepth = std::max(maxDepth, depths[node]);
+    }
+
+    // Counting sort by depth, stable so that the storage order only depends on the input.
+    depthOffsets.assign(numNodes > 0 ? maxDepth + 2 : 1, 0);
+
+    for (u32 depth : depths)
+    {
+        ++depthOffsets[depth + 1];
+    }
+
+    for (sizet depth = 1; depth < depthOffsets.size(); ++depth)
+    {
+        depthOffsets[depth] += depthOffsets[depth - 1];
+    }
+
+    nodeToSlot.resize(numNodes);
+
+    {
+        Vector<u32> nextSlots(depthOffsets.begin(), depthOffsets.end() - 1);
+
+        for (u32 node = 0; node < numNodes; ++node)
+        {
+            nodeToSlot[node] = nextSlots[depths[node]]++;
+        }
+    }
+
+    parents.resize(numNodes);
+    localMatrices.resize(numNodes);
+    worldMatrices.resize(numNodes);
+    dirty.assign(numNodes, 1);
+
+    for (u32 node = 0; node < numNodes; ++node)
+    {
+        const u32 slot = nodeToSlot[node];
+
+        parents[slot]       = depths[node] > 0 ? nodeToSlot[parents_[node]] : kNoParent;
+        localMatrices[slot] = localMatrices_[node];
+    }
+
+    firstDirtyDepth = 0;
+
+    Update();
+}
+
+void Zn::TransformHierarchy::SetLocalMatrix(u32 node, const glm::mat4& localMatrix)
+{
+    const u32 slot = nodeToSlot[node];
+
+    localMatrices[slot] = localMatrix;
+    dirty[slot]         = 1;
+
+    const u32 depth = static_cast<u32>(std::upper_bound(depthOffsets.begin(), depthOffsets.end(), slot) - depthOffsets.begin()) - 1;
+
+    firstDirtyDepth = std::min(firstDirtyDepth, depth);
+}
+
+void Zn::TransformHierarchy::Update()
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    if (!IsDirty())
+    {
+        return;
+    }
+
+    for (u32 depth = firstDirtyDepth; depth < GetNumDepths(); ++depth)
+    {
+        const u32 begin = depthOffsets[depth];
+        const u32 end   = depthOffsets[depth + 1];
+
+        if (end - begin < kParallelBatchSize)
+        {
+            UpdateRange(begin, end);
+            continue;
+        }
+
+        // Parents are all at the previous depth, which is complete by now.
+        const sizet numBatches = (end - begin + kParallelBatchSize - 1) / kParallelBatchSize;
+
+        ThreadPool::GetWorkerPool().ParallelFor(numBatches,
+                                                [this, begin, end](sizet batch)
+                                                {
+                                                    const u32 batchBegin = begin + static_cast<u32>(batch) * kParallelBatchSize;
+
+                                                    UpdateRange(batchBegin, std::min(end, batchBegin + kParallelBatchSize));
+                                                });
+    }
+
+    std::fill(dirty.begin() + depthOffsets[firstDirtyDepth], dirty.end(), 0);
+
+    firstDirtyDepth = u32_max;
+}
+
+void Zn::TransformHierarchy::UpdateRange(u32 begin, u32 end)
+{
+    for (u32 slot = begin; slot < end; ++slot)
+    {
+        const u32 parent = parents[slot];
+
+        if (parent == kNoParent)
+        {
+            if (dirty[slot])
+            {
+                worldMatrices[slot] = localMatrices[slot];
+            }
+        }
+        else if (dirty[slot] || dirty[parent])
+        {
+            worldMatrices[slot] = worldMatrices[parent] * localMatrices[slot];
+
+            // Propagates to the children, at the next depth.
+            dirty[slot] = 1;
+        }
+    }
+}
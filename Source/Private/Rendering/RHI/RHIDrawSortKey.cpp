@@ -0,0 +1,151 @@
+#include <Znpch.h>
+#include <Rendering/RHI/RHIDrawSortKey.h>
+#include <algorithm>
+#include <utility>
+
+using namespace Zn;
+
+namespace
+{
+constexpr u32 kDepthShift    = 0;
+constexpr u32 kMeshShift     = kDepthShift + RHIDrawSortKey::kDepthBits;
+constexpr u32 kMaterialShift = kMeshShift + RHIDrawSortKey::kMeshBits;
+constexpr u32 kPipelineShift = kMaterialShift + RHIDrawSortKey::kMaterialBits;
+constexpr u32 kPassShift     = kPipelineShift + RHIDrawSortKey::kPipelineBits;
+
+static_assert(kPassShift + RHIDrawSortKey::kPassBits == 64);
+
+constexpr u32 kDigitBits  = 8;
+constexpr u32 kNumDigits  = 64 / kDigitBits;
+constexpr u32 kNumBuckets = 1 << kDigitBits;
+
+constexpr u64 Mask(u32 bits)
+{
+    return (1ull << bits) - 1;
+}
+
+u32 GetField(u64 key, u32 shift, u32 bits)
+{
+    return static_cast<u32>((key >> shift) & Mask(bits));
+}
+} // namespace
+
+u64 Zn::RHIDrawSortKey::Encode(u32 pass, u32 pipeline, u32 material, u32 mesh, u32 depth)
+{
+    u64 key = 0;
+
+    key |= (pass & Mask(kPassBits)) << kPassShift;
+    key |= (pipeline & Mask(kPipelineBits)) << kPipelineShift;
+    key |= (material & Mask(kMaterialBits)) << kMaterialShift;
+    key |= (mesh & Mask(kMeshBits)) << kMeshShift;
+    key |= (depth & Mask(kDepthBits)) << kDepthShift;
+
+    return key;
+}
+
+u32 Zn::RHIDrawSortKey::GetPass(u64 key)
+{
+    return GetField(key, kPassShift, kPassBits);
+}
+
+u32 Zn::RHIDrawSortKey::GetPipeline(u64 key)
+{
+    return GetField(key, kPipelineShift, kPipelineBits);
+}
+
+u32 Zn::RHIDrawSortKey::GetMaterial(u64 key)
+{
+    return GetField(key, kMaterialShift, kMaterialBits);
+}
+
+u32 Zn::RHIDrawSortKey::GetMesh(u64 key)
+{
+    return GetField(key, kMeshShift, kMeshBits);
+}
+
+u32 Zn::RHIDrawSortKey::GetDepth(u64 key)
+{
+    return GetField(key, kDepthShift, kDepthBits);
+}
+
+u32 Zn::RHIDrawSortKey::QuantizeDepth(f32 distance, f32 nearClip, f32 farClip)
+{
+    if (farClip <= nearClip)
+    {
+        return 0;
+    }
+
+    const f32 normalized = std::clamp((distance - nearClip) / (farClip - nearClip), 0.f, 1.f);
+
+    return static_cast<u32>(normalized * static_cast<f32>(Mask(kDepthBits)) + 0.5f);
+}
+
+void Zn::RHIDrawSortKey::Sort(Vector<u64>& keys, Vector<u32>& values, Vector<u64>& scratchKeys, Vector<u32>& scratchValues)
+{
+    check(keys.size() == values.size());
+
+    const sizet numKeys = keys.size();
+
+    if (numKeys < 2)
+    {
+        return;
+    }
+
+    scratchKeys.resize(numKeys);
+    scratchValues.resize(numKeys);
+
+    // Counts of every digit, in a single read of the keys.
+    u32 histograms[kNumDigits][kNumBuckets] = {};
+
+    for (const u64 key : keys)
+    {
+        for (u32 digit = 0; digit < kNumDigits; ++digit)
+        {
+            ++histograms[digit][(key >> (digit * kDigitBits)) & (kNumBuckets - 1)];
+        }
+    }
+
+    u64* sourceKeys        = keys.data();
+    u32* sourceValues      = values.data();
+    u64* destinationKeys   = scratchKeys.data();
+    u32* destinationValues = scratchValues.data();
+
+    for (u32 digit = 0; digit < kNumDigits; ++digit)
+    {
+        u32(&histogram)[kNumBuckets] = histograms[digit];
+
+        const u32 shift = digit * kDigitBits;
+
+        // Every key has the same digit, the pass would not move anything.
+        if (histogram[(sourceKeys[0] >> shift) & (kNumBuckets - 1)] == numKeys)
+        {
+            continue;
+        }
+
+        // Counts to the offset of the first key of each bucket.
+        u32 offset = 0;
+
+        for (u32& count : histogram)
+        {
+            offset += std::exchange(count, offset);
+        }
+
+        for (sizet index = 0; index < numKeys; ++index)
+        {
+            const u32 destination = histogram[(sourceKeys[index] >> shift) & (kNumBuckets - 1)]++;
+
+            destinationKeys[destination]   = sourceKeys[index];
+            destinationValues[destination] = sourceValues[index];
+        }
+
+        std::swap(sourceKeys, destinationKeys);
+        std::swap(sourceValues, destinationValues);
+    }
+
+    // An odd number of passes leaves the result in the scratch vectors.
+    if (sourceKeys != keys.data())
+    {
+        keys.swap(scratchKeys);
+        values.swap(scratchValues);
+    }
+}
@@ -0,0 +1,155 @@
+#include <Znpch.h>
+#include <Rendering/RHI/RHIFrustumCulling.h>
+#include <bit>
+
+#if ZN_FRUSTUM_CULLING_AVX2
+    #include <immintrin.h>
+#elif ZN_FRUSTUM_CULLING_SSE2
+    #include <emmintrin.h>
+#endif
+
+using namespace Zn;
+
+namespace
+{
+// Same operations in the same order as the vector kernels, so that every path agrees on spheres touching a plane. The vector
+// comparisons are "not less than" for the same reason, a NaN distance culls nothing.
+f32 PlaneDistance(const glm::vec4& plane, f32 x, f32 y, f32 z)
+{
+    return plane.x * x + plane.y * y + plane.z * z + plane.w;
+}
+} // namespace
+
+RHIFrustum Zn::RHIFrustum::FromViewProjection(const glm::mat4& viewProjection)
+{
+    // glm matrices are column major, the rows of the clip space transform are transposed.
+    const glm::mat4 rows = glm::transpose(viewProjection);
+
+    RHIFrustum frustum;
+
+    frustum.planes[Left]   = rows[3] + rows[0];
+    frustum.planes[Right]  = rows[3] - rows[0];
+    frustum.planes[Bottom] = rows[3] + rows[1];
+    frustum.planes[Top]    = rows[3] - rows[1];
+    frustum.planes[Near]   = rows[3] + rows[2];
+    frustum.planes[Far]    = rows[3] - rows[2];
+
+    for (glm::vec4& plane : frustum.planes)
+    {
+        plane /= glm::length(glm::vec3(plane));
+    }
+
+    return frustum;
+}
+
+void Zn::RHIBoundingSpheres::Add(const glm::vec3& center, f32 radius_)
+{
+    centerX.push_back(center.x);
+    centerY.push_back(center.y);
+    centerZ.push_back(center.z);
+    radius.push_back(radius_);
+}
+
+void Zn::RHIBoundingSpheres::Clear()
+{
+    centerX.clear();
+    centerY.clear();
+    centerZ.clear();
+    radius.clear();
+}
+
+u32 Zn::RHIFrustumCulling::Cull(const RHIFrustum& frustum, const RHIBoundingSpheres& spheres, sizet first, sizet count, u8* outVisible)
+{
+    check(first + count <= spheres.Size());
+
+    const f32* centerX = spheres.centerX.data() + first;
+    const f32* centerY = spheres.centerY.data() + first;
+    const f32* centerZ = spheres.centerZ.data() + first;
+    const f32* radius  = spheres.radius.data() + first;
+
+    u32   numVisible = 0;
+    sizet index      = 0;
+
+#if ZN_FRUSTUM_CULLING_AVX2
+    for (; index + 8 <= count; index += 8)
+    {
+        const __m256 x         = _mm256_loadu_ps(centerX + index);
+        const __m256 y         = _mm256_loadu_ps(centerY + index);
+        const __m256 z         = _mm256_loadu_ps(centerZ + index);
+        const __m256 negRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius + index));
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+        for (const glm::vec4& plane : frustum.planes)
+        {
+            __m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.x), x);
+            distance        = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.y), y));
+            distance        = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.z), z));
+            distance        = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negRadius, _CMP_NLT_UQ));
+        }
+
+        const u32 mask = static_cast<u32>(_mm256_movemask_ps(inside));
+
+        for (u32 lane = 0; lane < 8; ++lane)
+        {
+            outVisible[index + lane] = (mask >> lane) & 1;
+        }
+
+        numVisible += static_cast<u32>(std::popcount(mask));
+    }
+#endif
+
+#if ZN_FRUSTUM_CULLING_SSE2
+    for (; index + 4 <= count; index += 4)
+    {
+        const __m128 x         = _mm_loadu_ps(centerX + index);
+        const __m128 y         = _mm_loadu_ps(centerY + index);
+        const __m128 z         = _mm_loadu_ps(centerZ + index);
+        const __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + index));
+
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+        for (const glm::vec4& plane : frustum.planes)
+        {
+            __m128 distance = _mm_mul_ps(_mm_set1_ps(plane.x), x);
+            distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), y));
+            distance        = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), z));
+            distance        = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+
+            inside = _mm_and_ps(inside, _mm_cmpnlt_ps(distance, negRadius));
+        }
+
+        const u32 mask = static_cast<u32>(_mm_movemask_ps(inside));
+
+        for (u32 lane = 0; lane < 4; ++lane)
+        {
+            outVisible[index + lane] = (mask >> lane) & 1;
+        }
+
+        numVisible += static_cast<u32>(std::popcount(mask));
+    }
+#endif
+
+    for (; index < count; ++index)
+    {
+        outVisible[index] = IsVisible(frustum, glm::vec3(centerX[index], centerY[index], centerZ[index]), radius[index]);
+        numVisible += outVisible[index];
+    }
+
+    return numVisible;
+}
+
+bool Zn::RHIFrustumCulling::IsVisible(const RHIFrustum& frustum, const glm::vec3& center, f32 radius)
+{
+    for (const glm::vec4& plane : frustum.planes)
+    {
+        if (PlaneDistance(plane, center.x, center.y, center.z) < -radius)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,97 @@
+#include <Znpch.h>
+#include <Rendering/RHI/RHIOffsetAllocator.h>
+
+using namespace Zn;
+
+void Zn::RHIOffsetAllocator::Initialize(u32 capacity_)
+{
+    capacity = capacity_;
+    freeSize = 0;
+
+    freeRanges.clear();
+    freeRangesBySize.clear();
+
+    if (capacity > 0)
+    {
+        AddFreeRange(0, capacity);
+    }
+}
+
+std::optional<u32> Zn::RHIOffsetAllocator::Allocate(u32 size)
+{
+    if (size == 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto bestFit = freeRangesBySize.lower_bound({size, 0});
+
+    if (bestFit == freeRangesBySize.end())
+    {
+        return std::nullopt;
+    }
+
+    const auto [rangeSize, offset] = *bestFit;
+
+    RemoveFreeRange(freeRanges.find(offset));
+
+    if (rangeSize > size)
+    {
+        AddFreeRange(offset + size, rangeSize - size);
+    }
+
+    return offset;
+}
+
+void Zn::RHIOffsetAllocator::Free(u32 offset, u32 size)
+{
+    check(size > 0 && offset + size <= capacity);
+
+    u32 start = offset;
+    u32 end   = offset + size;
+
+    auto next = freeRanges.lower_bound(start);
+
+    // Freed twice otherwise.
+    check(next == freeRanges.end() || next->first >= end);
+    check(next == freeRanges.begin() || std::prev(next)->first + std::prev(next)->second <= start);
+
+    // Merge with the free range before, then with the one after.
+    if (next != freeRanges.begin())
+    {
+        if (auto previous = std::prev(next); previous->first + previous->second == start)
+        {
+            start = previous->first;
+            RemoveFreeRange(previous);
+        }
+    }
+
+    if (next != freeRanges.end() && next->first == end)
+    {
+        end += next->second;
+        RemoveFreeRange(next);
+    }
+
+    AddFreeRange(start, end - start);
+}
+
+u32 Zn::RHIOffsetAllocator::GetLargestFreeRange() const
+{
+    return freeRangesBySize.empty() ? 0 : freeRangesBySize.rbegin()->first;
+}
+
+void Zn::RHIOffsetAllocator::AddFreeRange(u32 offset, u32 size)
+{
+    freeRanges.emplace(offset, size);
+    freeRangesBySize.emplace(size, offset);
+
+    freeSize += size;
+}
+
+void Zn::RHIOffsetAllocator::RemoveFreeRange(Map<u32, u32>::iterator range)
+{
+    freeRangesBySize.erase({range->second, range->first});
+    freeSize -= range->second;
+
+    freeRanges.erase(range);
+}
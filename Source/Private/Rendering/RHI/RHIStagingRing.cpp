@@ -0,0 +1,75 @@
+#include <Znpch.h>
+#include <Rendering/RHI/RHIStagingRing.h>
+
+using namespace Zn;
+
+void Zn::RHIStagingRing::Initialize(u64 capacity_, u64 alignment_)
+{
+    check(alignment_ > 0 && capacity_ % alignment_ == 0);
+
+    capacity      = capacity_;
+    alignment     = alignment_;
+    head          = 0;
+    tail          = 0;
+    firstSequence = 0;
+
+    ranges.clear();
+}
+
+std::optional<RHIStagingRing::Allocation> Zn::RHIStagingRing::Allocate(u64 size)
+{
+    // Start over from the beginning of an empty buffer, so that its whole capacity is available.
+    if (ranges.empty())
+    {
+        head = 0;
+        tail = 0;
+    }
+
+    u64 start = (head + alignment - 1) / alignment * alignment;
+
+    // Skip the end of the buffer when the allocation doesn't fit before it, the skipped bytes are freed with the allocation.
+    if (const u64 offset = start % capacity; offset + size > capacity)
+    {
+        start += capacity - offset;
+    }
+
+    if (size > capacity || start + size - tail > capacity)
+    {
+        return std::nullopt;
+    }
+
+    head = start + size;
+
+    ranges.push_back(Range {.end = head});
+
+    return Allocation {.offset = start % capacity, .sequence = firstSequence + ranges.size() - 1};
+}
+
+void Zn::RHIStagingRing::Retire(u64 sequence, u64 value)
+{
+    check(sequence >= firstSequence && sequence - firstSequence < ranges.size());
+
+    ranges[sequence - firstSequence].retireValue = value;
+}
+
+void Zn::RHIStagingRing::Reclaim(u64 completedValue)
+{
+    // Ranges are freed in order, a later one retired first waits for the older ones.
+    while (!ranges.empty() && ranges.front().retireValue <= completedValue)
+    {
+        tail = ranges.front().end;
+
+        ranges.pop_front();
+        ++firstSequence;
+    }
+}
+
+std::optional<u64> Zn::RHIStagingRing::GetOldestRetireValue() const
+{
+    if (ranges.empty())
+    {
+        return std::nullopt;
+    }
+
+    return ranges.front().retireValue;
+}
@@ -0,0 +1,131 @@
+#include <Znpch.h>
+#include <Rendering/RHI/RHIVertexQuantization.h>
+#include <Rendering/RHI/RHIMesh.h>
+#include <algorithm>
+
+using namespace Zn;
+
+namespace
+{
+// The smallest magnitude of a snorm16, keeps the sign of a zero y in the tangent encoding.
+static constexpr f32 kMinSnorm16 = 1.f / 32767.f;
+
+glm::vec2 SignNotZero(const glm::vec2& value)
+{
+    return glm::vec2(value.x >= 0.f ? 1.f : -1.f, value.y >= 0.f ? 1.f : -1.f);
+}
+
+// Projects the direction on the octahedron |x| + |y| + |z| = 1, then folds the lower half over the upper one.
+glm::vec2 OctahedralProject(const glm::vec3& direction)
+{
+    const f32 sum = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+
+    if (sum == 0.f)
+    {
+        return glm::vec2(0.f);
+    }
+
+    const glm::vec3 octahedron = direction / sum;
+
+    if (octahedron.z >= 0.f)
+    {
+        return glm::vec2(octahedron.x, octahedron.y);
+    }
+
+    return (1.f - glm::abs(glm::vec2(octahedron.y, octahedron.x))) * SignNotZero(glm::vec2(octahedron.x, octahedron.y));
+}
+
+glm::vec3 OctahedralUnproject(const glm::vec2& encoded)
+{
+    glm::vec3 direction(encoded.x, encoded.y, 1.f - std::abs(encoded.x) - std::abs(encoded.y));
+
+    const f32 fold = std::max(-direction.z, 0.f);
+
+    direction.x += direction.x >= 0.f ? -fold : fold;
+    direction.y += direction.y >= 0.f ? -fold : fold;
+
+    return glm::normalize(direction);
+}
+} // namespace
+
+u32 Zn::RHIVertexQuantization::EncodeOctahedral(const glm::vec3& normal)
+{
+    return glm::packSnorm2x16(OctahedralProject(normal));
+}
+
+glm::vec3 Zn::RHIVertexQuantization::DecodeOctahedral(u32 encoded)
+{
+    return OctahedralUnproject(glm::unpackSnorm2x16(encoded));
+}
+
+u32 Zn::RHIVertexQuantization::EncodeTangent(const glm::vec4& tangent, const glm::vec3& normal)
+{
+    glm::vec3 direction = glm::vec3(tangent);
+    f32       sign      = tangent.w < 0.f ? -1.f : 1.f;
+
+    if (direction == glm::vec3(0.f))
+    {
+        direction = std::abs(normal.x) > std::abs(normal.y) ? glm::vec3(-normal.z, 0.f, normal.x) : glm::vec3(0.f, normal.z, -normal.y);
+        sign      = 1.f;
+    }
+
+    const glm::vec2 encoded = OctahedralProject(direction);
+
+    // y is remapped to [0, 1] so that its sign is free for the bitangent sign.
+    return glm::packSnorm2x16(glm::vec2(encoded.x, sign * std::max(encoded.y * 0.5f + 0.5f, kMinSnorm16)));
+}
+
+glm::vec4 Zn::RHIVertexQuantization::DecodeTangent(u32 encoded)
+{
+    const glm::vec2 unpacked = glm::unpackSnorm2x16(encoded);
+
+    return glm::vec4(OctahedralUnproject(glm::vec2(unpacked.x, std::abs(unpacked.y) * 2.f - 1.f)), unpacked.y < 0.f ? -1.f : 1.f);
+}
+
+void Zn::RHIVertexQuantization::Quantize(const RHIPrimitiveView& primitive, RHIQuantizedPrimitive& outPrimitive)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    const sizet numVertices = primitive.position.size();
+
+    outPrimitive.position.resize(numVertices);
+    outPrimitive.normal.resize(numVertices);
+    outPrimitive.tangent.resize(numVertices);
+    outPrimitive.uv.resize(numVertices);
+    outPrimitive.dequantization = glm::mat4(1.f);
+
+    if (numVertices == 0)
+    {
+        return;
+    }
+
+    glm::vec3 boundsMin = primitive.position[0];
+    glm::vec3 boundsMax = primitive.position[0];
+
+    for (const glm::vec3& position : primitive.position)
+    {
+        boundsMin = glm::min(boundsMin, position);
+        boundsMax = glm::max(boundsMax, position);
+    }
+
+    const glm::vec3 extent    = boundsMax - boundsMin;
+    const f32       maxExtent = std::max({extent.x, extent.y, extent.z});
+    const f32       scale     = maxExtent > 0.f ? maxExtent : 1.f;
+
+    outPrimitive.dequantization = glm::scale(glm::translate(glm::mat4(1.f), boundsMin), glm::vec3(scale));
+
+    const bool bHasNormals  = primitive.normal.size() == numVertices;
+    const bool bHasTangents = primitive.tangent.size() == numVertices;
+    const bool bHasUVs      = primitive.uv.size() == numVertices;
+
+    for (sizet vertex = 0; vertex < numVertices; ++vertex)
+    {
+        const glm::vec3 unorm  = glm::clamp((primitive.position[vertex] - boundsMin) / scale, 0.f, 1.f);
+        const glm::vec3 normal = bHasNormals ? primitive.normal[vertex] : glm::vec3(0.f);
+
+        outPrimitive.position[vertex] = glm::u16vec4(glm::round(unorm * 65535.f), 0.f);
+        outPrimitive.normal[vertex]   = EncodeOctahedral(normal);
+        outPrimitive.tangent[vertex]  = EncodeTangent(bHasTangents ? primitive.tangent[vertex] : glm::vec4(0.f), normal);
+        outPrimitive.uv[vertex]       = glm::packHalf2x16(bHasUVs ? primitive.uv[vertex] : glm::vec2(0.f));
+    }
+}
@@ -0,0 +1,127 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Rendering/RHI/RHIDrawSortKey.h"
+#include <algorithm>
+#include <utility>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_RHIDrawSortKey, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Encodes keys from pseudo random fields, limited to numStates distinct states, and checks that the fields decode back. Then checks
+// that the radix sort orders the keys like a stable sort, with the values following their key.
+class RHIDrawSortKeyAutomationTest : public AutomationTest
+{
+  public:
+    RHIDrawSortKeyAutomationTest(u32 numKeys_, u32 numStates_)
+        : numKeys(numKeys_)
+        , numStates(numStates_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        Vector<u64> keys;
+        Vector<u32> values;
+
+        u32  seed     = 1337;
+        bool bMatches = true;
+
+        auto Next = [&seed]()
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 8;
+        };
+
+        for (u32 index = 0; index < numKeys; ++index)
+        {
+            const u32 state    = Next() % numStates;
+            const u32 pass     = state % 3;
+            const u32 pipeline = state % 7;
+            const u32 material = state * 31 % 4096;
+            const u32 mesh     = state % 5;
+            const u32 depth    = Next() % (1 << RHIDrawSortKey::kDepthBits);
+
+            const u64 key = RHIDrawSortKey::Encode(pass, pipeline, material, mesh, depth);
+
+            bMatches &= RHIDrawSortKey::GetPass(key) == pass && RHIDrawSortKey::GetPipeline(key) == pipeline;
+            bMatches &= RHIDrawSortKey::GetMaterial(key) == material && RHIDrawSortKey::GetMesh(key) == mesh;
+            bMatches &= RHIDrawSortKey::GetDepth(key) == depth;
+
+            keys.push_back(key);
+            values.push_back(index);
+        }
+
+        Vector<std::pair<u64, u32>> expected;
+
+        for (u32 index = 0; index < numKeys; ++index)
+        {
+            expected.emplace_back(keys[index], values[index]);
+        }
+
+        std::stable_sort(expected.begin(),
+                         expected.end(),
+                         [](const std::pair<u64, u32>& lhs, const std::pair<u64, u32>& rhs)
+                         {
+                             return lhs.first < rhs.first;
+                         });
+
+        Vector<u64> scratchKeys;
+        Vector<u32> scratchValues;
+
+        RHIDrawSortKey::Sort(keys, values, scratchKeys, scratchValues);
+
+        bMatches &= keys.size() == numKeys && values.size() == numKeys;
+
+        for (u32 index = 0; bMatches && index < numKeys; ++index)
+        {
+            bMatches &= keys[index] == expected[index].first && values[index] == expected[index].second;
+        }
+
+        u32 numStateChanges = 0;
+
+        for (u32 index = 1; index < numKeys; ++index)
+        {
+            numStateChanges += RHIDrawSortKey::GetStateBits(keys[index]) != RHIDrawSortKey::GetStateBits(keys[index - 1]);
+        }
+
+        bMatches &= numKeys == 0 || numStateChanges < numStates;
+
+        // Only the depth differs, sorting takes the two passes of the depth bits.
+        for (u32 index = 0; index < numKeys; ++index)
+        {
+            keys[index]   = RHIDrawSortKey::Encode(1, 2, 3, 4, numKeys - index);
+            values[index] = index;
+        }
+
+        RHIDrawSortKey::Sort(keys, values, scratchKeys, scratchValues);
+
+        for (u32 index = 0; bMatches && index < numKeys; ++index)
+        {
+            bMatches &= RHIDrawSortKey::GetDepth(keys[index]) == index + 1 && values[index] == numKeys - 1 - index;
+        }
+
+        // Nearer is smaller, out of range distances are clamped.
+        bMatches &= RHIDrawSortKey::QuantizeDepth(1.f, 0.1f, 100.f) < RHIDrawSortKey::QuantizeDepth(2.f, 0.1f, 100.f);
+        bMatches &= RHIDrawSortKey::QuantizeDepth(0.f, 0.1f, 100.f) == 0;
+        bMatches &= RHIDrawSortKey::QuantizeDepth(1000.f, 0.1f, 100.f) == (1u << RHIDrawSortKey::kDepthBits) - 1;
+
+        ZN_LOG(LogAutomationTest_RHIDrawSortKey,
+               ELogVerbosity::Log,
+               "[%u keys] %u states, %u state changes once sorted",
+               numKeys,
+               numStates,
+               numStateChanges);
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+  private:
+    u32 numKeys   = 0;
+    u32 numStates = 0;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(RHIDrawSortKeyAutomationTest, Zn::Automation::RHIDrawSortKeyAutomationTest, 10000, 64);
+DEFINE_AUTOMATION_STARTUP_TEST(RHIDrawSortKeySmallAutomationTest, Zn::Automation::RHIDrawSortKeyAutomationTest, 3, 2);
@@ -0,0 +1,104 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Rendering/RHI/RHIFrustumCulling.h"
+#include <random>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_RHIFrustumCulling, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Culls pseudo random spheres around a camera, over unaligned ranges, and checks that the vector kernels agree with the scalar test.
+// Also checks a few spheres whose visibility is known.
+class RHIFrustumCullingAutomationTest : public AutomationTest
+{
+  public:
+    RHIFrustumCullingAutomationTest(u32 numSpheres_)
+        : numSpheres(numSpheres_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        const glm::vec3 position = glm::vec3(3.f, 2.f, -5.f);
+        const glm::vec3 forward  = glm::normalize(glm::vec3(-0.3f, -0.1f, 1.f));
+
+        glm::mat4 projection = glm::perspective(glm::radians(60.f), 16.f / 9.f, 0.1f, 100.f);
+        projection[1][1] *= -1;
+
+        const glm::mat4 view = glm::lookAt(position, position + forward, glm::vec3(0.f, 1.f, 0.f));
+
+        const RHIFrustum frustum = RHIFrustum::FromViewProjection(projection * view);
+
+        std::mt19937                          generator(2024);
+        std::uniform_real_distribution<float> coordinate(-120.f, 120.f);
+        std::uniform_real_distribution<float> radius(0.f, 10.f);
+
+        RHIBoundingSpheres spheres;
+
+        for (u32 index = 0; index < numSpheres; ++index)
+        {
+            spheres.Add(glm::vec3(coordinate(generator), coordinate(generator), coordinate(generator)), radius(generator));
+        }
+
+        bool bMatches = spheres.Size() == numSpheres;
+
+        Vector<u8> visible(numSpheres, 0xff);
+
+        // Ranges not starting on a vector boundary, with a scalar tail.
+        const sizet first = std::min<sizet>(3, numSpheres);
+        const sizet count = numSpheres - first;
+
+        const u32 numVisible = RHIFrustumCulling::Cull(frustum, spheres, first, count, visible.data());
+
+        u32 numExpected = 0;
+
+        for (sizet index = 0; index < count; ++index)
+        {
+            const sizet     sphere = first + index;
+            const glm::vec3 center(spheres.centerX[sphere], spheres.centerY[sphere], spheres.centerZ[sphere]);
+            const bool      bVisible = RHIFrustumCulling::IsVisible(frustum, center, spheres.radius[sphere]);
+
+            bMatches &= visible[index] == static_cast<u8>(bVisible);
+            numExpected += bVisible;
+        }
+
+        bMatches &= numVisible == numExpected;
+
+        // Untouched past the range.
+        for (sizet index = count; index < numSpheres; ++index)
+        {
+            bMatches &= visible[index] == 0xff;
+        }
+
+        ZN_LOG(LogAutomationTest_RHIFrustumCulling, ELogVerbosity::Log, "[%u spheres] %u visible", numSpheres, numVisible);
+
+        // In front of the camera, behind it, past the far plane, and behind the camera but large enough to reach the frustum.
+        bMatches &= RHIFrustumCulling::IsVisible(frustum, position + forward * 10.f, 0.5f);
+        bMatches &= !RHIFrustumCulling::IsVisible(frustum, position - forward * 10.f, 0.5f);
+        bMatches &= !RHIFrustumCulling::IsVisible(frustum, position + forward * 150.f, 1.f);
+        bMatches &= RHIFrustumCulling::IsVisible(frustum, position - forward * 2.f, 3.f);
+
+        // Off to the side of a plane by less than the radius.
+        const glm::vec4& left = frustum.planes[RHIFrustum::Left];
+
+        const glm::vec3 onLeftPlane = position + forward * 20.f - glm::vec3(left) * PlaneDistance(left, position + forward * 20.f);
+
+        bMatches &= RHIFrustumCulling::IsVisible(frustum, onLeftPlane - glm::vec3(left) * 0.5f, 1.f);
+        bMatches &= !RHIFrustumCulling::IsVisible(frustum, onLeftPlane - glm::vec3(left) * 1.5f, 1.f);
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+  private:
+    static f32 PlaneDistance(const glm::vec4& plane, const glm::vec3& point)
+    {
+        return glm::dot(glm::vec3(plane), point) + plane.w;
+    }
+
+    u32 numSpheres = 0;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(RHIFrustumCullingAutomationTest, Zn::Automation::RHIFrustumCullingAutomationTest, 10007);
+DEFINE_AUTOMATION_STARTUP_TEST(RHIFrustumCullingSmallAutomationTest, Zn::Automation::RHIFrustumCullingAutomationTest, 5);
@@ -0,0 +1,136 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Rendering/RHI/RHIOffsetAllocator.h"
+#include <algorithm>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_RHIOffsetAllocator, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Allocates and frees ranges of pseudo random sizes in random order. Checks that live ranges never overlap, that the free size
+// matches the units not allocated, that an allocation only fails when no free range can hold it, and that freeing everything
+// merges the free ranges back into one.
+class RHIOffsetAllocatorAutomationTest : public AutomationTest
+{
+  public:
+    RHIOffsetAllocatorAutomationTest(u32 capacity_, u32 maxSize_, u32 numOperations_)
+        : capacity(capacity_)
+        , maxSize(maxSize_)
+        , numOperations(numOperations_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        RHIOffsetAllocator allocator;
+        allocator.Initialize(capacity);
+
+        struct Range
+        {
+            u32 offset = 0;
+            u32 size   = 0;
+        };
+
+        Vector<Range> liveRanges;
+        Vector<u8>    used(capacity, 0);
+
+        u32  usedSize   = 0;
+        u32  numFailed  = 0;
+        u32  maxNumFree = 0;
+        u32  seed       = 4242;
+        bool bMatches   = allocator.GetFreeSize() == capacity && allocator.GetNumFreeRanges() == 1;
+
+        for (u32 operation = 0; operation < numOperations && bMatches; ++operation)
+        {
+            seed = seed * 1664525u + 1013904223u;
+
+            // Allocate more than free until the allocator is nearly full, then the other way around.
+            const bool bAllocate = liveRanges.empty() || (seed >> 8) % 100 < (usedSize < capacity * 3 / 4 ? 60u : 40u);
+
+            if (bAllocate)
+            {
+                const u32 size = 1 + (seed >> 12) % maxSize;
+
+                const u32 largestFreeRange = allocator.GetLargestFreeRange();
+
+                if (const std::optional<u32> offset = allocator.Allocate(size))
+                {
+                    bMatches &= *offset + size <= capacity;
+
+                    for (u32 unit = *offset; bMatches && unit < *offset + size; ++unit)
+                    {
+                        bMatches &= used[unit] == 0;
+                        used[unit] = 1;
+                    }
+
+                    liveRanges.push_back(Range {.offset = *offset, .size = size});
+                    usedSize += size;
+                }
+                else
+                {
+                    bMatches &= largestFreeRange < size;
+                    ++numFailed;
+                }
+            }
+            else
+            {
+                const sizet index = (seed >> 12) % liveRanges.size();
+                const Range range = liveRanges[index];
+
+                liveRanges[index] = liveRanges.back();
+                liveRanges.pop_back();
+
+                allocator.Free(range.offset, range.size);
+
+                std::fill_n(used.begin() + range.offset, range.size, 0);
+                usedSize -= range.size;
+            }
+
+            bMatches &= allocator.GetFreeSize() == capacity - usedSize;
+
+            maxNumFree = std::max(maxNumFree, allocator.GetNumFreeRanges());
+        }
+
+        // Every free range is at least one unit apart from the others, otherwise they would have been merged.
+        u32 numExpected = 0;
+
+        for (u32 unit = 0; unit < capacity; ++unit)
+        {
+            numExpected += used[unit] == 0 && (unit == 0 || used[unit - 1] != 0);
+        }
+
+        bMatches &= allocator.GetNumFreeRanges() == numExpected;
+
+        ZN_LOG(LogAutomationTest_RHIOffsetAllocator,
+               ELogVerbosity::Log,
+               "[%u operations] %u failed allocations, up to %u free ranges",
+               numOperations,
+               numFailed,
+               maxNumFree);
+
+        for (const Range& range : liveRanges)
+        {
+            allocator.Free(range.offset, range.size);
+        }
+
+        bMatches &= allocator.GetFreeSize() == capacity && allocator.GetNumFreeRanges() == 1;
+        bMatches &= allocator.GetLargestFreeRange() == capacity;
+
+        // A full allocator hands out its whole capacity once.
+        const std::optional<u32> whole = allocator.Allocate(capacity);
+
+        bMatches &= whole == 0u && !allocator.Allocate(1) && allocator.GetFreeSize() == 0;
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+  private:
+    u32 capacity      = 0;
+    u32 maxSize       = 0;
+    u32 numOperations = 0;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(RHIOffsetAllocatorAutomationTest, Zn::Automation::RHIOffsetAllocatorAutomationTest, 1 << 16, 4096, 20000);
+DEFINE_AUTOMATION_STARTUP_TEST(RHIOffsetAllocatorSmallAutomationTest, Zn::Automation::RHIOffsetAllocatorAutomationTest, 256, 16, 5000);
@@ -0,0 +1,164 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Rendering/RHI/RHIStagingRing.h"
+#include <algorithm>
+#include <deque>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_RHIStagingRing, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Simulates uploads through a staging ring: allocations of pseudo random sizes are retired with batches of a timeline, some are
+// discarded, and the timeline completes a batch whenever the ring is full. Checks that live allocations are aligned, fit in the
+// ring and never overlap, and that the whole ring is free again once the timeline completed every batch.
+class RHIStagingRingAutomationTest : public AutomationTest
+{
+  public:
+    RHIStagingRingAutomationTest(u32 capacity_, u32 alignment_, u32 numAllocations_)
+        : capacity(capacity_)
+        , alignment(alignment_)
+        , numAllocations(numAllocations_)
+    {
+    }
+
+    virtual void Execute() override
+    {
+        RHIStagingRing ring;
+        ring.Initialize(capacity, alignment);
+
+        // Sequence of the allocation owning each byte, 0 for free bytes.
+        Vector<u64> owners(capacity, 0);
+
+        struct LiveAllocation
+        {
+            RHIStagingRing::Allocation allocation;
+            u64                        size        = 0;
+            u64                        retireValue = 0;
+        };
+
+        std::deque<LiveAllocation> liveAllocations;
+
+        u64  submittedValue = 0;
+        u64  completedValue = 0;
+        u32  numWrapped     = 0;
+        u64  previousOffset = 0;
+        u32  seed           = 12345;
+        bool bMatches       = true;
+
+        const auto complete = [&](u64 value)
+        {
+            completedValue = value;
+            ring.Reclaim(completedValue);
+
+            // Mirrors the in order release of the ring.
+            while (!liveAllocations.empty() && liveAllocations.front().retireValue <= completedValue)
+            {
+                const LiveAllocation& released = liveAllocations.front();
+
+                for (u64 byte = released.allocation.offset; byte < released.allocation.offset + released.size; ++byte)
+                {
+                    bMatches &= owners[byte] == released.allocation.sequence + 1;
+                    owners[byte] = 0;
+                }
+
+                liveAllocations.pop_front();
+            }
+        };
+
+        for (u32 index = 0; index < numAllocations && bMatches; ++index)
+        {
+            seed = seed * 1664525u + 1013904223u;
+
+            // Mostly small allocations, a few close to the capacity.
+            const u64 size = (seed >> 8) % 8 == 0 ? capacity / 2 + (seed >> 12) % (capacity / 2) : 1 + (seed >> 12) % (capacity / 16);
+
+            std::optional<RHIStagingRing::Allocation> allocation = ring.Allocate(size);
+
+            while (!allocation && completedValue < submittedValue)
+            {
+                complete(completedValue + 1);
+                allocation = ring.Allocate(size);
+            }
+
+            // The rest of the ring is waiting for the batch being recorded.
+            if (!allocation)
+            {
+                complete(++submittedValue);
+                allocation = ring.Allocate(size);
+            }
+
+            bMatches &= allocation.has_value();
+
+            if (!allocation)
+            {
+                break;
+            }
+
+            bMatches &= allocation->offset % alignment == 0 && allocation->offset + size <= capacity;
+            numWrapped += allocation->offset < previousOffset;
+            previousOffset = allocation->offset;
+
+            for (u64 byte = allocation->offset; byte < allocation->offset + size; ++byte)
+            {
+                bMatches &= owners[byte] == 0;
+                owners[byte] = allocation->sequence + 1;
+            }
+
+            // One in five is discarded, the others are read by the next batch.
+            const u64 retireValue = (seed >> 20) % 5 == 0 ? 0 : submittedValue + 1;
+
+            ring.Retire(allocation->sequence, retireValue);
+
+            // The oldest allocations keep the discarded ones after them alive.
+            liveAllocations.push_back(LiveAllocation {
+                .allocation  = *allocation,
+                .size        = size,
+                .retireValue = liveAllocations.empty() ? retireValue : std::max(retireValue, liveAllocations.back().retireValue),
+            });
+
+            // Batches of a few allocations.
+            if ((seed >> 24) % 4 == 0)
+            {
+                ++submittedValue;
+            }
+        }
+
+        complete(++submittedValue);
+
+        ZN_LOG(LogAutomationTest_RHIStagingRing,
+               ELogVerbosity::Log,
+               "[%u allocations] Wrapped %u times in %u bytes, %llu batches",
+               numAllocations,
+               numWrapped,
+               capacity,
+               submittedValue);
+
+        bMatches &= liveAllocations.empty() && ring.GetUsedSize() == 0 && !ring.GetOldestRetireValue().has_value();
+        bMatches &= numWrapped > 0;
+
+        // An empty ring starts over from the beginning, its whole capacity fits.
+        std::optional<RHIStagingRing::Allocation> whole = ring.Allocate(capacity);
+
+        bMatches &= whole && whole->offset == 0 && !ring.Allocate(1);
+
+        if (whole)
+        {
+            ring.Retire(whole->sequence, 0);
+            ring.Reclaim(completedValue);
+        }
+
+        bMatches &= ring.GetUsedSize() == 0 && !ring.Allocate(capacity + 1);
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+  private:
+    u32 capacity       = 0;
+    u32 alignment      = 0;
+    u32 numAllocations = 0;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(RHIStagingRingAutomationTest, Zn::Automation::RHIStagingRingAutomationTest, 4096, 16, 5000);
+DEFINE_AUTOMATION_STARTUP_TEST(RHIStagingRingUnalignedAutomationTest, Zn::Automation::RHIStagingRingAutomationTest, 1000, 1, 2000);
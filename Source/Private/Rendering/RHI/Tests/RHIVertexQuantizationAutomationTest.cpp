@@ -0,0 +1,107 @@
+#include <Znpch.h>
+#include "Automation/AutomationTest.h"
+#include "Automation/AutomationTestManager.h"
+#include "Rendering/RHI/RHIMesh.h"
+#include "Rendering/RHI/RHIVertexQuantization.h"
+#include <cmath>
+
+DEFINE_STATIC_LOG_CATEGORY(LogAutomationTest_RHIVertexQuantization, ELogVerbosity::Log)
+
+namespace Zn::Automation
+{
+// Quantizes numVertices vertices spread on a fibonacci sphere, with every sign of tangent, and checks the decoded streams against
+// the source ones.
+class RHIVertexQuantizationAutomationTest : public AutomationTest
+{
+  public:
+    explicit RHIVertexQuantizationAutomationTest(u32 numVertices_)
+        : numVertices(numVertices_)
+    {
+    }
+
+    virtual void Prepare() override
+    {
+        primitive = RHIPrimitive {};
+
+        const f32 goldenAngle = 2.39996323f;
+
+        for (u32 vertex = 0; vertex < numVertices; ++vertex)
+        {
+            const f32 y      = 1.f - 2.f * (vertex + 0.5f) / numVertices;
+            const f32 radius = std::sqrt(1.f - y * y);
+            const f32 angle  = goldenAngle * vertex;
+
+            const glm::vec3 normal(radius * std::cos(angle), y, radius * std::sin(angle));
+
+            // An arbitrary box, flatter on z.
+            primitive.position.push_back(glm::vec3(-3.f, 10.f, 0.5f) + normal * glm::vec3(4.f, 2.f, 0.25f));
+            primitive.normal.push_back(normal);
+            primitive.tangent.push_back(glm::vec4(glm::normalize(glm::cross(normal, glm::vec3(0.6f, 0.f, 0.8f))), vertex % 2 ? 1.f : -1.f));
+            primitive.uv.push_back(glm::vec2(angle / goldenAngle / numVertices, y * 4.f));
+        }
+    }
+
+    virtual void Execute() override
+    {
+        RHIQuantizedPrimitive quantized;
+        RHIVertexQuantization::Quantize(RHIPrimitiveView::From(primitive), quantized);
+
+        bool bMatches = quantized.position.size() == numVertices && quantized.normal.size() == numVertices &&
+                        quantized.tangent.size() == numVertices && quantized.uv.size() == numVertices;
+
+        // 16 bits over the largest extent of the bounds, 8 units here.
+        const f32 maxPositionError = 8.f / 65535.f;
+
+        f32 maxNormalError  = 0.f;
+        f32 maxTangentError = 0.f;
+
+        for (u32 vertex = 0; bMatches && vertex < numVertices; ++vertex)
+        {
+            const glm::vec3 unorm    = glm::vec3(glm::vec4(quantized.position[vertex])) / 65535.f;
+            const glm::vec3 position = glm::vec3(quantized.dequantization * glm::vec4(unorm, 1.f));
+            const glm::vec3 normal   = RHIVertexQuantization::DecodeOctahedral(quantized.normal[vertex]);
+            const glm::vec4 tangent  = RHIVertexQuantization::DecodeTangent(quantized.tangent[vertex]);
+            const glm::vec2 uv       = glm::unpackHalf2x16(quantized.uv[vertex]);
+
+            maxNormalError  = std::max(maxNormalError, glm::length(normal - primitive.normal[vertex]));
+            maxTangentError = std::max(maxTangentError, glm::length(glm::vec3(tangent - primitive.tangent[vertex])));
+
+            bMatches &= glm::all(glm::lessThanEqual(glm::abs(position - primitive.position[vertex]), glm::vec3(maxPositionError)));
+            bMatches &= tangent.w == primitive.tangent[vertex].w;
+            bMatches &= glm::all(glm::lessThanEqual(glm::abs(uv - primitive.uv[vertex]), glm::abs(primitive.uv[vertex]) / 1024.f + 1e-6f));
+        }
+
+        ZN_LOG(LogAutomationTest_RHIVertexQuantization,
+               ELogVerbosity::Log,
+               "[%u vertices] max normal error: %f max tangent error: %f",
+               numVertices,
+               maxNormalError,
+               maxTangentError);
+
+        // Octahedral snorm16 are within 1e-4 of the source directions, the tangents lose a bit of y for the sign.
+        bMatches &= maxNormalError < 1e-4f && maxTangentError < 2e-4f;
+
+        // Zero directions don't decode to NaN, and zero tangents are orthogonal to the normal.
+        const u32 zeroNormal  = RHIVertexQuantization::EncodeOctahedral(glm::vec3(0.f));
+        const u32 zeroTangent = RHIVertexQuantization::EncodeTangent(glm::vec4(0.f), glm::vec3(0.f, 1.f, 0.f));
+
+        const glm::vec4 decodedZeroTangent = RHIVertexQuantization::DecodeTangent(zeroTangent);
+
+        bMatches &= RHIVertexQuantization::DecodeOctahedral(zeroNormal) == glm::vec3(0.f, 0.f, 1.f);
+        bMatches &= std::abs(glm::dot(glm::vec3(decodedZeroTangent), glm::vec3(0.f, 1.f, 0.f))) < 1e-4f && decodedZeroTangent.w == 1.f;
+
+        ZN_TEST_VERIFY(bMatches, Result::kFailed);
+    }
+
+    virtual void Cleanup() override
+    {
+        primitive = RHIPrimitive {};
+    }
+
+  private:
+    u32          numVertices = 0;
+    RHIPrimitive primitive;
+};
+} // namespace Zn::Automation
+
+DEFINE_AUTOMATION_STARTUP_TEST(RHIVertexQuantizationAutomationTest, Zn::Automation::RHIVertexQuantizationAutomationTest, 4096);
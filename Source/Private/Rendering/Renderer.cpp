@@ -3,6 +3,7 @@
 #include "ImGui/ImGuiWrapper.h"
 
 #include "Rendering/Vulkan/VulkanRenderer.h"
+#include "Application/Window.h"
 #include <Engine/Camera.h>
 
 using namespace Zn;
@@ -46,6 +47,8 @@ bool Zn::Renderer::initialize(RendererBackendType type, RendererInitParams data)
         return false;
     }
 
+    instance->BindWindowEvents(data.window);
+
     return true;
 }
 
@@ -53,6 +56,8 @@ bool Zn::Renderer::destroy()
 {
     if (instance)
     {
+        instance->UnbindWindowEvents();
+
         instance->shutdown();
 
         instance = nullptr;
@@ -61,4 +66,28 @@ bool Zn::Renderer::destroy()
     }
 
     return false;
-}
\ No newline at end of file
+}
+
+void Zn::Renderer::BindWindowEvents(const SharedPtr<Window>& inWindow)
+{
+    window = inWindow;
+
+    if (window)
+    {
+        resizedHandle   = window->GetResizedEvent().Bind(TMulticastEvent<>::DelegateType::Create<&Renderer::on_window_resized>(this));
+        minimizedHandle = window->GetMinimizedEvent().Bind(TMulticastEvent<>::DelegateType::Create<&Renderer::on_window_minimized>(this));
+        restoredHandle  = window->GetRestoredEvent().Bind(TMulticastEvent<>::DelegateType::Create<&Renderer::on_window_restored>(this));
+    }
+}
+
+void Zn::Renderer::UnbindWindowEvents()
+{
+    if (window)
+    {
+        window->GetResizedEvent().Unbind(resizedHandle);
+        window->GetMinimizedEvent().Unbind(minimizedHandle);
+        window->GetRestoredEvent().Unbind(restoredHandle);
+    }
+
+    window = nullptr;
+}
@@ -1,22 +1,32 @@
 #include <Znpch.h>
+#include <Core/Async/ThreadPool.h>
 #include <Core/Containers/Set.h>
+#include <Core/Containers/StaticVector.h>
 #include <Core/IO/IO.h>
 #include <Core/Memory/Memory.h>
 #include <Core/CommandLine.h>
+#include <Engine/Importer/CookedMesh.h>
 #include <Engine/Importer/MeshImporter.h>
+#include <Engine/Importer/TextureCompressor.h>
+#include <Engine/Importer/TextureImportQueue.h>
 #include <Engine/Importer/TextureImporter.h>
+#include <Engine/Importer/TextureMipGenerator.h>
 #include <Rendering/Material.h>
 #include <Rendering/RHI/RHI.h>
+#include <Rendering/RHI/RHIDrawSortKey.h>
+#include <Rendering/RHI/RHIFrustumCulling.h>
 #include <Rendering/RHI/RHIInputLayout.h>
 #include <Rendering/RHI/RHIInstanceData.h>
 #include <Rendering/RHI/RHIMesh.h>
 #include <Rendering/RHI/RHITexture.h>
 #include <Rendering/RHI/RHITypes.h>
+#include <Rendering/RHI/RHIVertexQuantization.h>
 #include <Rendering/Vulkan/VulkanDevice.h>
 #include <Rendering/Vulkan/VulkanMaterialManager.h>
 #include <Rendering/Vulkan/VulkanPipeline.h>
 #include <SDL.h>
 #include <algorithm>
+#include <filesystem>
 #include <glm/gtx/matrix_decompose.hpp>
 
 // ImGui
@@ -44,6 +54,15 @@ static const String         uvCheckerName         = "__UvChecker";
 
 static const u32 minInstanceDataBufferSize = 65535;
 
+// RHIDrawSortKey pass of the meshes, the only one for now.
+static const u32 opaqueDrawPass = 0;
+
+// Fewer objects per chunk are not worth recording on another thread.
+static const u32 minObjectsPerDrawChunk = 128;
+
+// Bounding spheres culled per task, a multiple of the culling vector width.
+static const u32 cullChunkSize = 4096;
+
 const TextureSampler defaultTextureSampler {
     .minification  = SamplerFilter::Linear,
     .magnification = SamplerFilter::Linear,
@@ -51,14 +70,6 @@ const TextureSampler defaultTextureSampler {
     .wrapUV        = {SamplerWrap::Repeat, SamplerWrap::Repeat, SamplerWrap::Repeat},
 };
 
-struct IndirectDrawBatch
-{
-    Material* material;
-    RHIMesh*  mesh;
-    u32       index;
-    u32       count;
-};
-
 struct alignas(16) RHI_DrawData
 {
     u32 materialIndex   = 0;
@@ -74,6 +85,68 @@ String GetGLTFSampleModel()
     return out;
 }
 
+// Levels of detail are used as long as their error covers less than this many pixels on screen.
+static constexpr f32 kLODMaxPixelError = 1.f;
+
+// Picks the coarsest level of detail whose error, projected at the closest point of the primitive bounds, stays below
+// kLODMaxPixelError. Returns nullptr for the full detail level.
+const RHIPrimitiveLOD* SelectLOD(const RHIPrimitiveGPU& primitive, const glm::vec3& cameraPosition, f32 pixelsPerUnit)
+{
+    if (primitive.lods.empty())
+    {
+        return nullptr;
+    }
+
+    // Errors and bounds are in the primitive space.
+    const f32 scale = std::max({glm::length(glm::vec3(primitive.matrix[0])),
+                                glm::length(glm::vec3(primitive.matrix[1])),
+                                glm::length(glm::vec3(primitive.matrix[2]))});
+
+    const glm::vec3 center   = glm::vec3(primitive.matrix * glm::vec4(primitive.boundsCenter, 1.f));
+    const f32       distance = glm::length(center - cameraPosition) - primitive.boundsRadius * scale;
+
+    if (distance <= 0.f)
+    {
+        return nullptr;
+    }
+
+    const f32 pixelsPerError = scale * pixelsPerUnit / distance;
+
+    const RHIPrimitiveLOD* selected = nullptr;
+
+    for (const RHIPrimitiveLOD& lod : primitive.lods)
+    {
+        if (lod.error * pixelsPerError > kLODMaxPixelError)
+        {
+            break;
+        }
+
+        selected = &lod;
+    }
+
+    return selected;
+}
+
+// Shaders decode sRGB themselves, every format is sampled as unorm.
+vk::Format TranslateTextureCompression(TextureCompression compression)
+{
+    switch (compression)
+    {
+    case TextureCompression::BC1:
+        return vk::Format::eBc1RgbaUnormBlock;
+    case TextureCompression::BC3:
+        return vk::Format::eBc3UnormBlock;
+    case TextureCompression::BC5:
+        return vk::Format::eBc5UnormBlock;
+    case TextureCompression::BC7:
+        return vk::Format::eBc7UnormBlock;
+    case TextureCompression::None:
+    case TextureCompression::COUNT:
+    default:
+        return vk::Format::eR8G8B8A8Unorm;
+    }
+}
+
 vk::Filter TranslateSamplerFilter(SamplerFilter filter)
 {
     switch (filter)
@@ -117,23 +190,16 @@ vk::SamplerAddressMode TranslateSamplerWrap(SamplerWrap wrap)
     }
 }
 
-// TODO: Replace
-u32 CalculateNumMips(i32 width, i32 height)
+// Upload destinations are written on the transfer queue and read on the graphics one. Sharing them avoids transferring their
+// ownership, the upload and the frame submissions are ordered by the timeline semaphore already.
+template<typename CreateInfo>
+void ShareWithUploadQueue(CreateInfo& createInfo, const Vector<u32>& uploadQueueFamilies)
 {
-    u32 numMips = 1;
-
-    u32 w = width;
-    u32 h = height;
-
-    while (w > 1 && h > 1)
+    if (uploadQueueFamilies.size() > 1)
     {
-        w /= 2;
-        h /= 2;
-
-        ++numMips;
+        createInfo.sharingMode = vk::SharingMode::eConcurrent;
+        createInfo.setQueueFamilyIndices(uploadQueueFamilies);
     }
-
-    return numMips;
 }
 } // namespace
 
@@ -262,6 +328,8 @@ VulkanDevice::~VulkanDevice()
 
 void VulkanDevice::Initialize(SDL_Window* InWindowHandle)
 {
+    RequestMeshPipelineShaders();
+
     // Initialize vk::DynamicLoader - It's needed to call .dll functions.
     vk::DynamicLoader dynamicLoader;
     auto              pGetInstance = dynamicLoader.getProcAddress<PFN_vkGetInstanceProcAddr>("vkGetInstanceProcAddr");
@@ -330,6 +398,9 @@ void VulkanDevice::Initialize(SDL_Window* InWindowHandle)
 
     gpuFeatures = gpu.getFeatures();
 
+    // firstInstance selects the instance data of a draw, indirect commands can only set it with drawIndirectFirstInstance.
+    bIndirectDraws = gpuFeatures.multiDrawIndirect && gpuFeatures.drawIndirectFirstInstance;
+
     /////// Initialize Logical Device
 
     QueueFamilyIndices Indices = GetQueueFamilyIndices(gpu);
@@ -346,7 +417,11 @@ void VulkanDevice::Initialize(SDL_Window* InWindowHandle)
 
     Vector<vk::DeviceQueueCreateInfo> queueFamilies = BuildQueueCreateInfo(Indices);
 
+    // Uploads are tracked with a timeline semaphore.
+    vk::PhysicalDeviceVulkan12Features vulkan12Features {.timelineSemaphore = VK_TRUE};
+
     vk::DeviceCreateInfo deviceCreateInfo {
+        .pNext                   = &vulkan12Features,
         .queueCreateInfoCount    = static_cast<u32>(queueFamilies.size()),
         .pQueueCreateInfos       = queueFamilies.data(),
         .enabledExtensionCount   = static_cast<u32>(kDeviceExtensions.size()),
@@ -366,6 +441,19 @@ void VulkanDevice::Initialize(SDL_Window* InWindowHandle)
 
     allocator = vma::createAllocator(allocatorCreateInfo);
 
+    uploadQueueFamilies = {Indices.Graphics.value()};
+
+    if (Indices.Transfer.value() != Indices.Graphics.value())
+    {
+        uploadQueueFamilies.push_back(Indices.Transfer.value());
+    }
+
+    uploadManager.Initialize(device,
+                             allocator,
+                             device.getQueue(Indices.Transfer.value(), 0),
+                             Indices.Transfer.value(),
+                             VulkanUploadManager::kDefaultRingSize);
+
     CreateDescriptors();
 
     /////// Create Swap Chain
@@ -402,40 +490,36 @@ void VulkanDevice::Initialize(SDL_Window* InWindowHandle)
         gpuTraceContexts[index] = ZN_TRACE_GPU_CONTEXT_CREATE(contextName.c_str(), gpu, device, graphicsQueue, commandBuffers[index]);
     }
 
-    // Upload Context
-
-    vk::CommandPoolCreateInfo uploadCmdPoolCreateInfo {.flags            = vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
-                                                       .queueFamilyIndex = Indices.Graphics.value()};
+    ////// Secondary Command Buffers
 
-    uploadContext.commandPool = device.createCommandPool(graphicsPoolCreateInfo);
+    // As many draw chunks as threads recording them, the workers and the render thread.
+    const u32 numDrawChunks = ThreadPool::GetWorkerPool().GetNumThreads() + 1;
 
-    destroyQueue.Enqueue(
-        [=]()
+    for (sizet frame = 0; frame < kMaxFramesInFlight; ++frame)
+    {
+        for (u32 chunk = 0; chunk < numDrawChunks; ++chunk)
         {
-            device.destroyCommandPool(uploadContext.commandPool);
-        });
-
-    vk::CommandBufferAllocateInfo uploadCmdBufferCreateInfo {
-        .commandPool = uploadContext.commandPool, .level = vk::CommandBufferLevel::ePrimary, .commandBufferCount = 1};
-
-    uploadContext.cmdBuffer = device.allocateCommandBuffers(uploadCmdBufferCreateInfo)[0];
+            vk::CommandPool drawCommandPool = device.createCommandPool(
+                {.flags = vk::CommandPoolCreateFlagBits::eTransient, .queueFamilyIndex = Indices.Graphics.value()});
 
-    vk::FenceCreateInfo uploadFenceCreateInfo {};
-    uploadContext.fence = device.createFence(uploadFenceCreateInfo);
-
-    destroyQueue.Enqueue(
-        [=]()
-        {
-            device.destroyFence(uploadContext.fence);
-        });
+            drawCommandPools[frame].push_back(drawCommandPool);
+            drawCommandBuffers[frame].push_back(device.allocateCommandBuffers(
+                {.commandPool = drawCommandPool, .level = vk::CommandBufferLevel::eSecondary, .commandBufferCount = 1})[0]);
+        }
 
-    uploadContext.traceContext = ZN_TRACE_GPU_CONTEXT_CREATE("upload", gpu, device, graphicsQueue, uploadContext.cmdBuffer);
+        // Recorded by the render thread once the chunks are done, any pool of the frame will do.
+        imguiCommandBuffers[frame] = device.allocateCommandBuffers(
+            {.commandPool = drawCommandPools[frame][0], .level = vk::CommandBufferLevel::eSecondary, .commandBufferCount = 1})[0];
 
-    destroyQueue.Enqueue(
-        [=]()
-        {
-            ZN_TRACE_GPU_CONTEXT_DESTROY(uploadContext.traceContext);
-        });
+        destroyQueue.Enqueue(
+            [=]()
+            {
+                for (vk::CommandPool drawCommandPool : drawCommandPools[frame])
+                {
+                    device.destroyCommandPool(drawCommandPool);
+                }
+            });
+    }
 
     ////// Render Pass
 
@@ -640,12 +724,12 @@ void VulkanDevice::Initialize(SDL_Window* InWindowHandle)
 
     CreateMeshPipeline();
 
-    if (gpuFeatures.multiDrawIndirect)
+    if (bIndirectDraws)
     {
         for (i32 index = 0; index < kMaxFramesInFlight; ++index)
         {
             drawCommands[index] =
-                CreateBuffer(sizeof(vk::DrawIndexedIndirectCommand) * 4096,
+                CreateBuffer(sizeof(vk::DrawIndexedIndirectCommand) * minInstanceDataBufferSize,
                              vk::BufferUsageFlagBits::eIndirectBuffer,
                              vma::MemoryUsage::eAutoPreferHost,
                              vma::AllocationCreateFlagBits::eHostAccessSequentialWrite | vma::AllocationCreateFlagBits::eMapped);
@@ -659,6 +743,10 @@ void VulkanDevice::Initialize(SDL_Window* InWindowHandle)
     }
 
     CreateScene();
+
+    uploadManager.Flush();
+
+    ZN_LOG(LogVulkan, ELogVerbosity::Log, "Scene resources uploaded in %u submissions", uploadManager.GetNumSubmits());
 }
 
 void VulkanDevice::Cleanup()
@@ -687,12 +775,6 @@ void VulkanDevice::Cleanup()
 
     for (RHIPrimitiveGPU* gpuPrimitive : gpuPrimitives)
     {
-        DestroyBuffer(gpuPrimitive->position);
-        DestroyBuffer(gpuPrimitive->normal);
-        DestroyBuffer(gpuPrimitive->tangent);
-        DestroyBuffer(gpuPrimitive->uv);
-        DestroyBuffer(gpuPrimitive->color);
-        DestroyBuffer(gpuPrimitive->indices);
         DestroyBuffer(gpuPrimitive->uboMaterialAttributes);
 
         delete gpuPrimitive;
@@ -700,6 +782,18 @@ void VulkanDevice::Cleanup()
 
     gpuPrimitives.clear();
 
+    for (GeometryBlock& geometryBlock : geometryBlocks)
+    {
+        for (RHIBuffer& vertexStream : geometryBlock.vertexStreams)
+        {
+            DestroyBuffer(vertexStream);
+        }
+
+        DestroyBuffer(geometryBlock.indices);
+    }
+
+    geometryBlocks.clear();
+
     for (auto& meshKvp : meshes)
     {
         allocator.destroyBuffer(meshKvp.second->vertexBuffer.data, meshKvp.second->vertexBuffer.allocation);
@@ -728,11 +822,11 @@ void VulkanDevice::Cleanup()
         commandBuffers[Index] = VK_NULL_HANDLE;
     }
 
-    uploadContext.cmdBuffer = VK_NULL_HANDLE;
-
     frameBuffers.clear();
     swapChainImageViews.clear();
 
+    uploadManager.Shutdown();
+
     allocator.destroy();
 
     if (surface)
@@ -801,6 +895,12 @@ void VulkanDevice::Draw()
     // naming it commandBuffer for shorter writing
     vk::CommandBuffer commandBuffer = commandBuffers[currentFrame];
 
+    // BeginFrame waited for the fence of the frame, its secondary command buffers are no longer in use.
+    for (vk::CommandPool drawCommandPool : drawCommandPools[currentFrame])
+    {
+        device.resetCommandPool(drawCommandPool);
+    }
+
     // begin the command buffer recording. We will use this command buffer exactly once, so we want to let Vulkan know that
 
     commandBuffer.begin(vk::CommandBufferBeginInfo {.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
@@ -831,7 +931,8 @@ void VulkanDevice::Draw()
         vk::ClearValue clearValues[2] = {clearColor, depthClear};
         renderPassBeginInfo.setClearValues(clearValues);
 
-        commandBuffer.beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eInline);
+        // Everything in the render pass is recorded into secondary command buffers.
+        commandBuffer.beginRenderPass(renderPassBeginInfo, vk::SubpassContents::eSecondaryCommandBuffers);
 
         // *** Insert Commands here ***
         {
@@ -861,10 +962,16 @@ void VulkanDevice::Draw()
 
             CopyToGPU(lightingBuffer[currentFrame].allocation, &lighting, sizeof(UBOLights));
 
-            DrawObjects(commandBuffer, renderables.data(), renderables.size());
+            CullRenderables(camera.view_projection);
+
+            DrawObjects(commandBuffer, visibleRenderables.data(), visibleRenderables.size());
 
             // Enqueue ImGui commands to CmdBuffer
-            ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), commandBuffer);
+            BeginSecondaryCommandBuffer(imguiCommandBuffers[currentFrame]);
+            ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), imguiCommandBuffers[currentFrame]);
+            imguiCommandBuffers[currentFrame].end();
+
+            commandBuffer.executeCommands(imguiCommandBuffers[currentFrame]);
         }
 
         // finalize the render pass
@@ -889,17 +996,26 @@ void Zn::VulkanDevice::EndFrame()
     // prepare the submission to the queue.
     // we want to wait on the m_VkPresentSemaphore, as that semaphore is signaled when the swapchain is ready
     // we will signal the m_VkRenderSemaphore, to signal that rendering has finished
+    // the frame also waits for the uploads recorded so far, the timeline semaphore makes their writes visible to every stage
+
+    const u64 uploadValue = uploadManager.Flush();
 
-    vk::Semaphore waitSemaphores[]   = {presentSemaphores[currentFrame]};
+    vk::Semaphore waitSemaphores[]   = {presentSemaphores[currentFrame], uploadManager.GetTimelineSemaphore()};
     vk::Semaphore signalSemaphores[] = {renderSemaphores[currentFrame]};
 
-    vk::SubmitInfo submitInfo {};
+    // Binary semaphores ignore their value.
+    const u64 waitValues[] = {0, uploadValue};
 
-    vk::PipelineStageFlags waitStage = vk::PipelineStageFlagBits::eColorAttachmentOutput;
+    vk::TimelineSemaphoreSubmitInfo timelineSubmitInfo {};
+    timelineSubmitInfo.setWaitSemaphoreValues(waitValues);
 
-    submitInfo.pWaitDstStageMask = &waitStage;
+    vk::SubmitInfo submitInfo {.pNext = &timelineSubmitInfo};
 
-    submitInfo.waitSemaphoreCount = 1;
+    vk::PipelineStageFlags waitStages[] = {vk::PipelineStageFlagBits::eColorAttachmentOutput, vk::PipelineStageFlagBits::eAllCommands};
+
+    submitInfo.pWaitDstStageMask = waitStages;
+
+    submitInfo.waitSemaphoreCount = 2;
     submitInfo.pWaitSemaphores    = waitSemaphores;
 
     submitInfo.signalSemaphoreCount = 1;
@@ -988,14 +1104,24 @@ vk::PhysicalDevice VulkanDevice::SelectPhysicalDevice(const Vector<vk::PhysicalD
 
         u32 deviceScore = 0;
 
-        const bool hasGraphicsQueue = GetQueueFamilyIndices(device).Graphics.has_value();
+        const QueueFamilyIndices queueFamilyIndices = GetQueueFamilyIndices(device);
+
+        const bool hasGraphicsQueue = queueFamilyIndices.Graphics.has_value();
 
         const bool hasRequiredExtensions = HasRequiredDeviceExtensions(device);
 
-        if (hasGraphicsQueue && hasRequiredExtensions)
+        vk::PhysicalDeviceProperties deviceProperties = device.getProperties();
+
+        // Uploads are tracked with a timeline semaphore, core since 1.2.
+        const bool hasTimelineSemaphore =
+            deviceProperties.apiVersion >= VK_API_VERSION_1_2 &&
+            device.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceVulkan12Features>()
+                .get<vk::PhysicalDeviceVulkan12Features>()
+                .timelineSemaphore;
+
+        if (hasGraphicsQueue && hasRequiredExtensions && hasTimelineSemaphore)
         {
-            vk::PhysicalDeviceProperties deviceProperties = device.getProperties();
-            vk::PhysicalDeviceFeatures   deviceFeatures   = device.getFeatures();
+            vk::PhysicalDeviceFeatures deviceFeatures = device.getFeatures();
 
             if (deviceProperties.deviceType == vk::PhysicalDeviceType::eDiscreteGpu)
             {
@@ -1011,6 +1137,12 @@ vk::PhysicalDevice VulkanDevice::SelectPhysicalDevice(const Vector<vk::PhysicalD
                 deviceScore += 500;
             }
 
+            // Uploads run alongside the frames.
+            if (queueFamilyIndices.Transfer != queueFamilyIndices.Graphics)
+            {
+                deviceScore += 100;
+            }
+
             // TODO: Add more criteria to choose GPU.
         }
 
@@ -1051,6 +1183,18 @@ QueueFamilyIndices VulkanDevice::GetQueueFamilyIndices(vk::PhysicalDevice inDevi
         {
             outIndices.Present = idx;
         }
+
+        // The copy engine, the family that can transfer but neither draw nor dispatch.
+        if ((queueFamily.queueFlags & vk::QueueFlagBits::eTransfer) &&
+            !(queueFamily.queueFlags & (vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute)) && !outIndices.Transfer.has_value())
+        {
+            outIndices.Transfer = idx;
+        }
+    }
+
+    if (!outIndices.Transfer.has_value())
+    {
+        outIndices.Transfer = outIndices.Graphics;
     }
 
     return outIndices;
@@ -1067,7 +1211,7 @@ SwapChainDetails VulkanDevice::GetSwapChainDetails(vk::PhysicalDevice inGPU) con
 
 Vector<vk::DeviceQueueCreateInfo> VulkanDevice::BuildQueueCreateInfo(const QueueFamilyIndices& InIndices) const
 {
-    UnorderedSet<u32> queues = {InIndices.Graphics.value(), InIndices.Present.value()};
+    UnorderedSet<u32> queues = {InIndices.Graphics.value(), InIndices.Present.value(), InIndices.Transfer.value()};
 
     Vector<vk::DeviceQueueCreateInfo> outCreateInfo {};
     outCreateInfo.reserve(queues.size());
@@ -1088,8 +1232,11 @@ Vector<vk::DeviceQueueCreateInfo> VulkanDevice::BuildQueueCreateInfo(const Queue
     return outCreateInfo;
 }
 
-vk::ShaderModule Zn::VulkanDevice::CreateShaderModule(const Vector<uint8>& bytes)
+vk::ShaderModule Zn::VulkanDevice::CreateShaderModule(std::span<const uint8> bytes)
 {
+    // SPIR-V is consumed as words, which both Vector storage and mapped views satisfy.
+    check(reinterpret_cast<uintptr_t>(bytes.data()) % alignof(uint32_t) == 0);
+
     vk::ShaderModuleCreateInfo shaderCreateInfo {};
     shaderCreateInfo.codeSize = bytes.size();
     shaderCreateInfo.pCode    = reinterpret_cast<const uint32_t*>(bytes.data());
@@ -1178,22 +1325,14 @@ void Zn::VulkanDevice::CreateDescriptors()
 
         // Matrices
 
-        /* if (gpuFeatures.multiDrawIndirect)
-         {
-             instanceData[Index] = CreateBuffer(
-                 sizeof(RHIInstanceData) * minInstanceDataBufferSize, vk::BufferUsageFlagBits::eVertexBuffer, vma::MemoryUsage::eCpuToGpu);
-         }
-         else
-         {
-             instanceData[Index] = CreateBuffer(
-                 sizeof(RHIInstanceData) * minInstanceDataBufferSize, vk::BufferUsageFlagBits::eUniformBuffer, vma::MemoryUsage::eCpuToGpu);
-         }
-
-         destroyQueue.Enqueue(
-             [=]()
-             {
-                 DestroyBuffer(instanceData[Index]);
-             });*/
+        instanceData[Index] = CreateBuffer(
+            sizeof(RHIInstanceData) * minInstanceDataBufferSize, vk::BufferUsageFlagBits::eVertexBuffer, vma::MemoryUsage::eCpuToGpu);
+
+        destroyQueue.Enqueue(
+            [=]()
+            {
+                DestroyBuffer(instanceData[Index]);
+            });
 
         vk::DescriptorSetAllocateInfo descriptorSetAllocInfo {};
         descriptorSetAllocInfo.descriptorPool     = descriptorPool;
@@ -1492,6 +1631,11 @@ RHIBuffer Zn::VulkanDevice::CreateBuffer(size_t                     size,
 {
     vk::BufferCreateInfo createInfo {.size = size, .usage = usage};
 
+    if (usage & vk::BufferUsageFlagBits::eTransferDst)
+    {
+        ShareWithUploadQueue(createInfo, uploadQueueFamilies);
+    }
+
     vma::AllocationCreateInfo allocationInfo {
         .flags         = allocationFlags,
         .usage         = memoryUsage,
@@ -1528,162 +1672,311 @@ RHIMesh* Zn::VulkanDevice::GetMesh(const String& InName)
     return nullptr;
 }
 
-void Zn::VulkanDevice::DrawObjects(vk::CommandBuffer commandBuffer, RenderObject* first, u64 count)
+void Zn::VulkanDevice::CullRenderables(const glm::mat4& viewProjection)
 {
     ZN_TRACE_QUICKSCOPE();
 
-    SetViewport(commandBuffer);
+    const RHIFrustum frustum = RHIFrustum::FromViewProjection(viewProjection);
 
-    for (u64 index = 0; index < count; ++index)
-    {
-        RenderObject* current = first + index;
+    const sizet numRenderables = renderables.size();
+    const sizet numChunks      = (numRenderables + cullChunkSize - 1) / cullChunkSize;
 
-        commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, current->material->pipeline);
+    renderableVisibility.resize(numRenderables);
 
-        u32 offset = 0;
+    Vector<u32> chunkVisible(numChunks);
 
-        // Global Descriptor Set
-        commandBuffer.bindDescriptorSets(
-            vk::PipelineBindPoint::eGraphics, current->material->layout, 0, globalDescriptorSets[currentFrame], {});
+    // A single chunk is culled on the calling thread.
+    ThreadPool::GetWorkerPool().ParallelFor(numChunks,
+                                            [&](sizet chunk)
+                                            {
+                                                const sizet first = chunk * cullChunkSize;
+                                                const sizet count = std::min<sizet>(cullChunkSize, numRenderables - first);
 
-        // Primitive/Material Descriptor Set
-        commandBuffer.bindDescriptorSets(
-            vk::PipelineBindPoint::eGraphics, current->material->layout, 1, gpuPrimitivesDescriptorSets[current->primitive], {});
+                                                chunkVisible[chunk] = RHIFrustumCulling::Cull(
+                                                    frustum, renderableBounds, first, count, renderableVisibility.data() + first);
+                                            });
 
-        commandBuffer.bindVertexBuffers(0,
-                                        {
-                                            current->primitive->position.data,
-                                            current->primitive->normal.data,
-                                            current->primitive->tangent.data,
-                                            current->primitive->uv.data,
-                                            // current->primitive->color.data,
-                                        },
-                                        {offset, offset, offset, offset});
+    u32 numVisible = 0;
+
+    for (u32 visibleInChunk : chunkVisible)
+    {
+        numVisible += visibleInChunk;
+    }
 
-        bool isIndexedDraw = current->primitive->numIndices > 0;
+    visibleRenderables.clear();
+    visibleRenderables.reserve(numVisible);
 
-        if (isIndexedDraw)
+    for (sizet index = 0; index < numRenderables; ++index)
+    {
+        if (renderableVisibility[index])
         {
-            // TODO: Save index type into primitive?
-            commandBuffer.bindIndexBuffer(current->primitive->indices.data, offset, vk::IndexType::eUint32);
+            visibleRenderables.push_back(renderables[index]);
         }
+    }
+
+    check(visibleRenderables.size() == numVisible);
+
+    cullStats.numVisible = numVisible;
+    cullStats.numCulled  = static_cast<u32>(numRenderables) - numVisible;
+
+    ZN_TRACE_PLOT("Visible Renderables", static_cast<i64>(cullStats.numVisible));
+    ZN_TRACE_PLOT("Culled Renderables", static_cast<i64>(cullStats.numCulled));
+}
+
+void Zn::VulkanDevice::DrawObjects(vk::CommandBuffer commandBuffer, RenderObject* first, u64 count)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    drawStats = DrawStats {};
+
+    // Instance data and indirect commands have room for minInstanceDataBufferSize objects.
+    check(count <= minInstanceDataBufferSize);
+
+    count = std::min<u64>(count, minInstanceDataBufferSize);
+
+    drawKeys.clear();
+    drawOrder.clear();
+
+    // Front to back within a state, from the distance to the bounds center.
+    for (u32 index = 0; index < static_cast<u32>(count); ++index)
+    {
+        const RHIPrimitiveGPU& primitive = *first[index].primitive;
+
+        const glm::vec3 center   = glm::vec3(primitive.matrix * glm::vec4(primitive.boundsCenter, 1.f));
+        const f32       distance = glm::length(center - cameraView.position);
+        const u32       depth    = RHIDrawSortKey::QuantizeDepth(distance, cameraView.nearClip, cameraView.farClip);
+
+        drawKeys.push_back(first[index].sortKey | RHIDrawSortKey::Encode(0, 0, 0, 0, depth));
+        drawOrder.push_back(index);
+    }
+
+    RHIDrawSortKey::Sort(drawKeys, drawOrder, scratchDrawKeys, scratchDrawOrder);
+
+    sortedRenderables.clear();
+
+    for (const u32 index : drawOrder)
+    {
+        sortedRenderables.push_back(first + index);
+    }
+
+    // Objects of a batch have the same state bits. Non indexed primitives are drawn one by one, they only break the batch.
+    auto IsBatched = [this](u32 index)
+    {
+        const RenderObject* previous = sortedRenderables[index - 1];
+        const RenderObject* current  = sortedRenderables[index];
+
+        return RHIDrawSortKey::GetStateBits(drawKeys[index]) == RHIDrawSortKey::GetStateBits(drawKeys[index - 1]) &&
+               (previous->primitive->numIndices == 0) == (current->primitive->numIndices == 0);
+    };
+
+    // Size in pixels of a unit seen at a distance of one unit.
+    const f32 pixelsPerUnit = static_cast<f32>(swapChainExtent.height) / (2.f * std::tan(glm::radians(cameraView.fov) * 0.5f));
 
-        static const auto identity = glm::mat4 {1.f};
+    drawInstances.clear();
+    indirectCommands.clear();
+    drawBatches.clear();
 
-        // glm::mat4 matrix = identity;
-        // matrix           = glm::translate(matrix, current->location);
-        // matrix *= glm::mat4(current->rotation);
-        // matrix = glm::scale(matrix, current->scale);
+    for (u32 index = 0; index < static_cast<u32>(sortedRenderables.size()); ++index)
+    {
+        const RenderObject*    object    = sortedRenderables[index];
+        const RHIPrimitiveGPU& primitive = *object->primitive;
 
-        // glm::mat4 translation = glm::translate(identity, current->location);
-        // glm::mat4 rotation    = glm::mat4_cast(current->rotation);
-        // glm::mat4 scale       = glm::scale_slow(identity, glm::vec3(current->scale.x, current->scale.y, current->scale.z));
+        drawInstances.push_back(RHIInstanceData {.m = primitive.matrix * primitive.dequantization});
 
-        MeshPushConstants constants {
-            .model         = current->primitive->matrix,
-            .model_inverse = glm::inverseTranspose(current->primitive->matrix),
+        // firstInstance is the index of the object instance data. Non indexed primitives leave the command empty.
+        vk::DrawIndexedIndirectCommand command {
+            .instanceCount = 1,
+            .vertexOffset  = static_cast<i32>(primitive.vertexOffset),
+            .firstInstance = index,
         };
 
-        commandBuffer.pushConstants(current->material->layout, vk::ShaderStageFlagBits::eVertex, 0, sizeof(MeshPushConstants), &constants);
+        if (primitive.numIndices > 0)
+        {
+            const RHIPrimitiveLOD* lod = SelectLOD(primitive, cameraView.position, pixelsPerUnit);
+
+            command.indexCount = lod ? lod->numIndices : primitive.numIndices;
+            command.firstIndex = primitive.firstIndex + (lod ? lod->firstIndex : 0);
+        }
+
+        indirectCommands.push_back(command);
 
-        if (isIndexedDraw)
+        if (index == 0 || !IsBatched(index))
         {
-            commandBuffer.drawIndexed(current->primitive->numIndices, 1, 0, 0, 0);
+            drawBatches.push_back(IndirectDrawBatch {.object = object, .first = index, .count = 1});
         }
         else
         {
-            commandBuffer.draw(current->primitive->numVertices, 1, 0, 0);
+            ++drawBatches.back().count;
         }
     }
-    /*if (gpuFeatures.multiDrawIndirect)
+
+    if (drawBatches.empty())
     {
-        IndirectDrawBatch drawBatches[64] = {0};
+        return;
+    }
 
-        i32 batchCount = -1;
+    CopyToGPU(instanceData[currentFrame].allocation, drawInstances.data(), drawInstances.size() * sizeof(RHIInstanceData));
 
-        {
-            RHIMesh*  lastMesh     = nullptr;
-            Material* lastMaterial = nullptr;
+    if (bIndirectDraws)
+    {
+        CopyToGPU(drawCommands[currentFrame].allocation,
+                  indirectCommands.data(),
+                  indirectCommands.size() * sizeof(vk::DrawIndexedIndirectCommand));
+    }
 
-            for (u32 index = 0; index < count; ++index)
-            {
-                RenderObject& object = first[index];
+    // Chunks of consecutive batches with about the same number of objects, small draw lists are recorded in a single chunk.
+    const u32 maxChunks       = static_cast<u32>(drawCommandBuffers[currentFrame].size());
+    const u32 numChunks       = std::clamp(static_cast<u32>(count) / minObjectsPerDrawChunk, 1u, maxChunks);
+    const u32 objectsPerChunk = (static_cast<u32>(count) + numChunks - 1) / numChunks;
 
-                if (object.material != lastMaterial || lastMesh != object.mesh)
-                {
-                    ++batchCount;
+    Vector<std::pair<u32, u32>> chunkBatches;
 
-                    IndirectDrawBatch& batch = drawBatches[batchCount];
+    for (u32 batch = 0, firstBatch = 0, numChunkObjects = 0; batch < static_cast<u32>(drawBatches.size()); ++batch)
+    {
+        numChunkObjects += drawBatches[batch].count;
 
-                    batch = IndirectDrawBatch {
-                        .material = object.material,
-                        .mesh     = object.mesh,
-                        .index    = index,
-                        .count    = 1,
-                    };
+        if (numChunkObjects >= objectsPerChunk || batch + 1 == drawBatches.size())
+        {
+            chunkBatches.emplace_back(firstBatch, batch + 1);
 
-                    lastMesh     = object.mesh;
-                    lastMaterial = object.material;
-                }
-                else
-                {
-                    ++drawBatches[batchCount].count;
-                }
-            }
+            firstBatch      = batch + 1;
+            numChunkObjects = 0;
         }
+    }
 
-        vk::DrawIndexedIndirectCommand* dst =
-            reinterpret_cast<vk::DrawIndexedIndirectCommand*>(allocator.mapMemory(drawCommands[currentFrame].allocation));
+    Vector<DrawStats> chunkStats(chunkBatches.size());
 
-        for (u64 index = 0; index < count; ++index)
-        {
-            RenderObject& object = first[index];
-
-            dst[index] = vk::DrawIndexedIndirectCommand {
-                .indexCount    = static_cast<u32>(object.mesh->indices.size()),
-                .instanceCount = 1,
-                .firstIndex    = 0,
-                .vertexOffset  = 0,
-                .firstInstance = static_cast<u32>(index),
-            };
-        }
+    ThreadPool::GetWorkerPool().ParallelFor(chunkBatches.size(),
+                                            [&](sizet chunk)
+                                            {
+                                                const auto [firstBatch, lastBatch] = chunkBatches[chunk];
 
-        allocator.unmapMemory(drawCommands[currentFrame].allocation);
+                                                vk::CommandBuffer chunkCommandBuffer = drawCommandBuffers[currentFrame][chunk];
 
-        SetViewport(commandBuffer);
+                                                BeginSecondaryCommandBuffer(chunkCommandBuffer);
+                                                RecordDrawBatches(chunkCommandBuffer, firstBatch, lastBatch, chunkStats[chunk]);
+                                                chunkCommandBuffer.end();
+                                            });
+
+    commandBuffer.executeCommands(static_cast<u32>(chunkBatches.size()), drawCommandBuffers[currentFrame].data());
 
-        for (i32 batchIndex = 0; batchIndex < batchCount + 1; ++batchIndex)
+    for (const DrawStats& stats : chunkStats)
+    {
+        drawStats.numDrawCalls += stats.numDrawCalls;
+        drawStats.numPipelineBinds += stats.numPipelineBinds;
+        drawStats.numDescriptorBinds += stats.numDescriptorBinds;
+        drawStats.numGeometryBinds += stats.numGeometryBinds;
+    }
+
+    drawStats.numObjects = static_cast<u32>(count);
+    drawStats.numBatches = static_cast<u32>(drawBatches.size());
+
+    ZN_TRACE_PLOT("Draw Batches", static_cast<i64>(drawStats.numBatches));
+    ZN_TRACE_PLOT("Draw Calls", static_cast<i64>(drawStats.numDrawCalls));
+    ZN_TRACE_PLOT("Draw State Changes",
+                  static_cast<i64>(drawStats.numPipelineBinds + drawStats.numDescriptorBinds + drawStats.numGeometryBinds));
+}
+
+void Zn::VulkanDevice::RecordDrawBatches(vk::CommandBuffer commandBuffer, u32 firstBatch, u32 lastBatch, DrawStats& outStats)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    // Secondary command buffers don't inherit any state.
+    SetViewport(commandBuffer);
+
+    // Instance data stays bound across pipelines, like the vertex and index buffers until the geometry block changes.
+    const vk::DeviceSize instanceOffset = 0;
+
+    commandBuffer.bindVertexBuffers(VulkanPipeline::kInstanceBinding, 1, &instanceData[currentFrame].data, &instanceOffset);
+
+    vk::Pipeline      boundPipeline;
+    vk::DescriptorSet boundMaterialSet;
+    u32               boundGeometryBlock = std::numeric_limits<u32>::max();
+
+    const u32 stride = sizeof(vk::DrawIndexedIndirectCommand);
+
+    for (u32 batchIndex = firstBatch; batchIndex < lastBatch; ++batchIndex)
+    {
+        const IndirectDrawBatch& batch  = drawBatches[batchIndex];
+        const RenderObject&      object = *batch.object;
+
+        if (object.material->pipeline != boundPipeline)
         {
-            const IndirectDrawBatch& batch = drawBatches[batchIndex];
+            boundPipeline    = object.material->pipeline;
+            boundMaterialSet = vk::DescriptorSet {};
 
-            commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, batch.material->pipeline);
+            commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, boundPipeline);
 
-            u32 globalOffset = sizeof(RHIInstanceData) * batch.count;
+            // Global Descriptor Set
             commandBuffer.bindDescriptorSets(
-                vk::PipelineBindPoint::eGraphics, batch.material->layout, 0, globalDescriptorSets[currentFrame], {globalOffset});
+                vk::PipelineBindPoint::eGraphics, object.material->layout, 0, globalDescriptorSets[currentFrame], {});
 
-            if (batch.material->textureSet)
-            {
-                commandBuffer.bindDescriptorSets(
-                    vk::PipelineBindPoint::eGraphics, batch.material->layout, 1, batch.material->textureSet, {});
-            }
+            ++outStats.numPipelineBinds;
+            ++outStats.numDescriptorBinds;
+        }
 
-            vk::DeviceSize offset = 0;
-            commandBuffer.bindVertexBuffers(0, 1, &batch.mesh->vertexBuffer.data, &offset);
+        // Primitive/Material Descriptor Set
+        if (object.materialSet != boundMaterialSet)
+        {
+            boundMaterialSet = object.materialSet;
+
+            commandBuffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics, object.material->layout, 1, boundMaterialSet, {});
+
+            ++outStats.numDescriptorBinds;
+        }
+
+        if (object.primitive->geometryBlock != boundGeometryBlock)
+        {
+            boundGeometryBlock = object.primitive->geometryBlock;
+            BindGeometryBlock(commandBuffer, boundGeometryBlock);
 
-            commandBuffer.bindVertexBuffers(1, 1, &instanceData[currentFrame].data, &offset);
+            ++outStats.numGeometryBinds;
+        }
 
-            if (batch.mesh->indexBuffer.data)
+        if (object.primitive->numIndices == 0)
+        {
+            for (u32 index = batch.first; index < batch.first + batch.count; ++index)
             {
-                commandBuffer.bindIndexBuffer(batch.mesh->indexBuffer.data, 0, vk::IndexType::eUint32);
+                const RHIPrimitiveGPU& primitive = *sortedRenderables[index]->primitive;
+
+                commandBuffer.draw(primitive.numVertices, 1, primitive.vertexOffset, index);
             }
 
-            vk::DeviceSize indirectOffset = batch.index * sizeof(vk::DrawIndexedIndirectCommand);
-            u32            stride         = sizeof(vk::DrawIndexedIndirectCommand);
+            outStats.numDrawCalls += batch.count;
+        }
+        else if (bIndirectDraws)
+        {
+            commandBuffer.drawIndexedIndirect(drawCommands[currentFrame].data, batch.first * stride, batch.count, stride);
 
-            commandBuffer.drawIndexedIndirect(drawCommands[currentFrame].data, indirectOffset, batch.count, stride);
+            ++outStats.numDrawCalls;
         }
-    }*/
+        else
+        {
+            for (u32 index = batch.first; index < batch.first + batch.count; ++index)
+            {
+                const vk::DrawIndexedIndirectCommand& command = indirectCommands[index];
+
+                commandBuffer.drawIndexed(
+                    command.indexCount, command.instanceCount, command.firstIndex, command.vertexOffset, command.firstInstance);
+            }
+
+            outStats.numDrawCalls += batch.count;
+        }
+    }
+}
+
+void Zn::VulkanDevice::BeginSecondaryCommandBuffer(vk::CommandBuffer commandBuffer) const
+{
+    vk::CommandBufferInheritanceInfo inheritanceInfo {
+        .renderPass  = renderPass,
+        .subpass     = 0,
+        .framebuffer = frameBuffers[swapChainImageIndex],
+    };
+
+    commandBuffer.begin({
+        .flags            = vk::CommandBufferUsageFlagBits::eOneTimeSubmit | vk::CommandBufferUsageFlagBits::eRenderPassContinue,
+        .pInheritanceInfo = &inheritanceInfo,
+    });
 }
 
 void Zn::VulkanDevice::CreateScene()
@@ -1691,10 +1984,28 @@ void Zn::VulkanDevice::CreateScene()
     Material* basePbrNoCull = VulkanMaterialManager::Get().GetMaterial("base_pbr_no_cull");
     Material* basePbrCull   = VulkanMaterialManager::Get().GetMaterial("base_pbr_cull");
 
+    // Primitives with the same material share their set, so that they can be drawn in the same batch.
+    Vector<std::pair<MaterialAttributes, vk::DescriptorSet>> materialSets;
+
     for (RHIPrimitiveGPU* primitive : gpuPrimitives)
     {
         Material* primitiveMaterial = primitive->materialAttributes.doubleSided ? basePbrCull : basePbrNoCull;
 
+        const MaterialAttributes attributes = primitive->materialAttributes;
+
+        auto sharedSet = std::find_if(materialSets.begin(),
+                                      materialSets.end(),
+                                      [&attributes](const std::pair<MaterialAttributes, vk::DescriptorSet>& materialSet)
+                                      {
+                                          return materialSet.first == attributes;
+                                      });
+
+        if (sharedSet != materialSets.end())
+        {
+            renderables.push_back(RenderObject {.primitive = primitive, .material = primitiveMaterial, .materialSet = sharedSet->second});
+            continue;
+        }
+
         vk::DescriptorSetAllocateInfo materialSetAllocateInfo {
             .descriptorPool     = descriptorPool,
             .descriptorSetCount = 1,
@@ -1793,39 +2104,75 @@ void Zn::VulkanDevice::CreateScene()
 
         device.updateDescriptorSets(writeOperations, {});
 
-        gpuPrimitivesDescriptorSets.insert({primitive, perPrimitiveSet});
+        materialSets.emplace_back(attributes, perPrimitiveSet);
 
         RenderObject entity {
-            .primitive = primitive,
-            .material  = primitiveMaterial,
+            .primitive   = primitive,
+            .material    = primitiveMaterial,
+            .materialSet = perPrimitiveSet,
         };
 
         renderables.push_back(std::move(entity));
     }
+
+    // State bits of the sort keys, DrawObjects adds the depth every frame.
+    Vector<vk::Pipeline> pipelines;
+
+    for (RenderObject& renderable : renderables)
+    {
+        auto pipeline = std::find(pipelines.begin(), pipelines.end(), renderable.material->pipeline);
+
+        if (pipeline == pipelines.end())
+        {
+            pipeline = pipelines.insert(pipelines.end(), renderable.material->pipeline);
+        }
+
+        auto materialSet = std::find_if(materialSets.begin(),
+                                        materialSets.end(),
+                                        [&renderable](const std::pair<MaterialAttributes, vk::DescriptorSet>& materialSet)
+                                        {
+                                            return materialSet.second == renderable.materialSet;
+                                        });
+
+        renderable.sortKey = RHIDrawSortKey::Encode(opaqueDrawPass,
+                                                    static_cast<u32>(pipeline - pipelines.begin()),
+                                                    static_cast<u32>(materialSet - materialSets.begin()),
+                                                    renderable.primitive->geometryBlock,
+                                                    0);
+
+        const RHIPrimitiveGPU& primitive = *renderable.primitive;
+
+        // The radius grows with the largest scale of the matrix.
+        const f32 scale = std::max({glm::length(glm::vec3(primitive.matrix[0])),
+                                    glm::length(glm::vec3(primitive.matrix[1])),
+                                    glm::length(glm::vec3(primitive.matrix[2]))});
+
+        renderableBounds.Add(glm::vec3(primitive.matrix * glm::vec4(primitive.boundsCenter, 1.f)), primitive.boundsRadius * scale);
+    }
+
+    check(pipelines.size() <= (1ull << RHIDrawSortKey::kPipelineBits) && materialSets.size() <= (1ull << RHIDrawSortKey::kMaterialBits));
+
+    ZN_LOG(LogVulkan, ELogVerbosity::Log, "%zu primitives share %zu material sets", renderables.size(), materialSets.size());
 }
 
 void Zn::VulkanDevice::CreateDefaultTexture(const String& name, const u8 (&color)[4])
 {
     RHITexture* defaultTexture = CreateRHITexture(1, 1, vk::Format::eR8G8B8A8Unorm);
 
-    RHIBuffer stagingBuffer = CreateBuffer(1 * sizeof(u8) * 4, vk::BufferUsageFlagBits::eTransferSrc, vma::MemoryUsage::eCpuOnly);
+    const VulkanStagingAllocation staging = uploadManager.AllocateStaging(ArrayLength(color));
 
-    CopyToGPU(stagingBuffer.allocation, ArrayData(color), ArrayLength(color));
+    memcpy(staging.data.data(), ArrayData(color), ArrayLength(color));
 
-    ImmediateSubmit(
-        [=](vk::CommandBuffer cmd)
-        {
-            TransitionImageLayout(
-                cmd, defaultTexture->image, vk::Format::eR8G8B8A8Unorm, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
-            CopyBufferToImage(cmd, stagingBuffer.data, defaultTexture->image, 1, 1);
-            TransitionImageLayout(cmd,
-                                  defaultTexture->image,
-                                  vk::Format::eR8G8B8A8Unorm,
-                                  vk::ImageLayout::eTransferDstOptimal,
-                                  vk::ImageLayout::eShaderReadOnlyOptimal);
-        });
+    vk::CommandBuffer cmd = uploadManager.RecordUpload(staging);
 
-    DestroyBuffer(stagingBuffer);
+    TransitionImageLayout(
+        cmd, defaultTexture->image, vk::Format::eR8G8B8A8Unorm, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
+    CopyBufferToImage(cmd, staging.buffer, staging.offset, defaultTexture->image, 1, 1, 1, TextureCompression::None);
+    TransitionImageLayout(cmd,
+                          defaultTexture->image,
+                          vk::Format::eR8G8B8A8Unorm,
+                          vk::ImageLayout::eTransferDstOptimal,
+                          vk::ImageLayout::eShaderReadOnlyOptimal);
 
     vk::ImageViewCreateInfo imageViewInfo {.image            = defaultTexture->image,
                                            .viewType         = vk::ImageViewType::e2D,
@@ -1868,11 +2215,26 @@ void Zn::VulkanDevice::LoadMeshes()
 
     if (String gltfSampleModelName = GetGLTFSampleModel(); !gltfSampleModelName.empty())
     {
-        gltfModelPath = gltfSampleModels + '/' + gltfSampleModelName + "/glTF/" + gltfSampleModelName + ".gltf";
+        // -gltfBinary picks the .glb variant of the sample model.
+        if (CommandLine::Get().Param("-gltfBinary"))
+        {
+            gltfModelPath = gltfSampleModels + '/' + gltfSampleModelName + "/glTF-Binary/" + gltfSampleModelName + ".glb";
+        }
+        else
+        {
+            gltfModelPath = gltfSampleModels + '/' + gltfSampleModelName + "/glTF/" + gltfSampleModelName + ".gltf";
+        }
+    }
+
+    const String sourcePath = IO::GetAbsolutePath(gltfModelPath);
+
+    if (LoadCookedMesh(sourcePath))
+    {
+        return;
     }
 
     MeshImporterOutput gltfOutput;
-    if (MeshImporter::ImportAll(IO::GetAbsolutePath(gltfModelPath), gltfOutput))
+    if (MeshImporter::ImportAll(sourcePath, gltfOutput))
     {
         ZN_TRACE_QUICKSCOPE();
 
@@ -1884,170 +2246,386 @@ void Zn::VulkanDevice::LoadMeshes()
 
             if (auto samplerIt = gltfOutput.samplers.find(it.first); samplerIt != gltfOutput.samplers.end())
             {
-                texture->sampler = CreateSampler(samplerIt->second, CalculateNumMips(texture->width, texture->height));
+                texture->sampler = CreateSampler(samplerIt->second, texture->numMips);
             }
         }
 
-        i32 index = 0;
-
         for (const RHIPrimitive& cpuPrimitive : gltfOutput.primitives)
         {
-            ZN_TRACE_QUICKSCOPE();
-            RHIPrimitiveGPU* gpuPrimitive = new RHIPrimitiveGPU();
+            gpuPrimitives.emplace_back(CreatePrimitive(RHIPrimitiveView::From(cpuPrimitive)));
+        }
+    }
+}
 
-            // TODO: Very inefficient to create and submit buffers one by one.
+bool Zn::VulkanDevice::LoadCookedMesh(const String& sourcePath)
+{
+    ZN_TRACE_QUICKSCOPE();
 
-            gpuPrimitive->matrix      = cpuPrimitive.matrix;
-            gpuPrimitive->numVertices = cpuPrimitive.position.size();
-            gpuPrimitive->numIndices  = cpuPrimitive.indices.size();
+    CookedMesh cookedMesh;
 
-            gpuPrimitive->position = CreateRHIBuffer(cpuPrimitive.position.data(),
-                                                     cpuPrimitive.position.size() * sizeof(glm::vec3),
-                                                     vk::BufferUsageFlagBits::eVertexBuffer,
-                                                     vma::MemoryUsage::eGpuOnly);
-            if (cpuPrimitive.normal.size() > 0)
-            {
-                gpuPrimitive->normal = CreateRHIBuffer(cpuPrimitive.normal.data(),
-                                                       cpuPrimitive.normal.size() * sizeof(glm::vec3),
-                                                       vk::BufferUsageFlagBits::eVertexBuffer,
-                                                       vma::MemoryUsage::eGpuOnly);
-            }
-            else
-            {
-                ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Unable to find Normal buffer for primitive. Creating default.");
-                Vector<glm::vec3> dummy;
-                dummy.resize(cpuPrimitive.position.size());
+    if (!MeshImporter::ImportCooked(sourcePath, cookedMesh))
+    {
+        return false;
+    }
+
+    const std::filesystem::path sourceDirectory = std::filesystem::path(sourcePath).parent_path();
+
+    const Vector<CookedMeshTexture>& cookedTextures = cookedMesh.GetTextures();
+
+    // Textures are decoded on the workers straight into their staging memory, each one is recorded for upload as soon as it is done.
+    TextureImportQueue importQueue;
 
-                memset(dummy.data(), 0, dummy.size() * sizeof(glm::vec3));
+    for (const CookedMeshTexture& cookedTexture : cookedTextures)
+    {
+        TextureImportSettings settings = cookedTexture.settings;
+
+        // Decoding to RGBA8 costs less than compressing then decompressing for devices that can't sample blocks.
+        if (!gpuFeatures.textureCompressionBC)
+        {
+            settings.compression = TextureCompression::None;
+        }
 
-                gpuPrimitive->normal = CreateRHIBuffer(
-                    dummy.data(), dummy.size() * sizeof(glm::vec3), vk::BufferUsageFlagBits::eVertexBuffer, vma::MemoryUsage::eGpuOnly);
+        importQueue.Add((sourceDirectory / cookedTexture.uri).string(), settings);
+    }
+
+    Vector<VulkanStagingAllocation> stagings(cookedTextures.size());
+
+    const bool bImported = importQueue.Run(
+        [&](sizet index, const TextureDescription& description)
+        {
+            stagings[index] = uploadManager.AllocateStaging(description.size);
+
+            return stagings[index].data;
+        },
+        [&](sizet index, const TextureDescription& description, bool bSucceeded)
+        {
+            const CookedMeshTexture& cookedTexture = cookedTextures[index];
+
+            if (!stagings[index].buffer)
+            {
+                ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Failed to open texture %s", cookedTexture.uri.c_str());
+                return;
             }
 
-            if (cpuPrimitive.tangent.size() > 0)
+            if (bSucceeded)
             {
-                gpuPrimitive->tangent = CreateRHIBuffer(cpuPrimitive.tangent.data(),
-                                                        cpuPrimitive.tangent.size() * sizeof(glm::vec4),
-                                                        vk::BufferUsageFlagBits::eVertexBuffer,
-                                                        vma::MemoryUsage::eGpuOnly);
+                RHITexture* texture = CreateTexture(cookedTexture.uri, description, stagings[index]);
+                texture->sampler    = CreateSampler(cookedTexture.sampler, texture->numMips);
             }
             else
             {
-                ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Unable to find Tangent buffer for primitive. Creating default.");
-                Vector<glm::vec4> dummy;
-                dummy.resize(cpuPrimitive.position.size());
-
-                memset(dummy.data(), 0, dummy.size() * sizeof(glm::vec4));
+                ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Failed to decode texture %s", cookedTexture.uri.c_str());
 
-                gpuPrimitive->tangent = CreateRHIBuffer(
-                    dummy.data(), dummy.size() * sizeof(glm::vec4), vk::BufferUsageFlagBits::eVertexBuffer, vma::MemoryUsage::eGpuOnly);
+                uploadManager.Discard(stagings[index]);
             }
+        });
 
-            if (cpuPrimitive.uv.size() > 0)
-            {
-                gpuPrimitive->uv = CreateRHIBuffer(cpuPrimitive.uv.data(),
-                                                   cpuPrimitive.uv.size() * sizeof(glm::vec2),
-                                                   vk::BufferUsageFlagBits::eVertexBuffer,
-                                                   vma::MemoryUsage::eGpuOnly);
-            }
+    // Only a bad cooked mesh is worth a full reimport, the materials whose textures failed are given the default ones by CreateScene.
+    if (!bImported)
+    {
+        ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Some textures of %s failed to load, using the default textures", sourcePath.c_str());
+    }
 
-            // if (cpuPrimitive.color.size() > 0)
-            //{
-            //     gpuPrimitive->color = CreateRHIBuffer(cpuPrimitive.color.data(),
-            //                                           cpuPrimitive.color.size() * sizeof(glm::vec4),
-            //                                           vk::BufferUsageFlagBits::eVertexBuffer,
-            //                                           vma::MemoryUsage::eGpuOnly);
-            // }
+    for (const RHIPrimitiveView& primitive : cookedMesh.GetPrimitives())
+    {
+        gpuPrimitives.emplace_back(CreatePrimitive(primitive));
+    }
 
-            if (cpuPrimitive.indices.size() > 0)
-            {
-                gpuPrimitive->indices = CreateRHIBuffer(cpuPrimitive.indices.data(),
-                                                        cpuPrimitive.indices.size() * sizeof(u32),
-                                                        vk::BufferUsageFlagBits::eIndexBuffer,
-                                                        vma::MemoryUsage::eGpuOnly);
-            }
+    return true;
+}
 
-            gpuPrimitive->materialAttributes = cpuPrimitive.materialAttributes;
+RHIPrimitiveGPU* Zn::VulkanDevice::CreatePrimitive(const RHIPrimitiveView& cpuPrimitive)
+{
+    ZN_TRACE_QUICKSCOPE();
+    RHIPrimitiveGPU* gpuPrimitive = new RHIPrimitiveGPU();
 
-            gpuPrimitive->uboMaterialAttributes =
-                CreateBuffer(sizeof(UBOMaterialAttributes),
-                             vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eTransferDst,
-                             vma::MemoryUsage::eGpuOnly);
+    gpuPrimitive->matrix      = cpuPrimitive.matrix;
+    gpuPrimitive->numVertices = cpuPrimitive.position.size();
+    gpuPrimitive->numIndices  = cpuPrimitive.indices.size();
 
-            RHIBuffer stagingBuffer =
-                CreateBuffer(sizeof(UBOMaterialAttributes), vk::BufferUsageFlagBits::eTransferSrc, vma::MemoryUsage::eCpuOnly);
+    // Levels of detail are placed after the full detail indices, every level is drawn from the same range.
+    for (const RHIPrimitiveLOD& lod : cpuPrimitive.lods)
+    {
+        gpuPrimitive->lods.push_back(RHIPrimitiveLOD {
+            .firstIndex = gpuPrimitive->numIndices + lod.firstIndex,
+            .numIndices = lod.numIndices,
+            .error      = lod.error,
+        });
+    }
 
-            UBOMaterialAttributes uboMaterialAttributes {
-                .baseColor   = gpuPrimitive->materialAttributes.baseColor,
-                .metalness   = gpuPrimitive->materialAttributes.metalness,
-                .roughness   = gpuPrimitive->materialAttributes.roughness,
-                .alphaCutoff = gpuPrimitive->materialAttributes.alphaCutoff,
-                .emissive    = gpuPrimitive->materialAttributes.emissive,
-                .occlusion   = gpuPrimitive->materialAttributes.occlusion,
-            };
+    const u32 numLODIndices = cpuPrimitive.lods.empty() ? 0 : static_cast<u32>(cpuPrimitive.lodIndices.size());
 
-            CopyToGPU(stagingBuffer.allocation, &uboMaterialAttributes, sizeof(UBOMaterialAttributes));
+    AllocateGeometry(*gpuPrimitive, gpuPrimitive->numIndices + numLODIndices);
 
-            ImmediateSubmit(
-                [=](vk::CommandBuffer cmd)
-                {
-                    cmd.copyBuffer(stagingBuffer.data,
-                                   gpuPrimitive->uboMaterialAttributes.data,
-                                   {vk::BufferCopy(0, 0, sizeof(UBOMaterialAttributes))});
-                });
+    if (quantizedVertices)
+    {
+        RHIQuantizedPrimitive quantized;
+        RHIVertexQuantization::Quantize(cpuPrimitive, quantized);
+
+        UploadVertexStream(*gpuPrimitive, 0, quantized.position.data(), quantized.position.size() * sizeof(glm::u16vec4));
+        UploadVertexStream(*gpuPrimitive, 1, quantized.normal.data(), quantized.normal.size() * sizeof(u32));
+        UploadVertexStream(*gpuPrimitive, 2, quantized.tangent.data(), quantized.tangent.size() * sizeof(u32));
+        UploadVertexStream(*gpuPrimitive, 3, quantized.uv.data(), quantized.uv.size() * sizeof(u32));
+
+        gpuPrimitive->dequantization = quantized.dequantization;
+    }
+    else
+    {
+        UploadVertexStream(*gpuPrimitive, 0, cpuPrimitive.position.data(), cpuPrimitive.position.size_bytes());
+
+        if (cpuPrimitive.normal.size() > 0)
+        {
+            UploadVertexStream(*gpuPrimitive, 1, cpuPrimitive.normal.data(), cpuPrimitive.normal.size_bytes());
+        }
+        else
+        {
+            ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Unable to find Normal buffer for primitive. Creating default.");
+            Vector<glm::vec3> dummy;
+            dummy.resize(cpuPrimitive.position.size());
+
+            memset(dummy.data(), 0, dummy.size() * sizeof(glm::vec3));
+
+            UploadVertexStream(*gpuPrimitive, 1, dummy.data(), dummy.size() * sizeof(glm::vec3));
+        }
 
-            DestroyBuffer(stagingBuffer);
+        if (cpuPrimitive.tangent.size() > 0)
+        {
+            UploadVertexStream(*gpuPrimitive, 2, cpuPrimitive.tangent.data(), cpuPrimitive.tangent.size_bytes());
+        }
+        else
+        {
+            ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Unable to find Tangent buffer for primitive. Creating default.");
+            Vector<glm::vec4> dummy;
+            dummy.resize(cpuPrimitive.position.size());
 
-            gpuPrimitives.emplace_back(gpuPrimitive);
+            memset(dummy.data(), 0, dummy.size() * sizeof(glm::vec4));
+
+            UploadVertexStream(*gpuPrimitive, 2, dummy.data(), dummy.size() * sizeof(glm::vec4));
+        }
+
+        // The block holds whatever the previous owner of the range left, missing uvs are zeroed like the other streams.
+        if (cpuPrimitive.uv.size() > 0)
+        {
+            UploadVertexStream(*gpuPrimitive, 3, cpuPrimitive.uv.data(), cpuPrimitive.uv.size_bytes());
+        }
+        else
+        {
+            Vector<glm::vec2> dummy(cpuPrimitive.position.size(), glm::vec2(0.f));
+
+            UploadVertexStream(*gpuPrimitive, 3, dummy.data(), dummy.size() * sizeof(glm::vec2));
         }
     }
+
+    if (gpuPrimitive->numIndices > 0)
+    {
+        const GeometryBlock& block = geometryBlocks[gpuPrimitive->geometryBlock];
+
+        uploadManager.UploadBuffer(
+            block.indices.data, cpuPrimitive.indices.data(), cpuPrimitive.indices.size_bytes(), gpuPrimitive->firstIndex * sizeof(u32));
+
+        if (numLODIndices > 0)
+        {
+            uploadManager.UploadBuffer(block.indices.data,
+                                       cpuPrimitive.lodIndices.data(),
+                                       cpuPrimitive.lodIndices.size_bytes(),
+                                       (gpuPrimitive->firstIndex + gpuPrimitive->numIndices) * sizeof(u32));
+        }
+    }
+
+    if (!cpuPrimitive.position.empty())
+    {
+        glm::vec3 boundsMin = cpuPrimitive.position[0];
+        glm::vec3 boundsMax = cpuPrimitive.position[0];
+
+        for (const glm::vec3& position : cpuPrimitive.position)
+        {
+            boundsMin = glm::min(boundsMin, position);
+            boundsMax = glm::max(boundsMax, position);
+        }
+
+        gpuPrimitive->boundsCenter = (boundsMin + boundsMax) * 0.5f;
+
+        for (const glm::vec3& position : cpuPrimitive.position)
+        {
+            gpuPrimitive->boundsRadius = std::max(gpuPrimitive->boundsRadius, glm::length(position - gpuPrimitive->boundsCenter));
+        }
+    }
+
+    gpuPrimitive->materialAttributes = cpuPrimitive.materialAttributes;
+
+    gpuPrimitive->uboMaterialAttributes = CreateBuffer(sizeof(UBOMaterialAttributes),
+                                                       vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eTransferDst,
+                                                       vma::MemoryUsage::eGpuOnly);
+
+    UBOMaterialAttributes uboMaterialAttributes {
+        .baseColor   = gpuPrimitive->materialAttributes.baseColor,
+        .metalness   = gpuPrimitive->materialAttributes.metalness,
+        .roughness   = gpuPrimitive->materialAttributes.roughness,
+        .alphaCutoff = gpuPrimitive->materialAttributes.alphaCutoff,
+        .emissive    = gpuPrimitive->materialAttributes.emissive,
+        .occlusion   = gpuPrimitive->materialAttributes.occlusion,
+    };
+
+    uploadManager.UploadBuffer(gpuPrimitive->uboMaterialAttributes.data, &uboMaterialAttributes, sizeof(UBOMaterialAttributes));
+
+    return gpuPrimitive;
 }
 
-RHIBuffer Zn::VulkanDevice::CreateRHIBuffer(const void*          data,
-                                            sizet                size,
-                                            vk::BufferUsageFlags bufferUsage,
-                                            vma::MemoryUsage     memoryUsage) const
+void Zn::VulkanDevice::AllocateGeometry(RHIPrimitiveGPU& primitive, u32 numIndices)
 {
-    RHIBuffer stagingBuffer = CreateBuffer(size, vk::BufferUsageFlagBits::eTransferSrc, vma::MemoryUsage::eCpuOnly);
+    const u32 numVertices = primitive.numVertices;
 
-    CopyToGPU(stagingBuffer.allocation, data, size);
+    const auto tryAllocate = [&](u32 blockIndex)
+    {
+        GeometryBlock& block = geometryBlocks[blockIndex];
 
-    RHIBuffer outputBuffer = CreateBuffer(size, bufferUsage | vk::BufferUsageFlagBits::eTransferDst, memoryUsage);
+        // Empty ranges take no room, offset 0 is as good as any.
+        const std::optional<u32> vertexOffset = numVertices > 0 ? block.vertexAllocator.Allocate(numVertices) : 0u;
 
-    ImmediateSubmit(
-        [=](vk::CommandBuffer cmd)
+        if (!vertexOffset)
         {
-            cmd.copyBuffer(stagingBuffer.data, outputBuffer.data, {vk::BufferCopy(0, 0, size)});
-        });
+            return false;
+        }
+
+        const std::optional<u32> firstIndex = numIndices > 0 ? block.indexAllocator.Allocate(numIndices) : 0u;
 
-    DestroyBuffer(stagingBuffer);
+        if (!firstIndex)
+        {
+            if (numVertices > 0)
+            {
+                block.vertexAllocator.Free(*vertexOffset, numVertices);
+            }
 
-    return outputBuffer;
+            return false;
+        }
+
+        primitive.geometryBlock = blockIndex;
+        primitive.vertexOffset  = *vertexOffset;
+        primitive.firstIndex    = *firstIndex;
+
+        return true;
+    };
+
+    for (u32 blockIndex = 0; blockIndex < geometryBlocks.size(); ++blockIndex)
+    {
+        if (tryAllocate(blockIndex))
+        {
+            return;
+        }
+    }
+
+    // Primitives larger than a block get one of their own size.
+    CreateGeometryBlock(std::max(numVertices, kGeometryBlockVertices), std::max(numIndices, kGeometryBlockIndices));
+
+    const bool bAllocated = tryAllocate(static_cast<u32>(geometryBlocks.size() - 1));
+
+    check(bAllocated);
 }
 
-void Zn::VulkanDevice::CreateMeshPipeline()
+void Zn::VulkanDevice::CreateGeometryBlock(u32 numVertices, u32 numIndices)
+{
+    const RHIInputLayout& inputLayout = quantizedVertices ? VulkanPipeline::gltfQuantizedInputLayout : VulkanPipeline::gltfInputLayout;
+
+    GeometryBlock& block = geometryBlocks.emplace_back();
+
+    for (const vk::VertexInputBindingDescription& binding : inputLayout.bindings)
+    {
+        // Instance data is per frame, not per primitive.
+        if (binding.inputRate != vk::VertexInputRate::eVertex)
+        {
+            continue;
+        }
+
+        block.vertexStreams.push_back(CreateBuffer(static_cast<sizet>(numVertices) * binding.stride,
+                                                   vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eTransferDst,
+                                                   vma::MemoryUsage::eGpuOnly));
+    }
+
+    block.indices = CreateBuffer(static_cast<sizet>(numIndices) * sizeof(u32),
+                                 vk::BufferUsageFlagBits::eIndexBuffer | vk::BufferUsageFlagBits::eTransferDst,
+                                 vma::MemoryUsage::eGpuOnly);
+
+    block.vertexAllocator.Initialize(numVertices);
+    block.indexAllocator.Initialize(numIndices);
+
+    ZN_LOG(LogVulkan,
+           ELogVerbosity::Log,
+           "Created geometry block %zu, %u vertices and %u indices",
+           geometryBlocks.size() - 1,
+           numVertices,
+           numIndices);
+}
+
+void Zn::VulkanDevice::BindGeometryBlock(vk::CommandBuffer commandBuffer, u32 block) const
 {
-    Vector<uint8> vertex_shader_data;
-    Vector<uint8> fragment_shader_data;
+    const GeometryBlock& geometryBlock = geometryBlocks[block];
 
+    StaticVector<vk::Buffer, kMaxVertexStreams>     vertexBuffers;
+    StaticVector<vk::DeviceSize, kMaxVertexStreams> vertexOffsets;
+
+    for (const RHIBuffer& vertexStream : geometryBlock.vertexStreams)
+    {
+        vertexBuffers.push_back(vertexStream.data);
+        vertexOffsets.push_back(0);
+    }
+
+    commandBuffer.bindVertexBuffers(0, static_cast<u32>(vertexBuffers.size()), vertexBuffers.data(), vertexOffsets.data());
+
+    // TODO: Save index type into primitive?
+    commandBuffer.bindIndexBuffer(geometryBlock.indices.data, 0, vk::IndexType::eUint32);
+}
+
+void Zn::VulkanDevice::UploadVertexStream(const RHIPrimitiveGPU& primitive, u32 stream, const void* data, sizet size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    const RHIInputLayout& inputLayout = quantizedVertices ? VulkanPipeline::gltfQuantizedInputLayout : VulkanPipeline::gltfInputLayout;
+
+    const vk::DeviceSize offset = static_cast<vk::DeviceSize>(primitive.vertexOffset) * inputLayout.bindings[stream].stride;
+
+    uploadManager.UploadBuffer(geometryBlocks[primitive.geometryBlock].vertexStreams[stream].data, data, size, offset);
+}
+
+void Zn::VulkanDevice::RequestMeshPipelineShaders()
+{
     String vertexShaderName;
     String fragmentShaderName;
 
-    CommandLine::Get().Value("-vertex", vertexShaderName, "vertex");
+    quantizedVertices = CommandLine::Get().Param("-quantizedVertices");
+
+    CommandLine::Get().Value("-vertex", vertexShaderName, quantizedVertices ? "vertex_quantized" : "vertex");
     CommandLine::Get().Value("-fragment", fragmentShaderName, "fragment");
 
     vertexShaderName   = "shaders/" + vertexShaderName + ".vert.spv";
     fragmentShaderName = "shaders/" + fragmentShaderName + ".frag.spv";
 
-    const bool vertex_success   = IO::ReadBinaryFile(vertexShaderName, vertex_shader_data);
-    const bool fragment_success = IO::ReadBinaryFile(fragmentShaderName, fragment_shader_data);
+    pendingShaderReads = IO::ReadBinaryFilesAsync({vertexShaderName, fragmentShaderName}, ETaskPriority::High);
+}
+
+void Zn::VulkanDevice::CreateMeshPipeline()
+{
+    if (pendingShaderReads.empty())
+    {
+        RequestMeshPipelineShaders();
+    }
+
+    // The views are only needed until the modules are created.
+    IOReadResult vertexShader   = pendingShaderReads[0].get();
+    IOReadResult fragmentShader = pendingShaderReads[1].get();
 
-    if (vertex_success && fragment_success)
+    pendingShaderReads.clear();
+
+    const RHIInputLayout& inputLayout = quantizedVertices ? VulkanPipeline::gltfQuantizedInputLayout : VulkanPipeline::gltfInputLayout;
+
+    if (vertexShader.success && fragmentShader.success)
     {
         Material* materialNoCull = VulkanMaterialManager::Get().CreateMaterial("base_pbr_no_cull");
 
-        materialNoCull->vertexShader   = CreateShaderModule(vertex_shader_data);
-        materialNoCull->fragmentShader = CreateShaderModule(fragment_shader_data);
+        materialNoCull->vertexShader   = CreateShaderModule(vertexShader.file.GetView());
+        materialNoCull->fragmentShader = CreateShaderModule(fragmentShader.file.GetView());
 
         if (!materialNoCull->vertexShader)
         {
@@ -2093,15 +2671,6 @@ void Zn::VulkanDevice::CreateMeshPipeline()
 
         vk::PipelineLayoutCreateInfo layoutCreateInfo {.setLayoutCount = ArrayLength(layouts), .pSetLayouts = ArrayData(layouts)};
 
-        vk::PushConstantRange pushConstants {
-            // this push constant range is accessible only in the vertex shader
-            .stageFlags = vk::ShaderStageFlagBits::eVertex,
-            .offset     = 0,
-            .size       = sizeof(MeshPushConstants),
-        };
-
-        layoutCreateInfo.setPushConstantRanges(pushConstants);
-
         materialNoCull->layout = device.createPipelineLayout(layoutCreateInfo);
 
         destroyQueue.Enqueue(
@@ -2117,7 +2686,7 @@ void Zn::VulkanDevice::CreateMeshPipeline()
                                                                  swapChainExtent,
                                                                  materialNoCull->layout,
                                                                  vk::CullModeFlagBits::eNone,
-                                                                 VulkanPipeline::gltfInputLayout);
+                                                                 inputLayout);
 
         destroyQueue.Enqueue(
             [=]()
@@ -2140,7 +2709,7 @@ void Zn::VulkanDevice::CreateMeshPipeline()
                                                                swapChainExtent,
                                                                materialCull->layout,
                                                                vk::CullModeFlagBits::eBack,
-                                                               VulkanPipeline::gltfInputLayout);
+                                                               inputLayout);
 
         destroyQueue.Enqueue(
             [=]()
@@ -2159,100 +2728,102 @@ RHITexture* Zn::VulkanDevice::CreateTexture(const String& path)
         return it->second;
     }
 
-    RHIBuffer stagingBuffer {};
-
-    i32 width  = 0;
-    i32 height = 0;
+    TextureImportJob importJob;
 
-    if (SharedPtr<TextureSource> sourceTexture = TextureImporter::Import(IO::GetAbsolutePath(path)))
+    if (!importJob.Open(IO::GetAbsolutePath(path)))
     {
-        width  = sourceTexture->width;
-        height = sourceTexture->height;
-
-        stagingBuffer = CreateBuffer(sourceTexture->data.size(), vk::BufferUsageFlagBits::eTransferSrc, vma::MemoryUsage::eCpuOnly);
-        CopyToGPU(stagingBuffer.allocation, sourceTexture->data.data(), sourceTexture->data.size());
+        ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Failed to load texture %s", path.c_str());
+        return nullptr;
     }
-    else
+
+    const TextureDescription& description = importJob.GetDescription();
+
+    // Decoded straight into the staging memory.
+    const VulkanStagingAllocation staging = uploadManager.AllocateStaging(description.size);
+
+    if (!importJob.ImportTo(staging.data))
     {
+        uploadManager.Discard(staging);
+
         ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Failed to load texture %s", path.c_str());
         return nullptr;
     }
 
-    RHITexture* texture = nullptr;
+    return CreateTexture(path, description, staging);
+}
 
-    if (auto result = textures.insert({textureHandle, CreateRHITexture(width, height, vk::Format::eR8G8B8A8Unorm)}); result.second)
+RHITexture* Zn::VulkanDevice::CreateTexture(const String& name, SharedPtr<TextureSource> texture)
+{
+    ResourceHandle textureHandle = HashCalculate(name);
+
+    if (auto it = textures.find(textureHandle); it != std::end(textures))
     {
-        texture = result.first->second;
+        return it->second;
     }
 
-    ImmediateSubmit(
-        [=](vk::CommandBuffer cmd)
-        {
-            TransitionImageLayout(
-                cmd, texture->image, vk::Format::eR8G8B8A8Unorm, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
-            CopyBufferToImage(cmd, stagingBuffer.data, texture->image, width, height);
-            TransitionImageLayout(cmd,
-                                  texture->image,
-                                  vk::Format::eR8G8B8A8Unorm,
-                                  vk::ImageLayout::eTransferDstOptimal,
-                                  vk::ImageLayout::eShaderReadOnlyOptimal);
-        });
+    TextureDescription description {
+        .width       = texture->width,
+        .height      = texture->height,
+        .channels    = texture->channels,
+        .numMips     = texture->numMips,
+        .compression = texture->compression,
+    };
 
-    DestroyBuffer(stagingBuffer);
+    std::span<const u8> data = texture->data.GetView();
+    Vector<u8>          decompressed;
 
-    vk::ImageViewCreateInfo imageViewInfo {.image            = texture->image,
-                                           .viewType         = vk::ImageViewType::e2D,
-                                           .format           = vk::Format::eR8G8B8A8Unorm,
-                                           .subresourceRange = {
-                                               .aspectMask     = vk::ImageAspectFlagBits::eColor,
-                                               .baseMipLevel   = 0,
-                                               .levelCount     = 1,
-                                               .baseArrayLayer = 0,
-                                               .layerCount     = 1,
-                                           }};
+    // Block compressed textures are uploaded as cooked, unless the device can't sample them.
+    if (description.compression != TextureCompression::None && !gpuFeatures.textureCompressionBC)
+    {
+        decompressed =
+            TextureCompressor::Decompress(data, description.width, description.height, description.numMips, description.compression);
+        data                    = decompressed;
+        description.compression = TextureCompression::None;
+    }
 
-    texture->imageView = device.createImageView(imageViewInfo);
+    description.size = data.size();
 
-    VulkanValidation::SetObjectDebugName(device, path.c_str(), texture->image);
+    const VulkanStagingAllocation staging = uploadManager.AllocateStaging(data.size());
 
-    return texture;
+    memcpy(staging.data.data(), data.data(), data.size());
+
+    return CreateTexture(name, description, staging);
 }
 
-RHITexture* Zn::VulkanDevice::CreateTexture(const String& name, SharedPtr<TextureSource> texture)
+RHITexture* Zn::VulkanDevice::CreateTexture(const String&                  name,
+                                            const TextureDescription&      description,
+                                            const VulkanStagingAllocation& staging)
 {
     ResourceHandle textureHandle = HashCalculate(name);
 
     if (auto it = textures.find(textureHandle); it != std::end(textures))
     {
+        uploadManager.Discard(staging);
         return it->second;
     }
 
-    i32 width  = texture->width;
-    i32 height = texture->height;
-
-    RHIBuffer stagingBuffer = CreateBuffer(texture->data.size(), vk::BufferUsageFlagBits::eTransferSrc, vma::MemoryUsage::eCpuOnly);
-    CopyToGPU(stagingBuffer.allocation, texture->data.data(), texture->data.size());
+    const i32                width       = description.width;
+    const i32                height      = description.height;
+    const u32                numMips     = description.numMips;
+    const TextureCompression compression = description.compression;
 
     RHITexture* rhiTexture = nullptr;
 
-    // TODO: This should be derived from the source maybe?
-    const vk::Format textureFormat = vk::Format::eR8G8B8A8Unorm;
+    const vk::Format textureFormat = TranslateTextureCompression(compression);
 
-    if (auto result = textures.insert({textureHandle, CreateRHITexture(width, height, textureFormat)}); result.second)
+    if (auto result = textures.insert({textureHandle, CreateRHITexture(width, height, textureFormat, numMips)}); result.second)
     {
         rhiTexture = result.first->second;
     }
 
-    ImmediateSubmit(
-        [=](vk::CommandBuffer cmd)
-        {
-            TransitionImageLayout(cmd, rhiTexture->image, textureFormat, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal);
-            CopyBufferToImage(cmd, stagingBuffer.data, rhiTexture->image, width, height);
-            TransitionImageLayout(
-                cmd, rhiTexture->image, textureFormat, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal);
-        });
+    // Every level is packed in the staging memory, one copy region each.
+    vk::CommandBuffer cmd = uploadManager.RecordUpload(staging);
 
-    DestroyBuffer(stagingBuffer);
+    TransitionImageLayout(
+        cmd, rhiTexture->image, textureFormat, vk::ImageLayout::eUndefined, vk::ImageLayout::eTransferDstOptimal, numMips);
+    CopyBufferToImage(cmd, staging.buffer, staging.offset, rhiTexture->image, width, height, numMips, compression);
+    TransitionImageLayout(
+        cmd, rhiTexture->image, textureFormat, vk::ImageLayout::eTransferDstOptimal, vk::ImageLayout::eShaderReadOnlyOptimal, numMips);
 
     vk::ImageViewCreateInfo imageViewInfo {.image            = rhiTexture->image,
                                            .viewType         = vk::ImageViewType::e2D,
@@ -2260,7 +2831,7 @@ RHITexture* Zn::VulkanDevice::CreateTexture(const String& name, SharedPtr<Textur
                                            .subresourceRange = {
                                                .aspectMask     = vk::ImageAspectFlagBits::eColor,
                                                .baseMipLevel   = 0,
-                                               .levelCount     = 1,
+                                               .levelCount     = numMips,
                                                .baseArrayLayer = 0,
                                                .layerCount     = 1,
                                            }};
@@ -2273,16 +2844,18 @@ RHITexture* Zn::VulkanDevice::CreateTexture(const String& name, SharedPtr<Textur
     return rhiTexture;
 }
 
-RHITexture* Zn::VulkanDevice::CreateRHITexture(i32 width, i32 height, vk::Format format) const
+RHITexture* Zn::VulkanDevice::CreateRHITexture(i32 width, i32 height, vk::Format format, u32 numMips) const
 {
     vk::ImageCreateInfo createInfo = MakeImageCreateInfo(format,
                                                          vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled,
                                                          vk::Extent3D {static_cast<u32>(width), static_cast<u32>(height), 1},
-                                                         CalculateNumMips(width, height));
+                                                         numMips);
 
     createInfo.initialLayout = vk::ImageLayout::eUndefined;
     createInfo.sharingMode   = vk::SharingMode::eExclusive;
 
+    ShareWithUploadQueue(createInfo, uploadQueueFamilies);
+
     //	Allocate from GPU memory.
 
     vma::AllocationCreateInfo allocationInfo {
@@ -2293,7 +2866,7 @@ RHITexture* Zn::VulkanDevice::CreateRHITexture(i32 width, i32 height, vk::Format
         //	This forces VMA library to allocate the image on VRAM no matter what. (The Memory Usage part is more like a hint)
         .requiredFlags = vk::MemoryPropertyFlags(vk::MemoryPropertyFlagBits::eDeviceLocal)};
 
-    RHITexture* texture = new RHITexture {.width = width, .height = height};
+    RHITexture* texture = new RHITexture {.width = width, .height = height, .numMips = numMips};
 
     ZN_VK_CHECK(allocator.createImage(&createInfo, &allocationInfo, &texture->image, &texture->allocation, nullptr));
 
@@ -2321,7 +2894,7 @@ vk::Sampler Zn::VulkanDevice::CreateSampler(const TextureSampler& sampler, u32 n
 }
 
 void Zn::VulkanDevice::TransitionImageLayout(
-    vk::CommandBuffer cmd, vk::Image img, vk::Format fmt, vk::ImageLayout prevLayout, vk::ImageLayout newLayout) const
+    vk::CommandBuffer cmd, vk::Image img, vk::Format fmt, vk::ImageLayout prevLayout, vk::ImageLayout newLayout, u32 numMips) const
 {
     vk::ImageMemoryBarrier barrier {
         .oldLayout           = prevLayout,
@@ -2334,7 +2907,7 @@ void Zn::VulkanDevice::TransitionImageLayout(
         .subresourceRange    = {
                .aspectMask     = vk::ImageAspectFlagBits::eColor,
                .baseMipLevel   = 0,
-               .levelCount     = 1,
+               .levelCount     = numMips,
                .baseArrayLayer = 0,
                .layerCount     = 1,
         }};
@@ -2352,11 +2925,13 @@ void Zn::VulkanDevice::TransitionImageLayout(
     }
     else if (prevLayout == vk::ImageLayout::eTransferDstOptimal && newLayout == vk::ImageLayout::eShaderReadOnlyOptimal)
     {
+        // Recorded on the upload queue, which may have no shader stage. The frames wait on the upload timeline semaphore before
+        // sampling the image, which makes the writes visible to them.
         barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
-        barrier.dstAccessMask = vk::AccessFlagBits::eShaderRead;
+        barrier.dstAccessMask = vk::AccessFlags(0);
 
         srcStage = vk::PipelineStageFlagBits::eTransfer;
-        dstStage = vk::PipelineStageFlagBits::eFragmentShader;
+        dstStage = vk::PipelineStageFlagBits::eBottomOfPipe;
     }
     else
     {
@@ -2366,39 +2941,6 @@ void Zn::VulkanDevice::TransitionImageLayout(
     cmd.pipelineBarrier(srcStage, dstStage, vk::DependencyFlags(0), {}, {}, {barrier});
 }
 
-void Zn::VulkanDevice::ImmediateSubmit(std::function<void(vk::CommandBuffer)>&& function) const
-{
-    if (function == nullptr)
-    {
-        ZN_LOG(LogVulkan, ELogVerbosity::Warning, "Trying to ImmediateSubmit with invalid function");
-        return;
-    }
-
-    vk::CommandBuffer cmd = uploadContext.cmdBuffer;
-
-    cmd.begin({.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
-
-    {
-        ZN_TRACE_GPU_SCOPE("Submit", uploadContext.traceContext, cmd);
-        function(cmd);
-    }
-
-    cmd.end();
-
-    vk::SubmitInfo submitInfo {.commandBufferCount = 1, .pCommandBuffers = &cmd};
-
-    // .fence will now block until the graphic commands finish execution
-    graphicsQueue.submit(submitInfo, uploadContext.fence);
-
-    ZN_VK_CHECK(device.waitForFences({uploadContext.fence}, true, kWaitTimeOneSecond));
-    device.resetFences({uploadContext.fence});
-
-    ZN_TRACE_GPU_COLLECT(uploadContext.traceContext, uploadContext.cmdBuffer);
-
-    // reset the command buffers inside the command pool
-    device.resetCommandPool(uploadContext.commandPool, vk::CommandPoolResetFlags(0));
-}
-
 vk::ImageCreateInfo Zn::VulkanDevice::MakeImageCreateInfo(vk::Format          format,
                                                           vk::ImageUsageFlags usageFlags,
                                                           vk::Extent3D        extent,
@@ -2450,22 +2992,41 @@ vk::ImageViewCreateInfo Zn::VulkanDevice::MakeImageViewCreateInfo(vk::Format
             }};
 }
 
-void Zn::VulkanDevice::CopyBufferToImage(vk::CommandBuffer cmd, vk::Buffer buffer, vk::Image img, u32 width, u32 height) const
+void Zn::VulkanDevice::CopyBufferToImage(vk::CommandBuffer  cmd,
+                                         vk::Buffer         buffer,
+                                         vk::DeviceSize     bufferOffset,
+                                         vk::Image          img,
+                                         u32                width,
+                                         u32                height,
+                                         u32                numMips,
+                                         TextureCompression compression) const
 {
-    vk::BufferImageCopy region {.bufferOffset      = 0,
-                                .bufferRowLength   = 0,
-                                .bufferImageHeight = 0,
-                                .imageSubresource =
-                                    {
-                                        .aspectMask     = vk::ImageAspectFlagBits::eColor,
-                                        .mipLevel       = 0,
-                                        .baseArrayLayer = 0,
-                                        .layerCount     = 1,
-                                    },
-                                .imageOffset = vk::Offset3D {0, 0, 0},
-                                .imageExtent = vk::Extent3D {width, height, 1}};
+    Vector<vk::BufferImageCopy> regions;
+    regions.reserve(numMips);
+
+    // Levels are tightly packed from the largest, compressed ones padded to whole blocks.
+    for (u32 mip = 0; mip < numMips; ++mip)
+    {
+        const u32 mipWidth  = TextureMipGenerator::GetMipWidth(width, mip);
+        const u32 mipHeight = TextureMipGenerator::GetMipHeight(height, mip);
+
+        regions.push_back(vk::BufferImageCopy {.bufferOffset      = bufferOffset,
+                                               .bufferRowLength   = 0,
+                                               .bufferImageHeight = 0,
+                                               .imageSubresource =
+                                                   {
+                                                       .aspectMask     = vk::ImageAspectFlagBits::eColor,
+                                                       .mipLevel       = mip,
+                                                       .baseArrayLayer = 0,
+                                                       .layerCount     = 1,
+                                                   },
+                                               .imageOffset = vk::Offset3D {0, 0, 0},
+                                               .imageExtent = vk::Extent3D {mipWidth, mipHeight, 1}});
+
+        bufferOffset += TextureCompressor::CalculateLevelSize(compression, mipWidth, mipHeight);
+    }
 
-    cmd.copyBufferToImage(buffer, img, vk::ImageLayout::eTransferDstOptimal, {region});
+    cmd.copyBufferToImage(buffer, img, vk::ImageLayout::eTransferDstOptimal, regions);
 }
 
 VulkanDevice::DestroyQueue::~DestroyQueue()
@@ -40,11 +40,11 @@ const RHIInputLayout VulkanPipeline::gltfInputLayout = {.bindings   = {{
                                                                            .stride    = sizeof(glm::vec2),
                                                                            .inputRate = vk::VertexInputRate::eVertex,
                                                                      },
-                                                                      /* {
-                                                                           .binding   = 4,
-                                                                           .stride    = sizeof(glm::vec4),
-                                                                           .inputRate = vk::VertexInputRate::eVertex,
-                                                                     }*/},
+                                                                       {
+                                                                           .binding   = kInstanceBinding,
+                                                                           .stride    = sizeof(RHIInstanceData),
+                                                                           .inputRate = vk::VertexInputRate::eInstance,
+                                                                     }},
                                                         .attributes = {{
                                                                            .location = 0,
                                                                            .binding  = 0,
@@ -69,12 +69,49 @@ const RHIInputLayout VulkanPipeline::gltfInputLayout = {.bindings   = {{
                                                                            .format   = vk::Format::eR32G32Sfloat,
                                                                            .offset   = 0,
                                                                        },
-/*                                                                       {
+                                                                       // Model matrix, one column per location.
+                                                                       {
                                                                            .location = 4,
-                                                                           .binding  = 4,
+                                                                           .binding  = kInstanceBinding,
                                                                            .format   = vk::Format::eR32G32B32A32Sfloat,
-                                                                           .offset   = 0,
-                                                                       }*/}};
+                                                                           .offset   = sizeof(glm::vec4) * 0,
+                                                                       },
+                                                                       {
+                                                                           .location = 5,
+                                                                           .binding  = kInstanceBinding,
+                                                                           .format   = vk::Format::eR32G32B32A32Sfloat,
+                                                                           .offset   = sizeof(glm::vec4) * 1,
+                                                                       },
+                                                                       {
+                                                                           .location = 6,
+                                                                           .binding  = kInstanceBinding,
+                                                                           .format   = vk::Format::eR32G32B32A32Sfloat,
+                                                                           .offset   = sizeof(glm::vec4) * 2,
+                                                                       },
+                                                                       {
+                                                                           .location = 7,
+                                                                           .binding  = kInstanceBinding,
+                                                                           .format   = vk::Format::eR32G32B32A32Sfloat,
+                                                                           .offset   = sizeof(glm::vec4) * 3,
+                                                                       }}};
+
+// Streams of RHIQuantizedPrimitive, in the same bindings and locations as gltfInputLayout.
+const RHIInputLayout VulkanPipeline::gltfQuantizedInputLayout = {
+    .bindings   = {{.binding = 0, .stride = sizeof(glm::u16vec4), .inputRate = vk::VertexInputRate::eVertex},
+                   {.binding = 1, .stride = sizeof(u32), .inputRate = vk::VertexInputRate::eVertex},
+                   {.binding = 2, .stride = sizeof(u32), .inputRate = vk::VertexInputRate::eVertex},
+                   {.binding = 3, .stride = sizeof(u32), .inputRate = vk::VertexInputRate::eVertex},
+                   {.binding = kInstanceBinding, .stride = sizeof(RHIInstanceData), .inputRate = vk::VertexInputRate::eInstance}},
+    .attributes = {
+        {.location = 0, .binding = 0, .format = vk::Format::eR16G16B16A16Unorm, .offset = 0},
+        {.location = 1, .binding = 1, .format = vk::Format::eR16G16Snorm, .offset = 0},
+        {.location = 2, .binding = 2, .format = vk::Format::eR16G16Snorm, .offset = 0},
+        {.location = 3, .binding = 3, .format = vk::Format::eR16G16Sfloat, .offset = 0},
+        {.location = 4, .binding = kInstanceBinding, .format = vk::Format::eR32G32B32A32Sfloat, .offset = sizeof(glm::vec4) * 0},
+        {.location = 5, .binding = kInstanceBinding, .format = vk::Format::eR32G32B32A32Sfloat, .offset = sizeof(glm::vec4) * 1},
+        {.location = 6, .binding = kInstanceBinding, .format = vk::Format::eR32G32B32A32Sfloat, .offset = sizeof(glm::vec4) * 2},
+        {.location = 7, .binding = kInstanceBinding, .format = vk::Format::eR32G32B32A32Sfloat, .offset = sizeof(glm::vec4) * 3},
+    }};
 
 const RHIInputLayout VulkanPipeline::defaultIndirectInputLayout = {
     .bindings =
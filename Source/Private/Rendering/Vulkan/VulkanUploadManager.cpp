@@ -0,0 +1,253 @@
+#include <Znpch.h>
+#include <Rendering/Vulkan/VulkanUploadManager.h>
+#include <tuple>
+
+DEFINE_STATIC_LOG_CATEGORY(LogVulkanUploadManager, ELogVerbosity::Log);
+
+using namespace Zn;
+
+namespace
+{
+const vma::AllocationCreateInfo kStagingAllocationCreateInfo {
+    .usage         = vma::MemoryUsage::eCpuOnly,
+    .requiredFlags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent,
+};
+} // namespace
+
+void Zn::VulkanUploadManager::Initialize(
+    vk::Device device_, vma::Allocator allocator_, vk::Queue queue_, u32 queueFamily_, vk::DeviceSize ringSize_)
+{
+    device    = device_;
+    allocator = allocator_;
+    queue     = queue_;
+
+    commandPool = device.createCommandPool({
+        .flags            = vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer,
+        .queueFamilyIndex = queueFamily_,
+    });
+
+    vk::SemaphoreTypeCreateInfo timelineCreateInfo {.semaphoreType = vk::SemaphoreType::eTimeline, .initialValue = 0};
+
+    timelineSemaphore = device.createSemaphore({.pNext = &timelineCreateInfo});
+
+    std::tie(ringBuffer, ringAllocation) =
+        allocator.createBuffer({.size = ringSize_, .usage = vk::BufferUsageFlagBits::eTransferSrc}, kStagingAllocationCreateInfo);
+
+    // Mapped for as long as the manager lives.
+    ringData = static_cast<u8*>(allocator.mapMemory(ringAllocation));
+
+    ring.Initialize(ringSize_, kStagingAlignment);
+
+    submittedValue = 0;
+    completedValue = 0;
+    numSubmits     = 0;
+}
+
+void Zn::VulkanUploadManager::Shutdown()
+{
+    if (!device)
+    {
+        return;
+    }
+
+    Wait(Flush());
+
+    for (const DedicatedBuffer& dedicatedBuffer : dedicatedBuffers)
+    {
+        allocator.destroyBuffer(dedicatedBuffer.buffer, dedicatedBuffer.allocation);
+    }
+
+    dedicatedBuffers.clear();
+    pendingBatches.clear();
+    freeCmds.clear();
+
+    allocator.unmapMemory(ringAllocation);
+    allocator.destroyBuffer(ringBuffer, ringAllocation);
+
+    ringData = nullptr;
+
+    // Frees the command buffers too.
+    device.destroyCommandPool(commandPool);
+    device.destroySemaphore(timelineSemaphore);
+
+    device = VK_NULL_HANDLE;
+}
+
+VulkanStagingAllocation Zn::VulkanUploadManager::AllocateStaging(sizet size)
+{
+    ZN_TRACE_QUICKSCOPE();
+
+    Reclaim();
+
+    std::optional<RHIStagingRing::Allocation> allocation = ring.Allocate(size);
+
+    // Make room by waiting for the oldest uploads, as long as they are not still being staged.
+    while (!allocation)
+    {
+        const std::optional<u64> oldestValue = ring.GetOldestRetireValue();
+
+        if (!oldestValue || *oldestValue == RHIStagingRing::kNotRetired)
+        {
+            break;
+        }
+
+        Wait(*oldestValue > submittedValue ? Flush() : *oldestValue);
+
+        allocation = ring.Allocate(size);
+    }
+
+    if (allocation)
+    {
+        return VulkanStagingAllocation {
+            .buffer   = ringBuffer,
+            .offset   = allocation->offset,
+            .data     = std::span<u8>(ringData + allocation->offset, size),
+            .sequence = allocation->sequence,
+        };
+    }
+
+    ZN_LOG(LogVulkanUploadManager, ELogVerbosity::Verbose, "Staging ring full, allocating a dedicated buffer of %zu bytes", size);
+
+    VulkanStagingAllocation staging;
+
+    std::tie(staging.buffer, staging.dedicatedAllocation) =
+        allocator.createBuffer({.size = size, .usage = vk::BufferUsageFlagBits::eTransferSrc}, kStagingAllocationCreateInfo);
+
+    staging.data = std::span<u8>(static_cast<u8*>(allocator.mapMemory(staging.dedicatedAllocation)), size);
+
+    return staging;
+}
+
+vk::CommandBuffer Zn::VulkanUploadManager::RecordUpload(const VulkanStagingAllocation& staging)
+{
+    if (!recordingCmd)
+    {
+        if (freeCmds.empty())
+        {
+            recordingCmd = device.allocateCommandBuffers(
+                {.commandPool = commandPool, .level = vk::CommandBufferLevel::ePrimary, .commandBufferCount = 1})[0];
+        }
+        else
+        {
+            recordingCmd = freeCmds.back();
+            freeCmds.pop_back();
+        }
+
+        // Begin resets the command buffers of completed batches.
+        recordingCmd.begin({.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+    }
+
+    Retire(staging, submittedValue + 1);
+
+    return recordingCmd;
+}
+
+void Zn::VulkanUploadManager::Discard(const VulkanStagingAllocation& staging)
+{
+    Retire(staging, 0);
+}
+
+void Zn::VulkanUploadManager::UploadBuffer(vk::Buffer destination, const void* data, sizet size, vk::DeviceSize destinationOffset)
+{
+    const VulkanStagingAllocation staging = AllocateStaging(size);
+
+    memcpy(staging.data.data(), data, size);
+
+    RecordUpload(staging).copyBuffer(staging.buffer, destination, {vk::BufferCopy(staging.offset, destinationOffset, size)});
+}
+
+u64 Zn::VulkanUploadManager::Flush()
+{
+    if (!recordingCmd)
+    {
+        return submittedValue;
+    }
+
+    ZN_TRACE_QUICKSCOPE();
+
+    recordingCmd.end();
+
+    const u64 signalValue = submittedValue + 1;
+
+    vk::TimelineSemaphoreSubmitInfo timelineSubmitInfo {.signalSemaphoreValueCount = 1, .pSignalSemaphoreValues = &signalValue};
+
+    vk::SubmitInfo submitInfo {
+        .pNext                = &timelineSubmitInfo,
+        .commandBufferCount   = 1,
+        .pCommandBuffers      = &recordingCmd,
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores    = &timelineSemaphore,
+    };
+
+    queue.submit(submitInfo);
+
+    pendingBatches.push_back(Batch {.cmd = recordingCmd, .value = signalValue});
+
+    recordingCmd   = VK_NULL_HANDLE;
+    submittedValue = signalValue;
+
+    ++numSubmits;
+
+    return submittedValue;
+}
+
+void Zn::VulkanUploadManager::Wait(u64 value)
+{
+    // Waiting for a batch still being recorded would never return.
+    check(value <= submittedValue);
+
+    if (value > completedValue)
+    {
+        ZN_TRACE_QUICKSCOPE();
+
+        vk::SemaphoreWaitInfo waitInfo {.semaphoreCount = 1, .pSemaphores = &timelineSemaphore, .pValues = &value};
+
+        ZN_VK_CHECK(device.waitSemaphores(waitInfo, std::numeric_limits<u64>::max()));
+    }
+
+    Reclaim();
+}
+
+void Zn::VulkanUploadManager::Reclaim()
+{
+    completedValue = device.getSemaphoreCounterValue(timelineSemaphore);
+
+    ring.Reclaim(completedValue);
+
+    while (!pendingBatches.empty() && pendingBatches.front().value <= completedValue)
+    {
+        freeCmds.push_back(pendingBatches.front().cmd);
+        pendingBatches.pop_front();
+    }
+
+    std::erase_if(dedicatedBuffers,
+                  [this](const DedicatedBuffer& dedicatedBuffer)
+                  {
+                      if (dedicatedBuffer.retireValue > completedValue)
+                      {
+                          return false;
+                      }
+
+                      allocator.destroyBuffer(dedicatedBuffer.buffer, dedicatedBuffer.allocation);
+                      return true;
+                  });
+}
+
+void Zn::VulkanUploadManager::Retire(const VulkanStagingAllocation& staging, u64 value)
+{
+    if (!staging.dedicatedAllocation)
+    {
+        ring.Retire(staging.sequence, value);
+        return;
+    }
+
+    allocator.unmapMemory(staging.dedicatedAllocation);
+
+    if (value == 0)
+    {
+        allocator.destroyBuffer(staging.buffer, staging.dedicatedAllocation);
+        return;
+    }
+
+    dedicatedBuffers.push_back(DedicatedBuffer {.buffer = staging.buffer, .allocation = staging.dedicatedAllocation, .retireValue = value});
+}
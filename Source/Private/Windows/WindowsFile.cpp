@@ -0,0 +1,89 @@
+#include <Znpch.h>
+#include "Windows/WindowsFile.h"
+#include "Windows/WindowsCommon.h"
+
+namespace Zn
+{
+bool WindowsFile::MapReadOnly(const String& filename, EFileAccessPattern accessPattern, const uint8*& outData, sizet& outSize)
+{
+    outData = nullptr;
+    outSize = 0;
+
+    DWORD flags = FILE_ATTRIBUTE_NORMAL;
+
+    if (accessPattern == EFileAccessPattern::Sequential)
+    {
+        flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+    }
+    else if (accessPattern == EFileAccessPattern::Random)
+    {
+        flags |= FILE_FLAG_RANDOM_ACCESS;
+    }
+
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize {};
+
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    if (fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    // The view keeps both the mapping and the file alive, the handles aren't needed past this point.
+    CloseHandle(file);
+
+    if (!mapping)
+    {
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    CloseHandle(mapping);
+
+    if (!view)
+    {
+        return false;
+    }
+
+    outData = static_cast<const uint8*>(view);
+    outSize = static_cast<sizet>(fileSize.QuadPart);
+
+    return true;
+}
+
+void WindowsFile::Unmap(const uint8* data)
+{
+    if (data)
+    {
+        UnmapViewOfFile(data);
+    }
+}
+
+void WindowsFile::Prefetch(const uint8* data, sizet size)
+{
+    if (!data || size == 0)
+    {
+        return;
+    }
+
+    WIN32_MEMORY_RANGE_ENTRY range {.VirtualAddress = const_cast<uint8*>(data), .NumberOfBytes = size};
+
+    // Only a hint, the pages are faulted in on access if the prefetch fails.
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+} // namespace Zn
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <Core/HAL/BasicTypes.h>
+#include <Core/Event.h>
+
+union SDL_Event;
 
 namespace Zn
 {
 class Window;
 class Engine;
-struct InputState;
 
 class Application
 {
@@ -21,7 +23,10 @@ class Application
 
     SharedPtr<Window> GetWindow() const;
 
-    SharedPtr<InputState> GetInputState() const;
+    // Keyboard, mouse and controller events, broadcast by ProcessOSEvents along with the frame delta time.
+    using InputEvent = TMulticastEvent<const SDL_Event&, f32>;
+
+    InputEvent& GetInputEvent();
 
     void RequestExit(String exitReason);
 
@@ -32,7 +37,7 @@ class Application
 
     SharedPtr<Window> window;
 
-    SharedPtr<InputState> input;
+    InputEvent inputEvent;
 
     bool is_initialized = false;
 
@@ -1,12 +0,0 @@
-#pragma once
-
-#include <Core/HAL/BasicTypes.h>
-#include <SDL.h>
-
-namespace Zn
-{
-struct InputState
-{
-    Vector<SDL_Event> events;
-};
-} // namespace Zn
\ No newline at end of file
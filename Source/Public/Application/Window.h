@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Core/HAL/BasicTypes.h>
+#include <Core/Event.h>
 
 struct SDL_Window;
 struct SDL_Surface;
@@ -22,9 +23,29 @@ class Window
         return windowID;
     }
 
+    // Broadcast by ProcessEvent, on the main thread.
+    TMulticastEvent<>& GetResizedEvent()
+    {
+        return resizedEvent;
+    }
+
+    TMulticastEvent<>& GetMinimizedEvent()
+    {
+        return minimizedEvent;
+    }
+
+    TMulticastEvent<>& GetRestoredEvent()
+    {
+        return restoredEvent;
+    }
+
   private:
     SDL_Window* window {nullptr};
     uint32      windowID {0};
     void*       nativeHandle {nullptr};
+
+    TMulticastEvent<> resizedEvent;
+    TMulticastEvent<> minimizedEvent;
+    TMulticastEvent<> restoredEvent;
 };
 } // namespace Zn
@@ -1,6 +1,7 @@
 #pragma once
 #include "Core/Async/ITaskGraphNode.h"
 #include "Core/HAL/BasicTypes.h"
+#include "Core/Containers/InlineVector.h"
 #include <list>
 #include <optional>
 
@@ -31,7 +32,8 @@ class TaskGraph : public ITaskGraphNode
     void InsertAfter(SharedPtr<ITaskGraphNode> task, SharedPtr<ITaskGraphNode> insert_after_task);
 
   private:
-    using GraphType = std::list<Vector<SharedPtr<ITaskGraphNode>>>;
+    // Levels rarely hold more than a handful of tasks, keep them in-node.
+    using GraphType = std::list<InlineVector<SharedPtr<ITaskGraphNode>, 8>>;
 
     GraphType m_Graph;
 
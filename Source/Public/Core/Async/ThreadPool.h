@@ -0,0 +1,81 @@
+#pragma once
+#include "Core/HAL/BasicTypes.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+namespace Zn
+{
+class Thread;
+class ThreadPoolWorker;
+
+enum class ETaskPriority : uint8
+{
+    High,
+    Normal,
+    Low,
+    Count
+};
+
+// Fixed set of worker threads consuming a prioritized FIFO of tasks.
+// Higher priority queues are always drained first, tasks with the same priority run in submission order.
+class ThreadPool
+{
+  public:
+    using Task = std::function<void()>;
+
+    ThreadPool(String name, uint32 numThreads);
+
+    // Waits for the tasks already queued to complete, then joins the workers.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Enqueue(Task&& task, ETaskPriority priority = ETaskPriority::Normal);
+
+    // Queues all the tasks under a single lock and wakes up as many workers as needed.
+    void EnqueueBatch(Vector<Task>&& tasks, ETaskPriority priority = ETaskPriority::Normal);
+
+    // Runs one queued task on the calling thread. Returns false if there was nothing to run.
+    // Lets a thread waiting on pool results help instead of blocking.
+    bool TryRunPendingTask();
+
+    // Calls body(index) for every index in [0, count) on the workers and on the calling thread, returns once all calls are done.
+    // Indices are handed out one at a time, so uneven work balances itself. Can be called from a task running on this pool.
+    void ParallelFor(sizet count, const std::function<void(sizet)>& body);
+
+    uint32 GetNumThreads() const
+    {
+        return static_cast<uint32>(m_Threads.size());
+    }
+
+    // One worker per logical core, minus the calling thread.
+    static uint32 GetDefaultNumThreads();
+
+    // Pool shared by the engine systems for CPU bound work, created on first use.
+    static ThreadPool& GetWorkerPool();
+
+    // Completes the queued work and joins the shared pool workers.
+    static void ShutdownWorkerPool();
+
+  private:
+    friend ThreadPoolWorker;
+
+    void WorkerLoop();
+
+    bool PopTask(Task& outTask);
+
+    String m_Name;
+
+    std::mutex              m_Mutex;
+    std::condition_variable m_Condition;
+
+    std::deque<Task> m_Queues[static_cast<sizet>(ETaskPriority::Count)];
+
+    bool m_bStopping = false;
+
+    Vector<UniquePtr<ThreadPoolWorker>> m_Workers;
+    Vector<Thread*>                     m_Threads;
+};
+} // namespace Zn
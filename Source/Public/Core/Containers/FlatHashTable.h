@@ -0,0 +1,837 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Core/Hash.h>
+#include <Core/AssertionMacros.h>
+#include <bit>
+#include <memory_resource>
+#include <utility>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ZN_FLAT_HASH_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define ZN_FLAT_HASH_SSE2 0
+#endif
+
+/*
+    Open-addressing hash table with SwissTable-style metadata.
+    Every slot has one control byte: the high bit marks it as empty/deleted, otherwise the low 7 bits store H2 (7 bits of the hash).
+    Lookups probe 16 control bytes at a time (one SSE2 compare), and only touch the slot array for candidates whose H2 matches.
+    Slots are stored contiguously in a single allocation, obtained from a std::pmr::memory_resource.
+*/
+namespace Zn
+{
+// Default hasher for flat containers. std::hash is the identity for integers and pointers on some platforms,
+// which is a poor fit for H1/H2 splitting, so the result is always mixed.
+template<typename T>
+struct FlatHash
+{
+    u64 operator()(const T& value) const
+    {
+        return HashCombine(static_cast<u64>(std::hash<T> {}(value)), 0x9E3779B97F4A7C15ull);
+    }
+};
+
+namespace FlatHashDetail
+{
+using ctrl_t = i8;
+
+enum Ctrl : ctrl_t
+{
+    kEmpty   = -128, // 0b10000000
+    kDeleted = -2,   // 0b11111110
+};
+
+inline bool IsFull(ctrl_t ctrl)
+{
+    return ctrl >= 0;
+}
+
+// Bitmask of matching positions inside a group. Iterating yields the index of each set bit.
+class BitMask
+{
+  public:
+    explicit BitMask(u32 mask)
+        : m_Mask(mask)
+    {
+    }
+
+    BitMask& operator++()
+    {
+        m_Mask &= (m_Mask - 1);
+        return *this;
+    }
+
+    u32 operator*() const
+    {
+        return static_cast<u32>(std::countr_zero(m_Mask));
+    }
+
+    BitMask begin() const
+    {
+        return *this;
+    }
+
+    BitMask end() const
+    {
+        return BitMask(0);
+    }
+
+    bool operator!=(const BitMask& other) const
+    {
+        return m_Mask != other.m_Mask;
+    }
+
+    explicit operator bool() const
+    {
+        return m_Mask != 0;
+    }
+
+    u32 LowestBitSet() const
+    {
+        return static_cast<u32>(std::countr_zero(m_Mask));
+    }
+
+    u32 TrailingZeros() const
+    {
+        return static_cast<u32>(std::countr_zero(m_Mask));
+    }
+
+    // Leading zeros within a 16 bit group mask.
+    u32 LeadingZeros() const
+    {
+        return static_cast<u32>(std::countl_zero(m_Mask << 16));
+    }
+
+  private:
+    u32 m_Mask;
+};
+
+struct Group
+{
+    static constexpr sizet kWidth = 16;
+
+#if ZN_FLAT_HASH_SSE2
+    explicit Group(const ctrl_t* ctrl)
+        : m_Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+    {
+    }
+
+    BitMask Match(ctrl_t h2) const
+    {
+        return BitMask(static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_Ctrl))));
+    }
+
+    BitMask MatchEmpty() const
+    {
+        return BitMask(static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kEmpty), m_Ctrl))));
+    }
+
+    // Empty and deleted are the only control bytes with the sign bit set.
+    BitMask MatchEmptyOrDeleted() const
+    {
+        return BitMask(static_cast<u32>(_mm_movemask_epi8(m_Ctrl)));
+    }
+
+    __m128i m_Ctrl;
+#else
+    explicit Group(const ctrl_t* ctrl)
+    {
+        memcpy(m_Ctrl, ctrl, kWidth);
+    }
+
+    BitMask Match(ctrl_t h2) const
+    {
+        u32 mask = 0;
+        for (u32 index = 0; index < kWidth; ++index)
+        {
+            mask |= static_cast<u32>(m_Ctrl[index] == h2) << index;
+        }
+        return BitMask(mask);
+    }
+
+    BitMask MatchEmpty() const
+    {
+        return Match(kEmpty);
+    }
+
+    BitMask MatchEmptyOrDeleted() const
+    {
+        u32 mask = 0;
+        for (u32 index = 0; index < kWidth; ++index)
+        {
+            mask |= static_cast<u32>(m_Ctrl[index] < 0) << index;
+        }
+        return BitMask(mask);
+    }
+
+    ctrl_t m_Ctrl[kWidth];
+#endif
+};
+
+// Control bytes used by tables that have not allocated yet, so lookups never need a null check.
+alignas(16) inline constexpr ctrl_t kEmptyGroup[Group::kWidth] = {
+    kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty};
+
+inline sizet H1(u64 hash)
+{
+    return static_cast<sizet>(hash >> 7);
+}
+
+inline ctrl_t H2(u64 hash)
+{
+    return static_cast<ctrl_t>(hash & 0x7F);
+}
+
+// Max number of elements before growing, 7/8 load factor.
+inline sizet CapacityToGrowth(sizet capacity)
+{
+    return capacity - capacity / 8;
+}
+} // namespace FlatHashDetail
+
+// Raw table shared by FlatMap and FlatSet. TKeyOf extracts the key from a stored value.
+template<typename TValue, typename TKey, typename TKeyOf, typename THash, typename TEqual>
+class FlatHashTable
+{
+  protected:
+    using ctrl_t = FlatHashDetail::ctrl_t;
+    using Group  = FlatHashDetail::Group;
+
+  public:
+    using key_type        = TKey;
+    using value_type      = TValue;
+    using size_type       = sizet;
+    using hasher          = THash;
+    using key_equal       = TEqual;
+    using allocator_type  = std::pmr::polymorphic_allocator<std::byte>;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    template<bool IsConst>
+    class Iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = TValue;
+        using difference_type   = ptrdiff_t;
+        using pointer           = std::conditional_t<IsConst, const TValue*, TValue*>;
+        using reference         = std::conditional_t<IsConst, const TValue&, TValue&>;
+
+        Iterator() = default;
+
+        Iterator(const ctrl_t* ctrl, const ctrl_t* ctrlEnd, pointer slot)
+            : m_Ctrl(ctrl)
+            , m_CtrlEnd(ctrlEnd)
+            , m_Slot(slot)
+        {
+        }
+
+        // iterator -> const_iterator
+        operator Iterator<true>() const
+        {
+            return Iterator<true>(m_Ctrl, m_CtrlEnd, m_Slot);
+        }
+
+        reference operator*() const
+        {
+            return *m_Slot;
+        }
+
+        pointer operator->() const
+        {
+            return m_Slot;
+        }
+
+        Iterator& operator++()
+        {
+            ++m_Ctrl;
+            ++m_Slot;
+            SkipEmptyOrDeleted();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return m_Slot == other.m_Slot;
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return m_Slot != other.m_Slot;
+        }
+
+      private:
+        friend class FlatHashTable;
+
+        void SkipEmptyOrDeleted()
+        {
+            while (m_Ctrl != m_CtrlEnd && !FlatHashDetail::IsFull(*m_Ctrl))
+            {
+                ++m_Ctrl;
+                ++m_Slot;
+            }
+        }
+
+        const ctrl_t* m_Ctrl    = nullptr;
+        const ctrl_t* m_CtrlEnd = nullptr;
+        pointer       m_Slot    = nullptr;
+    };
+
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashTable()
+        : FlatHashTable(allocator_type {})
+    {
+    }
+
+    explicit FlatHashTable(const allocator_type& allocator)
+        : m_Allocator(allocator)
+    {
+    }
+
+    FlatHashTable(const FlatHashTable& other)
+        : FlatHashTable(other, allocator_type {})
+    {
+    }
+
+    FlatHashTable(const FlatHashTable& other, const allocator_type& allocator)
+        : m_Allocator(allocator)
+        , m_Hash(other.m_Hash)
+        , m_Equal(other.m_Equal)
+    {
+        reserve(other.size());
+
+        for (const value_type& value : other)
+        {
+            InsertUnique(value);
+        }
+    }
+
+    FlatHashTable(FlatHashTable&& other) noexcept
+        : m_Allocator(other.m_Allocator)
+        , m_Hash(std::move(other.m_Hash))
+        , m_Equal(std::move(other.m_Equal))
+    {
+        StealFrom(other);
+    }
+
+    FlatHashTable& operator=(const FlatHashTable& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.size());
+
+            for (const value_type& value : other)
+            {
+                InsertUnique(value);
+            }
+        }
+
+        return *this;
+    }
+
+    FlatHashTable& operator=(FlatHashTable&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_Allocator == other.m_Allocator)
+            {
+                DestroyAndDeallocate();
+                StealFrom(other);
+            }
+            else
+            {
+                // Different memory resources, cannot take ownership of the other allocation.
+                clear();
+                reserve(other.size());
+
+                for (value_type& value : other)
+                {
+                    InsertUnique(std::move(value));
+                }
+
+                other.clear();
+            }
+        }
+
+        return *this;
+    }
+
+    ~FlatHashTable()
+    {
+        DestroyAndDeallocate();
+    }
+
+    iterator begin()
+    {
+        iterator it(m_Ctrl, m_Ctrl + m_Capacity, m_Slots);
+        it.SkipEmptyOrDeleted();
+        return it;
+    }
+
+    iterator end()
+    {
+        return iterator(m_Ctrl + m_Capacity, m_Ctrl + m_Capacity, m_Slots + m_Capacity);
+    }
+
+    const_iterator begin() const
+    {
+        const_iterator it(m_Ctrl, m_Ctrl + m_Capacity, m_Slots);
+        it.SkipEmptyOrDeleted();
+        return it;
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(m_Ctrl + m_Capacity, m_Ctrl + m_Capacity, m_Slots + m_Capacity);
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+    bool empty() const
+    {
+        return m_Size == 0;
+    }
+
+    sizet size() const
+    {
+        return m_Size;
+    }
+
+    sizet capacity() const
+    {
+        return m_Capacity;
+    }
+
+    f32 load_factor() const
+    {
+        return m_Capacity > 0 ? static_cast<f32>(m_Size) / static_cast<f32>(m_Capacity) : 0.f;
+    }
+
+    allocator_type get_allocator() const
+    {
+        return m_Allocator;
+    }
+
+    void clear()
+    {
+        if (m_Capacity == 0)
+        {
+            return;
+        }
+
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            for (sizet index = 0; index < m_Capacity; ++index)
+            {
+                if (FlatHashDetail::IsFull(m_Ctrl[index]))
+                {
+                    std::destroy_at(m_Slots + index);
+                }
+            }
+        }
+
+        ResetCtrl();
+        m_Size       = 0;
+        m_GrowthLeft = FlatHashDetail::CapacityToGrowth(m_Capacity);
+    }
+
+    void reserve(sizet count)
+    {
+        if (count > m_Size + m_GrowthLeft)
+        {
+            // Smallest power of two whose growth covers count.
+            sizet newCapacity = std::max<sizet>(Group::kWidth, std::bit_ceil(count + count / 7 + 1));
+            Resize(newCapacity);
+        }
+    }
+
+    void rehash(sizet count)
+    {
+        Resize(std::max<sizet>({Group::kWidth, std::bit_ceil(count), std::bit_ceil(m_Size + m_Size / 7 + 1)}));
+    }
+
+    iterator find(const key_type& key)
+    {
+        if (sizet index = FindIndex(key); index != kNotFound)
+        {
+            return IteratorAt(index);
+        }
+
+        return end();
+    }
+
+    const_iterator find(const key_type& key) const
+    {
+        if (sizet index = FindIndex(key); index != kNotFound)
+        {
+            return IteratorAt(index);
+        }
+
+        return end();
+    }
+
+    bool contains(const key_type& key) const
+    {
+        return FindIndex(key) != kNotFound;
+    }
+
+    sizet count(const key_type& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return EmplaceWithKey(TKeyOf {}(value), value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        const key_type& key = TKeyOf {}(value);
+        return EmplaceWithKey(key, std::move(value));
+    }
+
+    template<typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            insert(*first);
+        }
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        // Build the value first to know its key, then move it in place.
+        value_type value(std::forward<Args>(args)...);
+        return insert(std::move(value));
+    }
+
+    sizet erase(const key_type& key)
+    {
+        if (sizet index = FindIndex(key); index != kNotFound)
+        {
+            EraseAt(index);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    // Erasing never moves other elements, the returned iterator points to the next element.
+    iterator erase(const_iterator position)
+    {
+        const sizet index = static_cast<sizet>(position.m_Slot - m_Slots);
+        EraseAt(index);
+
+        iterator next(m_Ctrl + index, m_Ctrl + m_Capacity, m_Slots + index);
+        next.SkipEmptyOrDeleted();
+        return next;
+    }
+
+    iterator erase(iterator position)
+    {
+        return erase(const_iterator(position));
+    }
+
+    void swap(FlatHashTable& other) noexcept
+    {
+        check(m_Allocator == other.m_Allocator);
+
+        std::swap(m_Ctrl, other.m_Ctrl);
+        std::swap(m_Slots, other.m_Slots);
+        std::swap(m_Capacity, other.m_Capacity);
+        std::swap(m_Size, other.m_Size);
+        std::swap(m_GrowthLeft, other.m_GrowthLeft);
+        std::swap(m_Hash, other.m_Hash);
+        std::swap(m_Equal, other.m_Equal);
+    }
+
+  protected:
+    static constexpr sizet kNotFound = static_cast<sizet>(-1);
+
+    iterator IteratorAt(sizet index)
+    {
+        return iterator(m_Ctrl + index, m_Ctrl + m_Capacity, m_Slots + index);
+    }
+
+    const_iterator IteratorAt(sizet index) const
+    {
+        return const_iterator(m_Ctrl + index, m_Ctrl + m_Capacity, m_Slots + index);
+    }
+
+    sizet FindIndex(const key_type& key) const
+    {
+        if (m_Size == 0)
+        {
+            return kNotFound;
+        }
+
+        const u64    hash   = m_Hash(key);
+        const ctrl_t h2     = FlatHashDetail::H2(hash);
+        const sizet  mask   = m_Capacity - 1;
+        sizet        offset = FlatHashDetail::H1(hash) & mask;
+        sizet        step   = 0;
+
+        while (true)
+        {
+            Group group(m_Ctrl + offset);
+
+            for (u32 bit : group.Match(h2))
+            {
+                const sizet index = (offset + bit) & mask;
+
+                if (m_Equal(TKeyOf {}(m_Slots[index]), key))
+                {
+                    return index;
+                }
+            }
+
+            if (group.MatchEmpty())
+            {
+                return kNotFound;
+            }
+
+            // Triangular probing over groups, visits every group exactly once for power of two capacities.
+            step += Group::kWidth;
+            offset = (offset + step) & mask;
+
+            check(step <= m_Capacity);
+        }
+    }
+
+    // First empty or deleted slot on the probe sequence of hash.
+    sizet FindFirstNonFull(u64 hash) const
+    {
+        const sizet mask   = m_Capacity - 1;
+        sizet       offset = FlatHashDetail::H1(hash) & mask;
+        sizet       step   = 0;
+
+        while (true)
+        {
+            Group group(m_Ctrl + offset);
+
+            if (auto available = group.MatchEmptyOrDeleted())
+            {
+                return (offset + available.LowestBitSet()) & mask;
+            }
+
+            step += Group::kWidth;
+            offset = (offset + step) & mask;
+
+            check(step <= m_Capacity);
+        }
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> EmplaceWithKey(const key_type& key, Args&&... args)
+    {
+        if (sizet index = FindIndex(key); index != kNotFound)
+        {
+            return {IteratorAt(index), false};
+        }
+
+        const sizet index = PrepareInsert(m_Hash(key));
+
+        std::construct_at(m_Slots + index, std::forward<Args>(args)...);
+
+        return {IteratorAt(index), true};
+    }
+
+    // Inserts a value known not to be in the table.
+    template<typename TArg>
+    void InsertUnique(TArg&& value)
+    {
+        const sizet index = PrepareInsert(m_Hash(TKeyOf {}(value)));
+        std::construct_at(m_Slots + index, std::forward<TArg>(value));
+    }
+
+    // Reserves a slot for a new element with the given hash and marks it as full. The caller constructs the value.
+    sizet PrepareInsert(u64 hash)
+    {
+        if (m_Capacity == 0)
+        {
+            Resize(Group::kWidth);
+        }
+
+        sizet index = FindFirstNonFull(hash);
+
+        // Reusing a tombstone does not consume growth.
+        if (m_GrowthLeft == 0 && m_Ctrl[index] != FlatHashDetail::kDeleted)
+        {
+            // When many slots are tombstones, rehashing in place is enough to reclaim them.
+            const sizet newCapacity = m_Size * 2 < FlatHashDetail::CapacityToGrowth(m_Capacity) ? m_Capacity : m_Capacity * 2;
+            Resize(newCapacity);
+            index = FindFirstNonFull(hash);
+        }
+
+        m_GrowthLeft -= (m_Ctrl[index] == FlatHashDetail::kEmpty) ? 1 : 0;
+        ++m_Size;
+        SetCtrl(index, FlatHashDetail::H2(hash));
+
+        return index;
+    }
+
+    void EraseAt(sizet index)
+    {
+        check(FlatHashDetail::IsFull(m_Ctrl[index]));
+
+        std::destroy_at(m_Slots + index);
+        --m_Size;
+
+        // If the group around this slot was never full, no probe sequence passed through it and the slot can go back to empty.
+        const sizet mask        = m_Capacity - 1;
+        const sizet indexBefore = (index - Group::kWidth) & mask;
+
+        const auto emptyAfter  = Group(m_Ctrl + index).MatchEmpty();
+        const auto emptyBefore = Group(m_Ctrl + indexBefore).MatchEmpty();
+
+        const bool wasNeverFull =
+            emptyBefore && emptyAfter && (emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros()) < Group::kWidth;
+
+        if (wasNeverFull)
+        {
+            SetCtrl(index, FlatHashDetail::kEmpty);
+            ++m_GrowthLeft;
+        }
+        else
+        {
+            SetCtrl(index, FlatHashDetail::kDeleted);
+        }
+    }
+
+    // Sets the control byte and its clone past the end, so group loads near the end of the array wrap around.
+    void SetCtrl(sizet index, ctrl_t value)
+    {
+        m_Ctrl[index] = value;
+
+        if (index < Group::kWidth - 1)
+        {
+            m_Ctrl[m_Capacity + index] = value;
+        }
+    }
+
+    void ResetCtrl()
+    {
+        memset(m_Ctrl, static_cast<u8>(FlatHashDetail::kEmpty), m_Capacity + Group::kWidth);
+    }
+
+    static sizet SlotsOffset(sizet capacity)
+    {
+        const sizet ctrlBytes = capacity + Group::kWidth;
+        return (ctrlBytes + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+    }
+
+    static sizet AllocationSize(sizet capacity)
+    {
+        return SlotsOffset(capacity) + capacity * sizeof(value_type);
+    }
+
+    static constexpr sizet kAllocationAlignment = std::max<sizet>(alignof(value_type), Group::kWidth);
+
+    void Resize(sizet newCapacity)
+    {
+        check(std::has_single_bit(newCapacity) && newCapacity >= Group::kWidth);
+
+        ctrl_t*     oldCtrl     = m_Ctrl;
+        value_type* oldSlots    = m_Slots;
+        const sizet oldCapacity = m_Capacity;
+
+        std::byte* memory = static_cast<std::byte*>(m_Allocator.resource()->allocate(AllocationSize(newCapacity), kAllocationAlignment));
+
+        m_Ctrl       = reinterpret_cast<ctrl_t*>(memory);
+        m_Slots      = reinterpret_cast<value_type*>(memory + SlotsOffset(newCapacity));
+        m_Capacity   = newCapacity;
+        m_GrowthLeft = FlatHashDetail::CapacityToGrowth(newCapacity) - m_Size;
+
+        ResetCtrl();
+
+        for (sizet index = 0; index < oldCapacity; ++index)
+        {
+            if (FlatHashDetail::IsFull(oldCtrl[index]))
+            {
+                const u64   hash     = m_Hash(TKeyOf {}(oldSlots[index]));
+                const sizet newIndex = FindFirstNonFull(hash);
+
+                SetCtrl(newIndex, FlatHashDetail::H2(hash));
+
+                std::construct_at(m_Slots + newIndex, std::move(oldSlots[index]));
+                std::destroy_at(oldSlots + index);
+            }
+        }
+
+        if (oldCapacity > 0)
+        {
+            m_Allocator.resource()->deallocate(oldCtrl, AllocationSize(oldCapacity), kAllocationAlignment);
+        }
+    }
+
+    void DestroyAndDeallocate()
+    {
+        if (m_Capacity > 0)
+        {
+            clear();
+            m_Allocator.resource()->deallocate(m_Ctrl, AllocationSize(m_Capacity), kAllocationAlignment);
+        }
+
+        ResetToEmpty();
+    }
+
+    void StealFrom(FlatHashTable& other)
+    {
+        m_Ctrl       = other.m_Ctrl;
+        m_Slots      = other.m_Slots;
+        m_Capacity   = other.m_Capacity;
+        m_Size       = other.m_Size;
+        m_GrowthLeft = other.m_GrowthLeft;
+
+        other.ResetToEmpty();
+    }
+
+    void ResetToEmpty()
+    {
+        m_Ctrl       = const_cast<ctrl_t*>(FlatHashDetail::kEmptyGroup);
+        m_Slots      = nullptr;
+        m_Capacity   = 0;
+        m_Size       = 0;
+        m_GrowthLeft = 0;
+    }
+
+    allocator_type m_Allocator;
+
+    [[no_unique_address]] THash m_Hash {};
+
+    [[no_unique_address]] TEqual m_Equal {};
+
+    ctrl_t* m_Ctrl = const_cast<ctrl_t*>(FlatHashDetail::kEmptyGroup);
+
+    value_type* m_Slots = nullptr;
+
+    sizet m_Capacity = 0;
+
+    sizet m_Size = 0;
+
+    sizet m_GrowthLeft = 0;
+};
+} // namespace Zn
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Core/Containers/FlatHashTable.h>
+#include <functional>
+
+namespace Zn
+{
+namespace FlatHashDetail
+{
+struct PairKeyOf
+{
+    template<typename TPair>
+    const auto& operator()(const TPair& pair) const
+    {
+        return pair.first;
+    }
+};
+} // namespace FlatHashDetail
+
+// Cache-friendly replacement for UnorderedMap. Same interface as std::unordered_map for the common operations,
+// but elements live in a flat array: references and iterators are invalidated by any insertion that grows the table.
+template<typename K, typename V, typename THash = FlatHash<K>, typename TEqual = std::equal_to<K>>
+class FlatMap : public FlatHashTable<std::pair<const K, V>, K, FlatHashDetail::PairKeyOf, THash, TEqual>
+{
+    using Super = FlatHashTable<std::pair<const K, V>, K, FlatHashDetail::PairKeyOf, THash, TEqual>;
+
+  public:
+    using mapped_type = V;
+    using typename Super::allocator_type;
+    using typename Super::const_iterator;
+    using typename Super::iterator;
+    using typename Super::value_type;
+
+    using Super::Super;
+
+    FlatMap(std::initializer_list<value_type> values, const allocator_type& allocator = {})
+        : Super(allocator)
+    {
+        Super::reserve(values.size());
+        Super::insert(values.begin(), values.end());
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return Super::EmplaceWithKey(
+            key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return Super::EmplaceWithKey(
+            key, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template<typename TValue>
+    std::pair<iterator, bool> insert_or_assign(const K& key, TValue&& value)
+    {
+        auto result = try_emplace(key, std::forward<TValue>(value));
+
+        if (!result.second)
+        {
+            result.first->second = std::forward<TValue>(value);
+        }
+
+        return result;
+    }
+
+    V& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    V& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    V& at(const K& key)
+    {
+        auto it = Super::find(key);
+        check(it != Super::end());
+        return it->second;
+    }
+
+    const V& at(const K& key) const
+    {
+        auto it = Super::find(key);
+        check(it != Super::end());
+        return it->second;
+    }
+};
+} // namespace Zn
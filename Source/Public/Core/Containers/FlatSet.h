@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Core/Containers/FlatHashTable.h>
+#include <functional>
+
+namespace Zn
+{
+namespace FlatHashDetail
+{
+struct IdentityKeyOf
+{
+    template<typename T>
+    const T& operator()(const T& value) const
+    {
+        return value;
+    }
+};
+} // namespace FlatHashDetail
+
+// Cache-friendly replacement for UnorderedSet. Iterators and references are invalidated by any insertion that grows the table.
+template<typename T, typename THash = FlatHash<T>, typename TEqual = std::equal_to<T>>
+class FlatSet : public FlatHashTable<T, T, FlatHashDetail::IdentityKeyOf, THash, TEqual>
+{
+    using Super = FlatHashTable<T, T, FlatHashDetail::IdentityKeyOf, THash, TEqual>;
+
+  public:
+    using typename Super::allocator_type;
+    using typename Super::value_type;
+
+    using Super::Super;
+
+    FlatSet(std::initializer_list<T> values, const allocator_type& allocator = {})
+        : Super(allocator)
+    {
+        Super::reserve(values.size());
+        Super::insert(values.begin(), values.end());
+    }
+
+    template<typename TIterator>
+    FlatSet(TIterator first, TIterator last, const allocator_type& allocator = {})
+        : Super(allocator)
+    {
+        Super::insert(first, last);
+    }
+};
+} // namespace Zn
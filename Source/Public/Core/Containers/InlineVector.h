@@ -0,0 +1,483 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Core/AssertionMacros.h>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+
+namespace Zn
+{
+// Vector that keeps up to N elements in-object and only touches the heap once it grows past that.
+// Moving an inline InlineVector moves the elements one by one, moving a spilled one steals the heap block.
+template<typename T, sizet N>
+class InlineVector
+{
+    static_assert(N > 0, "InlineVector requires an inline capacity of at least one element.");
+
+  public:
+    using value_type             = T;
+    using size_type              = sizet;
+    using difference_type        = ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using iterator               = T*;
+    using const_iterator         = const T*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr sizet kInlineCapacity = N;
+
+    InlineVector() = default;
+
+    explicit InlineVector(sizet count)
+    {
+        resize(count);
+    }
+
+    InlineVector(sizet count, const T& value)
+    {
+        resize(count, value);
+    }
+
+    InlineVector(std::initializer_list<T> values)
+    {
+        assign(values.begin(), values.end());
+    }
+
+    template<typename TIterator, typename = typename std::iterator_traits<TIterator>::iterator_category>
+    InlineVector(TIterator first, TIterator last)
+    {
+        assign(first, last);
+    }
+
+    InlineVector(const InlineVector& other)
+    {
+        assign(other.begin(), other.end());
+    }
+
+    InlineVector(InlineVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        StealFrom(other);
+    }
+
+    ~InlineVector()
+    {
+        std::destroy(begin(), end());
+        ReleaseHeap();
+    }
+
+    InlineVector& operator=(const InlineVector& other)
+    {
+        if (this != &other)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        return *this;
+    }
+
+    InlineVector& operator=(InlineVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            ReleaseHeap();
+            StealFrom(other);
+        }
+
+        return *this;
+    }
+
+    InlineVector& operator=(std::initializer_list<T> values)
+    {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    template<typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+        clear();
+
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<TIterator>::iterator_category>)
+        {
+            reserve(static_cast<sizet>(std::distance(first, last)));
+        }
+
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    // == Element Access ==
+
+    T& operator[](sizet index)
+    {
+        check(index < m_Size);
+        return m_Data[index];
+    }
+
+    const T& operator[](sizet index) const
+    {
+        check(index < m_Size);
+        return m_Data[index];
+    }
+
+    T& front()
+    {
+        return (*this)[0];
+    }
+
+    const T& front() const
+    {
+        return (*this)[0];
+    }
+
+    T& back()
+    {
+        return (*this)[m_Size - 1];
+    }
+
+    const T& back() const
+    {
+        return (*this)[m_Size - 1];
+    }
+
+    T* data()
+    {
+        return m_Data;
+    }
+
+    const T* data() const
+    {
+        return m_Data;
+    }
+
+    // == Iterators ==
+
+    iterator begin()
+    {
+        return m_Data;
+    }
+
+    const_iterator begin() const
+    {
+        return m_Data;
+    }
+
+    const_iterator cbegin() const
+    {
+        return m_Data;
+    }
+
+    iterator end()
+    {
+        return m_Data + m_Size;
+    }
+
+    const_iterator end() const
+    {
+        return m_Data + m_Size;
+    }
+
+    const_iterator cend() const
+    {
+        return m_Data + m_Size;
+    }
+
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    // == Capacity ==
+
+    bool empty() const
+    {
+        return m_Size == 0;
+    }
+
+    sizet size() const
+    {
+        return m_Size;
+    }
+
+    sizet capacity() const
+    {
+        return m_Capacity;
+    }
+
+    // True while the elements live in the in-object buffer.
+    bool IsInline() const
+    {
+        return m_Data == InlineData();
+    }
+
+    void reserve(sizet newCapacity)
+    {
+        if (newCapacity > m_Capacity)
+        {
+            Reallocate(newCapacity);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        if (IsInline())
+        {
+            return;
+        }
+
+        if (m_Size <= N)
+        {
+            T* heapData = m_Data;
+            std::uninitialized_move(heapData, heapData + m_Size, InlineData());
+            std::destroy(heapData, heapData + m_Size);
+            std::allocator<T> {}.deallocate(heapData, m_Capacity);
+
+            m_Data     = InlineData();
+            m_Capacity = N;
+        }
+        else if (m_Size < m_Capacity)
+        {
+            Reallocate(m_Size);
+        }
+    }
+
+    // == Modifiers ==
+
+    void clear()
+    {
+        std::destroy(begin(), end());
+        m_Size = 0;
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_Size < m_Capacity)
+        {
+            T* element = std::construct_at(m_Data + m_Size, std::forward<Args>(args)...);
+            ++m_Size;
+            return *element;
+        }
+
+        return GrowAndEmplaceBack(std::forward<Args>(args)...);
+    }
+
+    void pop_back()
+    {
+        check(m_Size > 0);
+        std::destroy_at(m_Data + --m_Size);
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        const sizet index = static_cast<sizet>(position - cbegin());
+        check(index <= m_Size);
+
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + index, end() - 1, end());
+
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator position, const T& value)
+    {
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, T&& value)
+    {
+        return emplace(position, std::move(value));
+    }
+
+    iterator erase(const_iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        iterator mutableFirst = begin() + (first - cbegin());
+        iterator mutableLast  = begin() + (last - cbegin());
+
+        check(mutableFirst >= begin() && mutableLast <= end() && mutableFirst <= mutableLast);
+
+        if (mutableFirst != mutableLast)
+        {
+            iterator newEnd = std::move(mutableLast, end(), mutableFirst);
+            std::destroy(newEnd, end());
+            m_Size = static_cast<sizet>(newEnd - begin());
+        }
+
+        return mutableFirst;
+    }
+
+    // Removes the element by moving the last one into its slot. Does not preserve ordering.
+    void EraseSwap(const_iterator position)
+    {
+        iterator mutablePosition = begin() + (position - cbegin());
+        check(mutablePosition >= begin() && mutablePosition < end());
+
+        if (mutablePosition != end() - 1)
+        {
+            *mutablePosition = std::move(back());
+        }
+
+        pop_back();
+    }
+
+    void resize(sizet count)
+    {
+        ResizeImpl(count);
+    }
+
+    void resize(sizet count, const T& value)
+    {
+        ResizeImpl(count, value);
+    }
+
+    friend bool operator==(const InlineVector& lhs, const InlineVector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+  private:
+    T* InlineData()
+    {
+        return reinterpret_cast<T*>(m_Inline);
+    }
+
+    const T* InlineData() const
+    {
+        return reinterpret_cast<const T*>(m_Inline);
+    }
+
+    sizet NextCapacity(sizet minCapacity) const
+    {
+        return std::max(minCapacity, m_Capacity * 2);
+    }
+
+    template<typename... Args>
+    void ResizeImpl(sizet count, const Args&... args)
+    {
+        if (count < m_Size)
+        {
+            std::destroy(begin() + count, end());
+            m_Size = count;
+            return;
+        }
+
+        reserve(count);
+
+        while (m_Size < count)
+        {
+            std::construct_at(m_Data + m_Size, args...);
+            ++m_Size;
+        }
+    }
+
+    template<typename... Args>
+    T& GrowAndEmplaceBack(Args&&... args)
+    {
+        const sizet newCapacity = NextCapacity(m_Size + 1);
+        T*          newData     = std::allocator<T> {}.allocate(newCapacity);
+
+        // Construct the new element first: args may reference an element that is about to be moved.
+        T* element = std::construct_at(newData + m_Size, std::forward<Args>(args)...);
+
+        std::uninitialized_move(begin(), end(), newData);
+        std::destroy(begin(), end());
+        ReleaseHeap();
+
+        m_Data     = newData;
+        m_Capacity = newCapacity;
+        ++m_Size;
+
+        return *element;
+    }
+
+    void Reallocate(sizet newCapacity)
+    {
+        check(newCapacity >= m_Size);
+
+        T* newData = std::allocator<T> {}.allocate(newCapacity);
+
+        std::uninitialized_move(begin(), end(), newData);
+        std::destroy(begin(), end());
+        ReleaseHeap();
+
+        m_Data     = newData;
+        m_Capacity = newCapacity;
+    }
+
+    void ReleaseHeap()
+    {
+        if (!IsInline())
+        {
+            std::allocator<T> {}.deallocate(m_Data, m_Capacity);
+            m_Data     = InlineData();
+            m_Capacity = N;
+        }
+    }
+
+    // Expects this to be empty and inline.
+    void StealFrom(InlineVector& other)
+    {
+        if (other.IsInline())
+        {
+            std::uninitialized_move(other.begin(), other.end(), InlineData());
+            m_Size = other.m_Size;
+            other.clear();
+        }
+        else
+        {
+            m_Data     = other.m_Data;
+            m_Size     = other.m_Size;
+            m_Capacity = other.m_Capacity;
+
+            other.m_Data     = other.InlineData();
+            other.m_Size     = 0;
+            other.m_Capacity = N;
+        }
+    }
+
+    T*    m_Data     = InlineData();
+    sizet m_Size     = 0;
+    sizet m_Capacity = N;
+
+    alignas(T) std::byte m_Inline[sizeof(T) * N];
+};
+} // namespace Zn
@@ -0,0 +1,327 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Core/AssertionMacros.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <optional>
+
+namespace Zn
+{
+enum class ERingBufferMode : u8
+{
+    SingleProducerSingleConsumer,
+    MultiProducerMultiConsumer
+};
+
+namespace RingBufferDetail
+{
+// Keeps producer and consumer indices on separate cache lines.
+static constexpr sizet kCacheLineSize = 64;
+
+inline sizet RoundUpCapacity(sizet capacity)
+{
+    return std::bit_ceil(std::max<sizet>(capacity, 2));
+}
+} // namespace RingBufferDetail
+
+// Bounded lock-free queue. Capacity is rounded up to a power of two and fixed at construction.
+// TryPush fails when the buffer is full and TryPop when it is empty, neither blocks.
+template<typename T, ERingBufferMode Mode = ERingBufferMode::MultiProducerMultiConsumer>
+class RingBuffer;
+
+// Single producer, single consumer: one thread pushes, one thread pops.
+template<typename T>
+class RingBuffer<T, ERingBufferMode::SingleProducerSingleConsumer>
+{
+  public:
+    explicit RingBuffer(sizet capacity)
+        : m_Capacity(RingBufferDetail::RoundUpCapacity(capacity))
+        , m_Mask(m_Capacity - 1)
+        , m_Slots(std::allocator<T> {}.allocate(m_Capacity))
+    {
+    }
+
+    RingBuffer(const RingBuffer&)            = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    ~RingBuffer()
+    {
+        while (TryPop())
+        {
+        }
+
+        std::allocator<T> {}.deallocate(m_Slots, m_Capacity);
+    }
+
+    template<typename... Args>
+    bool TryEmplace(Args&&... args)
+    {
+        const sizet tail = m_Tail.load(std::memory_order_relaxed);
+
+        if (tail - m_CachedHead == m_Capacity)
+        {
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+
+            if (tail - m_CachedHead == m_Capacity)
+            {
+                return false;
+            }
+        }
+
+        std::construct_at(m_Slots + (tail & m_Mask), std::forward<Args>(args)...);
+        m_Tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool TryPush(const T& value)
+    {
+        return TryEmplace(value);
+    }
+
+    bool TryPush(T&& value)
+    {
+        return TryEmplace(std::move(value));
+    }
+
+    bool TryPop(T& outValue)
+    {
+        if (std::optional<T> value = TryPop())
+        {
+            outValue = std::move(*value);
+            return true;
+        }
+
+        return false;
+    }
+
+    std::optional<T> TryPop()
+    {
+        const sizet head = m_Head.load(std::memory_order_relaxed);
+
+        if (head == m_CachedTail)
+        {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+
+            if (head == m_CachedTail)
+            {
+                return std::nullopt;
+            }
+        }
+
+        T*               slot = m_Slots + (head & m_Mask);
+        std::optional<T> value(std::move(*slot));
+        std::destroy_at(slot);
+
+        m_Head.store(head + 1, std::memory_order_release);
+
+        return value;
+    }
+
+    sizet Capacity() const
+    {
+        return m_Capacity;
+    }
+
+    // Only exact when neither side is running concurrently.
+    sizet SizeApprox() const
+    {
+        return m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_acquire);
+    }
+
+    bool IsEmpty() const
+    {
+        return SizeApprox() == 0;
+    }
+
+  private:
+    const sizet m_Capacity;
+    const sizet m_Mask;
+    T* const    m_Slots;
+
+    // Producer side
+    alignas(RingBufferDetail::kCacheLineSize) std::atomic<sizet> m_Tail {0};
+    sizet m_CachedHead = 0;
+
+    // Consumer side
+    alignas(RingBufferDetail::kCacheLineSize) std::atomic<sizet> m_Head {0};
+    sizet m_CachedTail = 0;
+};
+
+// Multiple producers, multiple consumers. Each slot carries a sequence number telling producers and consumers
+// whose turn it is, so a thread only ever contends on the shared cursor with a single CAS.
+template<typename T>
+class RingBuffer<T, ERingBufferMode::MultiProducerMultiConsumer>
+{
+  public:
+    explicit RingBuffer(sizet capacity)
+        : m_Capacity(RingBufferDetail::RoundUpCapacity(capacity))
+        , m_Mask(m_Capacity - 1)
+        , m_Cells(std::allocator<Cell> {}.allocate(m_Capacity))
+    {
+        for (sizet index = 0; index < m_Capacity; ++index)
+        {
+            std::construct_at(m_Cells + index)->sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    RingBuffer(const RingBuffer&)            = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    ~RingBuffer()
+    {
+        while (TryPop())
+        {
+        }
+
+        for (sizet index = 0; index < m_Capacity; ++index)
+        {
+            std::destroy_at(m_Cells + index);
+        }
+
+        std::allocator<Cell> {}.deallocate(m_Cells, m_Capacity);
+    }
+
+    template<typename... Args>
+    bool TryEmplace(Args&&... args)
+    {
+        Cell* cell     = nullptr;
+        sizet position = m_EnqueuePosition.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            cell = &m_Cells[position & m_Mask];
+
+            const sizet    sequence   = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false; // Full
+            }
+            else
+            {
+                position = m_EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::construct_at(cell->Value(), std::forward<Args>(args)...);
+        cell->sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool TryPush(const T& value)
+    {
+        return TryEmplace(value);
+    }
+
+    bool TryPush(T&& value)
+    {
+        return TryEmplace(std::move(value));
+    }
+
+    bool TryPop(T& outValue)
+    {
+        if (std::optional<T> value = TryPop())
+        {
+            outValue = std::move(*value);
+            return true;
+        }
+
+        return false;
+    }
+
+    std::optional<T> TryPop()
+    {
+        Cell* cell     = nullptr;
+        sizet position = m_DequeuePosition.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            cell = &m_Cells[position & m_Mask];
+
+            const sizet    sequence   = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (m_DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return std::nullopt; // Empty
+            }
+            else
+            {
+                position = m_DequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        std::optional<T> value(std::move(*cell->Value()));
+        std::destroy_at(cell->Value());
+
+        cell->sequence.store(position + m_Capacity, std::memory_order_release);
+
+        return value;
+    }
+
+    sizet Capacity() const
+    {
+        return m_Capacity;
+    }
+
+    // Only exact when no thread is pushing or popping.
+    sizet SizeApprox() const
+    {
+        const sizet enqueued = m_EnqueuePosition.load(std::memory_order_acquire);
+        const sizet dequeued = m_DequeuePosition.load(std::memory_order_acquire);
+
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    bool IsEmpty() const
+    {
+        return SizeApprox() == 0;
+    }
+
+  private:
+    struct Cell
+    {
+        std::atomic<sizet> sequence;
+
+        alignas(T) std::byte storage[sizeof(T)];
+
+        T* Value()
+        {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    const sizet m_Capacity;
+    const sizet m_Mask;
+    Cell* const m_Cells;
+
+    alignas(RingBufferDetail::kCacheLineSize) std::atomic<sizet> m_EnqueuePosition {0};
+    alignas(RingBufferDetail::kCacheLineSize) std::atomic<sizet> m_DequeuePosition {0};
+};
+
+template<typename T>
+using SPSCRingBuffer = RingBuffer<T, ERingBufferMode::SingleProducerSingleConsumer>;
+
+template<typename T>
+using MPMCRingBuffer = RingBuffer<T, ERingBufferMode::MultiProducerMultiConsumer>;
+} // namespace Zn
@@ -0,0 +1,377 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Core/AssertionMacros.h>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+
+namespace Zn
+{
+// Vector with a fixed capacity of N elements stored in-object. Never allocates: exceeding the capacity is an error.
+template<typename T, sizet N>
+class StaticVector
+{
+  public:
+    using value_type             = T;
+    using size_type              = sizet;
+    using difference_type        = ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using iterator               = T*;
+    using const_iterator         = const T*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    StaticVector() = default;
+
+    explicit StaticVector(sizet count)
+    {
+        resize(count);
+    }
+
+    StaticVector(sizet count, const T& value)
+    {
+        resize(count, value);
+    }
+
+    StaticVector(std::initializer_list<T> values)
+    {
+        assign(values.begin(), values.end());
+    }
+
+    template<typename TIterator, typename = typename std::iterator_traits<TIterator>::iterator_category>
+    StaticVector(TIterator first, TIterator last)
+    {
+        assign(first, last);
+    }
+
+    StaticVector(const StaticVector& other)
+    {
+        assign(other.begin(), other.end());
+    }
+
+    StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        std::uninitialized_move(other.begin(), other.end(), data());
+        m_Size = other.m_Size;
+        other.clear();
+    }
+
+    ~StaticVector()
+    {
+        clear();
+    }
+
+    StaticVector& operator=(const StaticVector& other)
+    {
+        if (this != &other)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        return *this;
+    }
+
+    StaticVector& operator=(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            clear();
+            std::uninitialized_move(other.begin(), other.end(), data());
+            m_Size = other.m_Size;
+            other.clear();
+        }
+
+        return *this;
+    }
+
+    StaticVector& operator=(std::initializer_list<T> values)
+    {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    template<typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+        clear();
+
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    // == Element Access ==
+
+    T& operator[](sizet index)
+    {
+        check(index < m_Size);
+        return data()[index];
+    }
+
+    const T& operator[](sizet index) const
+    {
+        check(index < m_Size);
+        return data()[index];
+    }
+
+    T& front()
+    {
+        return (*this)[0];
+    }
+
+    const T& front() const
+    {
+        return (*this)[0];
+    }
+
+    T& back()
+    {
+        return (*this)[m_Size - 1];
+    }
+
+    const T& back() const
+    {
+        return (*this)[m_Size - 1];
+    }
+
+    T* data()
+    {
+        return reinterpret_cast<T*>(m_Storage);
+    }
+
+    const T* data() const
+    {
+        return reinterpret_cast<const T*>(m_Storage);
+    }
+
+    // == Iterators ==
+
+    iterator begin()
+    {
+        return data();
+    }
+
+    const_iterator begin() const
+    {
+        return data();
+    }
+
+    const_iterator cbegin() const
+    {
+        return data();
+    }
+
+    iterator end()
+    {
+        return data() + m_Size;
+    }
+
+    const_iterator end() const
+    {
+        return data() + m_Size;
+    }
+
+    const_iterator cend() const
+    {
+        return data() + m_Size;
+    }
+
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    // == Capacity ==
+
+    bool empty() const
+    {
+        return m_Size == 0;
+    }
+
+    bool full() const
+    {
+        return m_Size == N;
+    }
+
+    sizet size() const
+    {
+        return m_Size;
+    }
+
+    static constexpr sizet capacity()
+    {
+        return N;
+    }
+
+    static constexpr sizet max_size()
+    {
+        return N;
+    }
+
+    // == Modifiers ==
+
+    void clear()
+    {
+        std::destroy(begin(), end());
+        m_Size = 0;
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        checkMsg(m_Size < N, "StaticVector capacity (%zu) exceeded.", N);
+
+        T* element = std::construct_at(data() + m_Size, std::forward<Args>(args)...);
+        ++m_Size;
+
+        return *element;
+    }
+
+    // Returns false instead of asserting when the vector is full.
+    template<typename... Args>
+    bool TryEmplaceBack(Args&&... args)
+    {
+        if (full())
+        {
+            return false;
+        }
+
+        emplace_back(std::forward<Args>(args)...);
+        return true;
+    }
+
+    void pop_back()
+    {
+        check(m_Size > 0);
+        std::destroy_at(data() + --m_Size);
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        const sizet index = static_cast<sizet>(position - cbegin());
+        check(index <= m_Size);
+
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + index, end() - 1, end());
+
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator position, const T& value)
+    {
+        return emplace(position, value);
+    }
+
+    iterator insert(const_iterator position, T&& value)
+    {
+        return emplace(position, std::move(value));
+    }
+
+    iterator erase(const_iterator position)
+    {
+        return erase(position, position + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        iterator mutableFirst = begin() + (first - cbegin());
+        iterator mutableLast  = begin() + (last - cbegin());
+
+        check(mutableFirst >= begin() && mutableLast <= end() && mutableFirst <= mutableLast);
+
+        if (mutableFirst != mutableLast)
+        {
+            iterator newEnd = std::move(mutableLast, end(), mutableFirst);
+            std::destroy(newEnd, end());
+            m_Size = static_cast<sizet>(newEnd - begin());
+        }
+
+        return mutableFirst;
+    }
+
+    // Removes the element by moving the last one into its slot. Does not preserve ordering.
+    void EraseSwap(const_iterator position)
+    {
+        iterator mutablePosition = begin() + (position - cbegin());
+        check(mutablePosition >= begin() && mutablePosition < end());
+
+        if (mutablePosition != end() - 1)
+        {
+            *mutablePosition = std::move(back());
+        }
+
+        pop_back();
+    }
+
+    void resize(sizet count)
+    {
+        ResizeImpl(count);
+    }
+
+    void resize(sizet count, const T& value)
+    {
+        ResizeImpl(count, value);
+    }
+
+    friend bool operator==(const StaticVector& lhs, const StaticVector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+  private:
+    template<typename... Args>
+    void ResizeImpl(sizet count, const Args&... args)
+    {
+        checkMsg(count <= N, "StaticVector capacity (%zu) exceeded.", N);
+
+        if (count < m_Size)
+        {
+            std::destroy(begin() + count, end());
+            m_Size = count;
+            return;
+        }
+
+        while (m_Size < count)
+        {
+            std::construct_at(data() + m_Size, args...);
+            ++m_Size;
+        }
+    }
+
+    alignas(T) std::byte m_Storage[sizeof(T) * N];
+
+    sizet m_Size = 0;
+};
+} // namespace Zn
@@ -1,10 +1,26 @@
 #pragma once
 
 #include <Core/HAL/BasicTypes.h>
+#include <Core/Containers/InlineVector.h>
+#include <Core/InlineDelegate.h>
+#include <algorithm>
 #include <optional>
 
 namespace Zn
 {
+// Identifies a delegate bound to a TMulticastEvent. Default constructed handles are invalid.
+struct DelegateHandle
+{
+    u64 id = 0;
+
+    inline bool IsValid() const
+    {
+        return id != 0;
+    }
+
+    bool operator==(const DelegateHandle&) const = default;
+};
+
 template<typename Signature>
 class TSingleEvent;
 
@@ -12,16 +28,28 @@ template<typename R, typename... Args>
 class TSingleEvent<R(Args...)>
 {
   public:
+    using DelegateType = TInlineDelegate<R(Args...)>;
+
     TSingleEvent() = default;
 
-    TSingleEvent(TDelegate<R(Args...)>&& inDelegate)
-        : delegate(inDelegate)
+    TSingleEvent(DelegateType&& inDelegate)
+        : delegate(std::move(inDelegate))
+    {
+    }
+
+    inline void Bind(DelegateType&& inDelegate)
     {
+        delegate = std::move(inDelegate);
+    }
+
+    inline void Unbind()
+    {
+        delegate.Reset();
     }
 
     inline bool IsBound() const
     {
-        return delegate;
+        return delegate.IsBound();
     }
 
     inline std::optional<R> ExecuteSafe(Args&&... arguments) noexcept
@@ -40,39 +68,189 @@ class TSingleEvent<R(Args...)>
     }
 
   private:
-    TDelegate<R(Args...)> delegate;
+    DelegateType delegate;
 };
 
+// Delegates are stored by value next to each other, so a broadcast walks a single contiguous array.
+// Binding and unbinding from inside a delegate is safe: unbound delegates are skipped and compacted once the
+// outermost Broadcast returns, delegates bound during a broadcast are only called from the next one.
 template<typename... Args>
 class TMulticastEvent
 {
   public:
+    using DelegateType = TInlineDelegate<void(Args...)>;
+
     TMulticastEvent() = default;
 
-    inline void Bind(TDelegate<void(Args...)>&& inDelegate)
+    TMulticastEvent(const TMulticastEvent&)            = delete;
+    TMulticastEvent& operator=(const TMulticastEvent&) = delete;
+
+    inline DelegateHandle Bind(DelegateType&& inDelegate)
+    {
+        if (!inDelegate)
+        {
+            return DelegateHandle {};
+        }
+
+        const DelegateHandle handle {++lastHandleId};
+
+        if (IsBroadcasting())
+        {
+            pendingDelegates.push_back(Entry {std::move(inDelegate), handle});
+        }
+        else
+        {
+            delegates.push_back(Entry {std::move(inDelegate), handle});
+        }
+
+        return handle;
+    }
+
+    inline bool Unbind(DelegateHandle handle)
     {
-        if (inDelegate)
+        if (!handle.IsValid())
+        {
+            return false;
+        }
+
+        if (UnbindFrom(pendingDelegates, handle))
         {
-            delegates.push_back(std::move(inDelegate));
+            return true;
         }
+
+        return UnbindFrom(delegates, handle);
     }
 
-    inline void Broadcast(Args&&... arguments) const
+    // Arguments are passed to every delegate as lvalues, so none of them can move from an argument the next one needs.
+    template<typename... TArgs>
+    inline void Broadcast(TArgs&&... arguments)
     {
-        for (const TDelegate<void(Args...)>& delegate : delegates)
+        ++broadcastDepth;
+
+        const sizet count = delegates.size();
+
+        for (sizet index = 0; index < count; ++index)
         {
-            check(delegate);
+            const Entry& entry = delegates[index];
+
+            if (entry.handle.IsValid())
+            {
+                check(entry.delegate);
 
-            delegate(std::forward<Args>(arguments)...);
+                entry.delegate(arguments...);
+            }
+        }
+
+        if (--broadcastDepth == 0)
+        {
+            FlushDeferredChanges();
         }
     }
 
+    inline bool IsBound() const
+    {
+        return std::any_of(delegates.begin(),
+                           delegates.end(),
+                           [](const Entry& entry)
+                           {
+                               return entry.handle.IsValid();
+                           }) ||
+               !pendingDelegates.empty();
+    }
+
     inline void Reset()
     {
-        delegates.clear();
+        pendingDelegates.clear();
+
+        if (IsBroadcasting())
+        {
+            for (Entry& entry : delegates)
+            {
+                entry.handle = DelegateHandle {};
+            }
+
+            hasUnboundDelegates = !delegates.empty();
+        }
+        else
+        {
+            delegates.clear();
+        }
     }
 
   private:
-    Vector<TDelegate<void(Args...)>> delegates;
+    struct Entry
+    {
+        DelegateType   delegate;
+        DelegateHandle handle;
+    };
+
+    using EntryList = InlineVector<Entry, 4>;
+
+    inline bool IsBroadcasting() const
+    {
+        return broadcastDepth > 0;
+    }
+
+    template<typename TEntryList>
+    inline bool UnbindFrom(TEntryList& entries, DelegateHandle handle)
+    {
+        auto it = std::find_if(entries.begin(),
+                               entries.end(),
+                               [handle](const Entry& entry)
+                               {
+                                   return entry.handle == handle;
+                               });
+
+        if (it == entries.end())
+        {
+            return false;
+        }
+
+        // The delegate might be the one currently executing, destroying it is deferred to the end of the broadcast.
+        if (std::is_same_v<TEntryList, EntryList> && IsBroadcasting())
+        {
+            it->handle          = DelegateHandle {};
+            hasUnboundDelegates = true;
+        }
+        else
+        {
+            entries.erase(it);
+        }
+
+        return true;
+    }
+
+    inline void FlushDeferredChanges()
+    {
+        if (hasUnboundDelegates)
+        {
+            auto newEnd = std::remove_if(delegates.begin(),
+                                         delegates.end(),
+                                         [](const Entry& entry)
+                                         {
+                                             return !entry.handle.IsValid();
+                                         });
+
+            delegates.erase(newEnd, delegates.end());
+
+            hasUnboundDelegates = false;
+        }
+
+        for (Entry& entry : pendingDelegates)
+        {
+            delegates.push_back(std::move(entry));
+        }
+
+        pendingDelegates.clear();
+    }
+
+    EntryList delegates;
+
+    // Delegates bound while broadcasting, appended to delegates once the broadcast ends.
+    InlineVector<Entry, 1> pendingDelegates;
+
+    u64  lastHandleId        = 0;
+    u32  broadcastDepth      = 0;
+    bool hasUnboundDelegates = false;
 };
 } // namespace Zn
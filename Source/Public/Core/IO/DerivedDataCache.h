@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Core/Containers/FlatMap.h>
+#include <Core/IO/MappedFile.h>
+#include <mutex>
+#include <span>
+
+namespace Zn
+{
+// On-disk cache of data derived from assets (cooked meshes, decoded textures...).
+// Entries are content addressed: the key is a hash of everything the data was derived from (source bytes, importer version,
+// import options), so a stale entry is never hit and there is nothing to invalidate.
+// Once the cache grows past its size cap, the least recently used entries are evicted.
+class DerivedDataCache
+{
+  public:
+    // Shared cache under <root>/DerivedDataCache. -ddcsize=<MiB> overrides the size cap, -noddc disables it.
+    static DerivedDataCache& Get();
+
+    // Picks up the entries already on disk, ordered by their last access from previous runs. A zero size cap disables the cache.
+    DerivedDataCache(String directory, u64 maxSize);
+
+    DerivedDataCache(const DerivedDataCache&)            = delete;
+    DerivedDataCache& operator=(const DerivedDataCache&) = delete;
+
+    // Maps the entry, the result is invalid on a miss.
+    MappedFile Load(u64 key);
+
+    bool Store(u64 key, std::span<const u8> data);
+
+    // Writes the parts back to back as a single entry, for data that doesn't sit in one buffer (a header and a payload).
+    bool Store(u64 key, std::span<const std::span<const u8>> parts);
+
+    bool Contains(u64 key) const;
+
+    bool IsEnabled() const
+    {
+        return m_bEnabled;
+    }
+
+    u64 GetSize() const;
+
+    u64 GetMaxSize() const
+    {
+        return m_MaxSize;
+    }
+
+    static constexpr u64 kDefaultMaxSize = 2048ull * 1024 * 1024;
+
+  private:
+    struct Entry
+    {
+        u64 size       = 0;
+        u64 lastAccess = 0;
+    };
+
+    String GetEntryPath(u64 key) const;
+
+    void Touch(u64 key, Entry& entry);
+
+    void EvictLeastRecentlyUsed();
+
+    String m_Directory;
+    u64    m_MaxSize           = 0;
+    u64    m_Size              = 0;
+    u64    m_AccessCounter     = 0;
+    u64    m_NumTemporaryFiles = 0;
+    bool   m_bEnabled          = false;
+
+    mutable std::mutex  m_Mutex;
+    FlatMap<u64, Entry> m_Entries;
+};
+} // namespace Zn
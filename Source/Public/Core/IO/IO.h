@@ -1,15 +1,53 @@
 #pragma once
 
+#include <Core/Async/ThreadPool.h>
+#include <Core/IO/MappedFile.h>
+#include <future>
+
 namespace Zn
 {
+// The file is mapped and its pages are read in on the IO thread, the view is resident once delivered and its content is never copied.
+struct IOReadResult
+{
+    String     filename;
+    MappedFile file;
+    bool       success = false;
+};
+
+// Invoked on an IO thread once the read completes, successfully or not.
+using IOReadCallback = std::function<void(IOReadResult&&)>;
+
 class IO
 {
   public:
     static void Initialize();
 
+    static void Shutdown();
+
     static bool ReadBinaryFile(const String& InFilename, Vector<uint8>& OutData);
 
-    static bool ReadTextFile(const String& InFilename, Vector<const char*>& OutData);
+    static bool ReadTextFile(const String& InFilename, String& OutData);
+
+    // Maps the file read-only instead of copying it. Check IsValid() on the result.
+    static MappedFile MapFile(const String& InFilename, EFileAccessPattern InAccessPattern = EFileAccessPattern::Sequential);
+
+    // == Async ==
+    // Reads are queued on dedicated IO threads, so loads overlap with each other and with the caller.
+    // Higher priority reads are served first, reads with the same priority in submission order.
+
+    static std::future<IOReadResult> ReadBinaryFileAsync(const String& InFilename, ETaskPriority InPriority = ETaskPriority::Normal);
+
+    static void ReadBinaryFileAsync(const String&    InFilename,
+                                    IOReadCallback&& InCallback,
+                                    ETaskPriority    InPriority = ETaskPriority::Normal);
+
+    // Queues all the reads as a single batch. Results are returned in the same order as InFilenames.
+    static Vector<std::future<IOReadResult>> ReadBinaryFilesAsync(const Vector<String>& InFilenames,
+                                                                  ETaskPriority         InPriority = ETaskPriority::Normal);
+
+    static void ReadBinaryFilesAsync(const Vector<String>& InFilenames,
+                                     IOReadCallback        InCallback,
+                                     ETaskPriority         InPriority = ETaskPriority::Normal);
 
     static String GetAbsolutePath(const String& InFilename);
 
@@ -0,0 +1,73 @@
+#pragma once
+#include "Core/HAL/BasicTypes.h"
+#include <span>
+
+namespace Zn
+{
+// How a mapped file is going to be read, forwarded to the OS to tune read-ahead.
+enum class EFileAccessPattern : uint8
+{
+    Normal,
+    Sequential,
+    Random
+};
+
+// Read-only view of a whole file mapped in memory, unmapped on destruction.
+// Pages are served straight from the OS page cache, so the file content is never copied into a user buffer.
+class MappedFile
+{
+  public:
+    MappedFile() = default;
+
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // An empty file is a valid mapping with no data.
+    bool IsValid() const
+    {
+        return m_bMapped;
+    }
+
+    explicit operator bool() const
+    {
+        return m_bMapped;
+    }
+
+    const uint8* GetData() const
+    {
+        return m_Data;
+    }
+
+    sizet GetSize() const
+    {
+        return m_Size;
+    }
+
+    std::span<const uint8> GetView() const
+    {
+        return {m_Data, m_Size};
+    }
+
+    // Starts paging in the range ahead of access, without waiting for it.
+    void Prefetch(sizet offset, sizet size) const;
+
+    void Prefetch() const
+    {
+        Prefetch(0, m_Size);
+    }
+
+    void Reset();
+
+  private:
+    friend class IO;
+
+    const uint8* m_Data    = nullptr;
+    sizet        m_Size    = 0;
+    bool         m_bMapped = false;
+};
+} // namespace Zn
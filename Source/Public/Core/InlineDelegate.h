@@ -0,0 +1,183 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Zn
+{
+// Owning, move-only callable wrapper that stores the callable (lambda captures included) inside the object.
+// It never allocates: callables that do not fit in kInlineSize bytes are rejected at compile time.
+template<typename Signature, sizet kInlineSize = 4 * sizeof(void*)>
+class TInlineDelegate;
+
+template<typename R, typename... Args, sizet kInlineSize>
+class TInlineDelegate<R(Args...), kInlineSize>
+{
+    template<typename TDecayed>
+    static constexpr bool kIsCompatibleCallable =
+        !std::is_same_v<TDecayed, TInlineDelegate> && std::is_invocable_r_v<R, TDecayed&, Args...>;
+
+  public:
+    static constexpr sizet kInlineAlignment = alignof(std::max_align_t);
+
+    TInlineDelegate() = default;
+
+    TInlineDelegate(std::nullptr_t)
+    {
+    }
+
+    template<typename TCallable,
+             typename TDecayed = std::decay_t<TCallable>,
+             typename          = std::enable_if_t<kIsCompatibleCallable<TDecayed>>>
+    TInlineDelegate(TCallable&& callable)
+    {
+        static_assert(sizeof(TDecayed) <= kInlineSize,
+                      "Callable does not fit in the delegate inline storage, capture less or raise kInlineSize.");
+        static_assert(alignof(TDecayed) <= kInlineAlignment, "Callable is over-aligned for the delegate inline storage.");
+        static_assert(std::is_nothrow_move_constructible_v<TDecayed>, "Callable must be nothrow move constructible.");
+
+        // Null function pointers and unbound TDelegate/std::function leave the delegate unbound.
+        if constexpr (std::is_constructible_v<bool, const TDecayed&>)
+        {
+            if (!static_cast<bool>(callable))
+            {
+                return;
+            }
+        }
+
+        ::new (static_cast<void*>(m_Storage)) TDecayed(std::forward<TCallable>(callable));
+
+        m_Invoke = &Invoke<TDecayed>;
+
+        if constexpr (!std::is_trivially_copyable_v<TDecayed> || !std::is_trivially_destructible_v<TDecayed>)
+        {
+            m_Manage = &Manage<TDecayed>;
+        }
+    }
+
+    // Binds a member function to an instance. The delegate does not own the instance.
+    template<auto Method, typename T>
+    static TInlineDelegate Create(T* instance)
+    {
+        return TInlineDelegate(
+            [instance](Args... arguments) -> R
+            {
+                return std::invoke(Method, instance, std::forward<Args>(arguments)...);
+            });
+    }
+
+    TInlineDelegate(TInlineDelegate&& other) noexcept
+    {
+        MoveFrom(other);
+    }
+
+    TInlineDelegate& operator=(TInlineDelegate&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            MoveFrom(other);
+        }
+
+        return *this;
+    }
+
+    TInlineDelegate& operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    TInlineDelegate(const TInlineDelegate&)            = delete;
+    TInlineDelegate& operator=(const TInlineDelegate&) = delete;
+
+    ~TInlineDelegate()
+    {
+        Reset();
+    }
+
+    bool IsBound() const
+    {
+        return m_Invoke != nullptr;
+    }
+
+    explicit operator bool() const
+    {
+        return IsBound();
+    }
+
+    R operator()(Args... arguments) const
+    {
+        check(IsBound());
+        return m_Invoke(const_cast<std::byte*>(m_Storage), std::forward<Args>(arguments)...);
+    }
+
+    void Reset()
+    {
+        if (m_Manage)
+        {
+            m_Manage(EOperation::Destroy, m_Storage, nullptr);
+        }
+
+        m_Invoke = nullptr;
+        m_Manage = nullptr;
+    }
+
+  private:
+    enum class EOperation : u8
+    {
+        Move,
+        Destroy
+    };
+
+    using InvokeFn = R (*)(void*, Args...);
+    using ManageFn = void (*)(EOperation, void*, void*);
+
+    template<typename TCallable>
+    static R Invoke(void* storage, Args... arguments)
+    {
+        return std::invoke(*static_cast<TCallable*>(storage), std::forward<Args>(arguments)...);
+    }
+
+    template<typename TCallable>
+    static void Manage(EOperation operation, void* destination, void* source)
+    {
+        switch (operation)
+        {
+        case EOperation::Move:
+            ::new (destination) TCallable(std::move(*static_cast<TCallable*>(source)));
+            static_cast<TCallable*>(source)->~TCallable();
+            break;
+        case EOperation::Destroy:
+            static_cast<TCallable*>(destination)->~TCallable();
+            break;
+        }
+    }
+
+    void MoveFrom(TInlineDelegate& other)
+    {
+        if (other.m_Manage)
+        {
+            other.m_Manage(EOperation::Move, m_Storage, other.m_Storage);
+        }
+        else if (other.m_Invoke)
+        {
+            std::memcpy(m_Storage, other.m_Storage, kInlineSize);
+        }
+
+        m_Invoke = std::exchange(other.m_Invoke, nullptr);
+        m_Manage = std::exchange(other.m_Manage, nullptr);
+    }
+
+    // Trivially copyable callables (function pointers, reference-only captures) have no manager and are moved with memcpy.
+    InvokeFn m_Invoke = nullptr;
+    ManageFn m_Manage = nullptr;
+
+    alignas(kInlineAlignment) std::byte m_Storage[kInlineSize];
+};
+} // namespace Zn
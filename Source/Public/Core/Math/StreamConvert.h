@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+
+#if defined(__AVX2__)
+    #define ZN_STREAM_CONVERT_AVX2 1
+#else
+    #define ZN_STREAM_CONVERT_AVX2 0
+#endif
+
+#if ZN_STREAM_CONVERT_AVX2 || defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ZN_STREAM_CONVERT_SSE2 1
+#else
+    #define ZN_STREAM_CONVERT_SSE2 0
+#endif
+
+namespace Zn
+{
+// Bulk conversions of tightly packed vertex and index streams, as found in source assets.
+// The widest instruction set enabled at compile time is used (AVX2, then SSE2), with a scalar fallback.
+// Sources and destinations don't need any particular alignment and must not overlap.
+class StreamConvert
+{
+  public:
+    // Zero extends count indices.
+    static void WidenIndices(const u8* src, sizet count, u32* dst);
+    static void WidenIndices(const u16* src, sizet count, u32* dst);
+
+    // Converts count elements of srcComponents integer components to floats: dst = src * scale + bias, per component.
+    // Supported layouts are srcComponents == dstComponents in {1, 2, 4}, and 3 to 4. Components missing from the source read
+    // as zero, so an expanded w component is set to bias.w.
+    static void Dequantize(const u8*        src,
+                           sizet            count,
+                           u32              srcComponents,
+                           u32              dstComponents,
+                           const glm::vec4& scale,
+                           const glm::vec4& bias,
+                           f32*             dst);
+
+    static void Dequantize(const u16*       src,
+                           sizet            count,
+                           u32              srcComponents,
+                           u32              dstComponents,
+                           const glm::vec4& scale,
+                           const glm::vec4& bias,
+                           f32*             dst);
+
+    // Appends w to every vec3.
+    static void ExpandVec3(const glm::vec3* src, sizet count, f32 w, glm::vec4* dst);
+};
+} // namespace Zn
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <Core/Containers/Set.h>
+#include <Core/Containers/FlatSet.h>
 #include <Core/Memory/Memory.h>
 
 namespace Zn
@@ -42,6 +42,6 @@ class TrackedMalloc : public BaseAllocator
     virtual bool Free(void* ptr) override;
 
   private:
-    UnorderedSet<void*> allocations;
+    FlatSet<void*> allocations;
 };
 } // namespace Zn
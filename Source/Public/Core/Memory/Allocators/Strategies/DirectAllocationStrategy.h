@@ -1,6 +1,6 @@
 #pragma once
 #include "Core/HAL/BasicTypes.h"
-#include "Core/Containers/Set.h"
+#include "Core/Containers/FlatSet.h"
 #include <functional>
 
 namespace Zn
@@ -17,6 +17,6 @@ class DirectAllocationStrategy
   private:
     size_t m_MinAllocationSize;
 
-    UnorderedSet<void*> m_Allocations;
+    FlatSet<void*> m_Allocations;
 };
 } // namespace Zn
\ No newline at end of file
@@ -87,6 +87,9 @@ using GPUTraceContextPtr = TracyVkCtx;
     // Adds info to current capture
     #define ZN_TRACE_INFO(info)          TracyAppInfo(info, Zn::Trace::TStringLength(info))
 
+    // Plots a value per frame, name must be a string literal.
+    #define ZN_TRACE_PLOT(name, value)   TracyPlot(name, value)
+
     ///// FRAME /////
     #define ZN_END_FRAME()               FrameMark
 
@@ -116,6 +119,7 @@ __forceinline void ZN_TRACE_GPU_CONTEXT_DESTROY(GPUTraceContextPtr context)
     #define ZN_MEMTRACE_ALLOC(ptr, size)
     #define ZN_MEMTRACE_FREE(size)
     #define ZN_TRACE_INFO(info)
+    #define ZN_TRACE_PLOT(name, value)
     #define ZN_END_FRAME()
     #define ZN_TRACE_GPU_SCOPE(...)
     #define ZN_TRACE_GPU_COLLECT(...)
@@ -1,5 +1,8 @@
 #pragma once
 #include <Core/HAL/BasicTypes.h>
+#include <Core/Event.h>
+
+union SDL_Event;
 
 namespace Zn
 {
@@ -23,6 +26,8 @@ class Engine
 
     void ProcessInput();
 
+    void OnInputEvent(const SDL_Event& event, f32 deltaTime);
+
     bool PumpMessages();
 
     float m_DeltaTime {0.f};
@@ -32,5 +37,7 @@ class Engine
     SharedPtr<Camera> activeCamera;
 
     SharedPtr<EngineFrontend> m_FrontEnd;
+
+    DelegateHandle inputEventHandle;
 };
 } // namespace Zn
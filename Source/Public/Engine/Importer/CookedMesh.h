@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Core/IO/MappedFile.h>
+#include <Engine/Importer/TextureImporter.h>
+#include <Rendering/RHI/RHIMesh.h>
+
+namespace Zn
+{
+struct MeshImporterOutput;
+
+// Texture referenced by a cooked mesh, stored as the path of its source image relative to the mesh.
+struct CookedMeshTexture
+{
+    String                uri;
+    TextureSampler        sampler;
+    TextureImportSettings settings;
+};
+
+// Binary mesh produced from a MeshImporterOutput, so loading doesn't go through the source format anymore.
+// Layout: header, primitive table, material table, texture table, then every vertex, index and level of detail stream aligned to
+// kStreamAlignment.
+// Loading maps the file and the primitive views point straight into the mapping, they are valid as long as the CookedMesh lives.
+class CookedMesh
+{
+  public:
+    static constexpr u32 kMagic = 0x48534D5A; // ZMSH
+
+    // Bump whenever the layout of the blob or of any struct written in it changes.
+    static constexpr u32 kVersion = 4;
+
+    static constexpr sizet kStreamAlignment = 16;
+
+    // Fails for textures that are not backed by a file (embedded or data uri), since the blob only references them.
+    static bool Cook(const MeshImporterOutput& output, Vector<u8>& outBlob);
+
+    // Takes ownership of the mapping on success.
+    static bool Load(MappedFile&& file, CookedMesh& outMesh);
+
+    static bool Load(const String& fileName, CookedMesh& outMesh);
+
+    const Vector<RHIPrimitiveView>& GetPrimitives() const
+    {
+        return primitives;
+    }
+
+    const Vector<CookedMeshTexture>& GetTextures() const
+    {
+        return textures;
+    }
+
+  private:
+    MappedFile                file;
+    Vector<RHIPrimitiveView>  primitives;
+    Vector<CookedMeshTexture> textures;
+};
+} // namespace Zn
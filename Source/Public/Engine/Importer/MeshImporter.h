@@ -6,16 +6,20 @@ DECLARE_LOG_CATEGORY(LogMeshImporter);
 
 namespace Zn
 {
+class CookedMesh;
+class MappedFile;
 struct RHIMesh;
 struct RHIPrimitive;
 struct TextureSource;
 struct TextureSampler;
+struct TextureImportSettings;
 
 struct MeshImporterOutput
 {
     Vector<RHIPrimitive>                           primitives;
     UnorderedMap<String, SharedPtr<TextureSource>> textures;
     UnorderedMap<String, TextureSampler>           samplers;
+    UnorderedMap<String, TextureImportSettings>    textureSettings;
 };
 
 class MeshImporter
@@ -24,9 +28,24 @@ class MeshImporter
     static bool Import(const String& fileName, RHIMesh& mesh);
     static bool ImportAll(const String& fileName, MeshImporterOutput& output);
 
+    // Bump whenever the importers output changes for the same source, so that cached cooked meshes are not reused.
+    static constexpr u32 kImporterVersion = 6;
+
+    // Loads the cooked mesh from the derived data cache, importing and cooking the source on a miss.
+    // Returns false if the source can't be imported or can't be cooked, ImportAll has to be used instead.
+    static bool ImportCooked(const String& fileName, CookedMesh& outMesh);
+
+    // Key of the cooked mesh in the derived data cache. Hashes the source file along with the external buffers it references,
+    // an edit to any of them yields a new key.
+    static bool CalculateCookedKey(const String& fileName, u64& outKey);
+
   private:
     static bool Import_Obj(const String& fileName, RHIMesh& mesh);
 
     static bool ImportAll_GLTF(const String& fileName, MeshImporterOutput& mesh);
+
+    // Uris of the buffers stored in their own files, relative to the source. Embedded (data:) buffers and the .glb BIN chunk are
+    // part of the source bytes and are skipped.
+    static bool GetBufferUris_GLTF(const MappedFile& source, Vector<String>& outUris);
 };
 } // namespace Zn
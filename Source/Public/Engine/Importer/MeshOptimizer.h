@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <span>
+
+namespace Zn
+{
+struct RHIPrimitive;
+
+// Post-transform cache efficiency of an index buffer, measured by simulating a FIFO cache of kCacheSize entries.
+// Counts rather than ratios, so that statistics of several primitives can be summed.
+struct VertexCacheStatistics
+{
+    static constexpr u32 kCacheSize = 16;
+
+    u64 numTransformedVertices = 0;
+    u64 numTriangles           = 0;
+    u64 numVertices            = 0;
+
+    // Average cache miss ratio: vertices transformed per triangle, 0.5 at best for large regular meshes, 3 at worst.
+    f32 GetACMR() const
+    {
+        return numTriangles > 0 ? static_cast<f32>(numTransformedVertices) / numTriangles : 0.f;
+    }
+
+    // Average transform to vertex ratio: how many times each vertex is transformed, 1 at best.
+    f32 GetATVR() const
+    {
+        return numVertices > 0 ? static_cast<f32>(numTransformedVertices) / numVertices : 0.f;
+    }
+
+    VertexCacheStatistics& operator+=(const VertexCacheStatistics& other);
+};
+
+// Reorders the triangles and vertices of imported primitives so that the GPU does less work per draw, without changing what is
+// rendered. Only indexed or non indexed triangle lists are processed, other topologies are left untouched.
+class MeshOptimizer
+{
+  public:
+    // Runs every stage in order: welding, vertex cache, overdraw, then vertex fetch. Non indexed primitives get an index buffer.
+    // Statistics are measured on the index buffer before and after, they stay empty if the primitive is not processed.
+    static void Optimize(RHIPrimitive& primitive, VertexCacheStatistics* outBefore = nullptr, VertexCacheStatistics* outAfter = nullptr);
+
+    // Points the indices of bitwise identical vertices, across all the streams, to the first of them.
+    // Unreferenced vertices are left in place, OptimizeVertexFetch drops them.
+    static void WeldVertices(RHIPrimitive& primitive);
+
+    // Orders the triangles to maximize post-transform cache hits (Tom Forsyth's linear-speed vertex cache optimization).
+    static void OptimizeVertexCache(std::span<u32> indices, sizet numVertices);
+
+    // Splits the cache-optimized triangles into clusters, and draws clusters facing outward from the mesh center first to
+    // reduce overdraw. Clusters are cut where the cache restarts anyway, or where the ACMR since the last cut is within threshold
+    // times the one of the enclosing cluster, which bounds how much vertex cache efficiency is traded for overdraw.
+    static void OptimizeOverdraw(std::span<u32> indices, std::span<const glm::vec3> positions, f32 threshold = 1.05f);
+
+    // Orders the vertices by first use in the index buffer, for linear memory access when fetching, and drops unreferenced ones.
+    static void OptimizeVertexFetch(RHIPrimitive& primitive);
+
+    static VertexCacheStatistics AnalyzeVertexCache(std::span<const u32> indices, sizet numVertices);
+};
+} // namespace Zn
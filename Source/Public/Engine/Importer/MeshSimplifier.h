@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <span>
+
+namespace Zn
+{
+struct RHIPrimitive;
+
+// Import-time level of detail generation, by edge collapses ordered by quadric error (Garland and Heckbert).
+// Vertices are only ever collapsed onto other existing vertices, so every level of detail is an index buffer over the vertices of
+// the original primitive. Open borders only collapse along themselves, and vertices on attribute seams don't move.
+class MeshSimplifier
+{
+  public:
+    // Coarser levels of detail generated per primitive, each one targeting half the triangles of the previous one.
+    static constexpr u32 kMaxLODs = 4;
+
+    // Relative to the largest extent of the primitive.
+    static constexpr f32 kMaxLODError = 0.05f;
+
+    // Fills primitive.lods and primitive.lodIndices, each level is optimized for the vertex cache.
+    // Stops early when a level would not remove at least a quarter of the triangles of the previous one.
+    static void GenerateLODs(RHIPrimitive& primitive);
+
+    // Collapses edges until at most targetNumIndices are left, or until the next collapse would exceed maxError.
+    // Errors are distances relative to the largest extent of the positions, outError receives the one of the result.
+    static Vector<u32> Simplify(std::span<const u32>       indices,
+                                std::span<const glm::vec3> positions,
+                                sizet                      targetNumIndices,
+                                f32                        maxError,
+                                f32*                       outError = nullptr);
+};
+} // namespace Zn
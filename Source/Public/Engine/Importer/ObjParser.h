@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Core/Hash.h>
+#include <span>
+
+namespace Zn
+{
+// Corner of an OBJ face, 0 based indices into the attributes of ObjData.
+struct ObjIndex
+{
+    static constexpr u32 kNone = u32_max;
+
+    u32 position = kNone;
+    u32 texcoord = kNone;
+    u32 normal   = kNone;
+
+    bool operator==(const ObjIndex&) const = default;
+};
+
+struct ObjIndexHash
+{
+    u64 operator()(const ObjIndex& index) const
+    {
+        return HashCombine((static_cast<u64>(index.position) << 32) | index.texcoord, index.normal);
+    }
+};
+
+struct ObjData
+{
+    Vector<glm::vec3> positions;
+    Vector<glm::vec2> texcoords;
+    Vector<glm::vec3> normals;
+
+    // Faces are triangulated as fans, every 3 corners are a triangle.
+    Vector<ObjIndex> corners;
+};
+
+// Parser for the geometry of Wavefront OBJ text, materials, groups and smoothing groups are ignored.
+// The text is split in chunks at line boundaries, parsed in parallel on the worker pool. A first pass counts the attributes of
+// every chunk, so that the second one writes them straight to their final place and resolves relative indices on its own.
+class ObjParser
+{
+  public:
+    static constexpr sizet kDefaultChunkSize = 1 << 20;
+
+    static bool Parse(std::span<const char> text, ObjData& outData, sizet chunkSize = kDefaultChunkSize);
+};
+} // namespace Zn
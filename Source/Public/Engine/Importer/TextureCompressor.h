@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Engine/Importer/TextureImporter.h>
+#include <span>
+
+namespace Zn
+{
+// Encodes RGBA8 mip chains to 4x4 blocks, split in rows of blocks on the worker pool.
+// Endpoints are fit along the principal axis of the block colors, then refined by least squares on the chosen indices.
+// BC7 blocks are always written in mode 6 (a single subset of RGBA endpoints with 16 interpolation steps).
+class TextureCompressor
+{
+  public:
+    static constexpr u32 kBlockDimension = 4;
+
+    // Bytes of a 4x4 block, 0 for uncompressed textures.
+    static u32 GetBlockSize(TextureCompression compression);
+
+    // Size in bytes of a level, compressed levels are padded to whole blocks.
+    static sizet CalculateLevelSize(TextureCompression compression, u32 width, u32 height);
+
+    // Size in bytes of the first numMips levels, tightly packed from the largest.
+    static sizet CalculateMipChainSize(TextureCompression compression, u32 width, u32 height, u32 numMips);
+
+    // pixels holds numMips RGBA8 levels, tightly packed from the largest. Returns the blocks of every level.
+    static Vector<u8> Compress(std::span<const u8> pixels, u32 width, u32 height, u32 numMips, TextureCompression compression);
+
+    // Same as above, writing the blocks to outBlocks which holds at least CalculateMipChainSize bytes. outBlocks is only written to.
+    static void Compress(
+        std::span<const u8> pixels, u32 width, u32 height, u32 numMips, TextureCompression compression, std::span<u8> outBlocks);
+
+    // Decodes blocks written by Compress back to RGBA8 levels, for devices that can't sample them.
+    static Vector<u8> Decompress(std::span<const u8> blocks, u32 width, u32 height, u32 numMips, TextureCompression compression);
+
+    // texels are the 16 RGBA8 texels of the block, in rows.
+    static void EncodeBlock(TextureCompression compression, const u8* texels, u8* outBlock);
+
+    // Only BC7 mode 6 blocks are decoded, other modes decode to zero.
+    static void DecodeBlock(TextureCompression compression, const u8* block, u8* outTexels);
+};
+} // namespace Zn
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Engine/Importer/TextureImporter.h>
+#include <span>
+
+namespace Zn
+{
+// Imports a batch of textures on the worker pool, each straight into memory handed out by the caller (a staging buffer).
+// Textures start in the order they were added, as long as the textures in flight leave room for them in the memory budget. A
+// texture counts its decoded RGBA8 mips and its destination against the budget; one larger than the whole budget is imported
+// alone.
+class TextureImportQueue
+{
+  public:
+    // Returns the destination of the texture, GetDescription().size bytes that stay valid until complete is called for it.
+    using AllocateFunction = std::function<std::span<u8>(sizet index, const TextureDescription& description)>;
+
+    using CompleteFunction = std::function<void(sizet index, const TextureDescription& description, bool bSucceeded)>;
+
+    // 256 MiB, -textureImportBudget=<MiB> overrides it.
+    static sizet GetDefaultBudget();
+
+    explicit TextureImportQueue(sizet budget = GetDefaultBudget());
+
+    // Returns the index passed to the callbacks.
+    sizet Add(const String& path, const TextureImportSettings& settings = {});
+
+    // Imports every texture added, returns once all of them completed. allocate and complete run on the calling thread, which helps
+    // the workers while it waits. Textures that can't be opened are completed right away, without a destination.
+    // Returns false if any of them failed.
+    bool Run(const AllocateFunction& allocate, const CompleteFunction& complete);
+
+    // Highest number of bytes in flight during the last Run.
+    sizet GetPeakBytesInFlight() const
+    {
+        return peakBytesInFlight;
+    }
+
+  private:
+    struct Request
+    {
+        String                path;
+        TextureImportSettings settings;
+        TextureImportJob      job;
+        bool                  bOpened = false;
+    };
+
+    sizet GetCost(const TextureDescription& description) const;
+
+    sizet           budget            = 0;
+    sizet           peakBytesInFlight = 0;
+    Vector<Request> requests;
+};
+} // namespace Zn
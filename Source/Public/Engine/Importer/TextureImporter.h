@@ -1,25 +1,189 @@
 #pragma once
 
 #include <Core/HAL/BasicTypes.h>
+#include <Core/IO/MappedFile.h>
+#include <span>
 
 namespace Zn
 {
+// Block compressed formats of 4x4 texels. Each format suits different textures:
+// - BC1 (8 bytes): opaque color.
+// - BC3 (16 bytes): color with alpha.
+// - BC5 (16 bytes): two channels, the xy of normal maps.
+// - BC7 (16 bytes): high quality color and alpha.
+enum class TextureCompression : u8
+{
+    None,
+    BC1,
+    BC3,
+    BC5,
+    BC7,
+    COUNT
+};
+
+// What a material samples a texture for, picks its compression.
+enum class TextureUsage : u8
+{
+    Color,
+    ColorAlpha,
+    Normal,
+    Linear,
+    COUNT
+};
+
+// Pixels of a TextureSource. Move only, so that decoded texels are handed over rather than copied: it adopts the vector filled by a
+// decoder (tinygltf images) or a block allocated by one along with the function that frees it (stb_image).
+class TextureBuffer
+{
+  public:
+    using Deleter = void (*)(void*);
+
+    TextureBuffer() = default;
+
+    explicit TextureBuffer(Vector<u8>&& data_);
+
+    TextureBuffer(u8* data_, sizet size_, Deleter deleter_);
+
+    // Left uninitialized, the caller writes every byte.
+    static TextureBuffer Allocate(sizet size);
+
+    ~TextureBuffer();
+
+    TextureBuffer(TextureBuffer&& other) noexcept;
+    TextureBuffer& operator=(TextureBuffer&& other) noexcept;
+
+    TextureBuffer(const TextureBuffer&)            = delete;
+    TextureBuffer& operator=(const TextureBuffer&) = delete;
+
+    u8* GetData()
+    {
+        return data;
+    }
+
+    const u8* GetData() const
+    {
+        return data;
+    }
+
+    sizet GetSize() const
+    {
+        return size;
+    }
+
+    std::span<u8> GetView()
+    {
+        return {data, size};
+    }
+
+    std::span<const u8> GetView() const
+    {
+        return {data, size};
+    }
+
+    void Reset();
+
+  private:
+    Vector<u8> vector;
+    u8*        data    = nullptr;
+    sizet      size    = 0;
+    Deleter    deleter = nullptr;
+};
+
 struct TextureSource
 {
-    const i32  width;
-    const i32  height;
-    const i32  channels;
-    Vector<u8> data;
+    const i32 width;
+    const i32 height;
+    const i32 channels;
+
+    // Every mip level tightly packed from the largest, RGBA8 texels or 4x4 blocks of the compression format.
+    TextureBuffer      data;
+    u32                numMips     = 1;
+    TextureCompression compression = TextureCompression::None;
+};
+
+// How materials sample a texture, decides how its mips are built. Written as is in cooked meshes, hence the explicit padding.
+struct TextureImportSettings
+{
+    f32 alphaCutoff = 0.5f;
+
+    // Color textures (base color, emissive) are filtered in linear space.
+    bool bSRGB = false;
+
+    // Alpha tested textures keep the alpha coverage of level 0 on every mip, so that they don't thin out with distance.
+    bool bPreserveAlphaCoverage = false;
+
+    TextureCompression compression = TextureCompression::None;
+
+    u8 padding = 0;
+
+    bool operator==(const TextureImportSettings&) const = default;
+};
+
+// Size and layout of an imported texture, known before its texels are decoded.
+struct TextureDescription
+{
+    i32                width       = 0;
+    i32                height      = 0;
+    i32                channels    = 0;
+    u32                numMips     = 1;
+    TextureCompression compression = TextureCompression::None;
+
+    // Bytes of every mip level, tightly packed from the largest.
+    sizet size = 0;
 };
 
 class TextureImporter
 {
   public:
-    static SharedPtr<TextureSource> Import(const String& path);
+    // Bump whenever the decoded output changes for the same source, so that cached textures are not reused.
+    static constexpr u32 kImporterVersion = 3;
+
+    // Decodes the texture, generates its mips and compresses them. The result is kept in the derived data cache, a hit skips all
+    // of them. See TextureImportJob to import into memory of the caller.
+    static SharedPtr<TextureSource> Import(const String& path, const TextureImportSettings& settings = {});
+
+    // Generates the mips of a texture holding only its level 0. Level 0 is released once copied to the mip chain.
+    static void GenerateMips(TextureSource& texture, const TextureImportSettings& settings);
+
+    // Encodes the RGBA8 mips of a texture to settings.compression.
+    static void Compress(TextureSource& texture, const TextureImportSettings& settings);
+
+    // BC1 for opaque color and linear data, BC3 for color with alpha, BC5 for normals.
+    // -highQualityTextures encodes color to BC7 instead, -noTextureCompression keeps every texture RGBA8.
+    static TextureCompression SelectCompression(TextureUsage usage);
 
   private:
     friend TextureSource;
 
     static void Release(const TextureSource& texture);
 };
+
+// Imports a texture straight into memory owned by the caller, a staging buffer for instance.
+// Open only maps the source and reads its header (or the cached one), so that the destination can be allocated before ImportTo
+// decodes the texels, generates the mips and compresses them.
+class TextureImportJob
+{
+  public:
+    bool Open(const String& path, const TextureImportSettings& settings = {});
+
+    // Takes a source already read, by IO::ReadBinaryFilesAsync for instance.
+    bool Open(MappedFile&& source, const TextureImportSettings& settings = {});
+
+    const TextureDescription& GetDescription() const
+    {
+        return description;
+    }
+
+    // destination holds at least GetDescription().size bytes and is only written to. Jobs can be imported concurrently.
+    bool ImportTo(std::span<u8> destination) const;
+
+  private:
+    TextureImportSettings settings;
+    TextureDescription    description;
+    u64                   key = 0;
+    MappedFile            file;
+
+    // Valid on a cache hit, ImportTo copies from it.
+    MappedFile cachedFile;
+};
 } // namespace Zn
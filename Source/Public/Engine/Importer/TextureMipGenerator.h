@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <algorithm>
+#include <span>
+
+namespace Zn
+{
+struct TextureImportSettings;
+
+// Builds the mip chain of RGBA8 textures, every level down to 1x1.
+// Each texel of a level averages the texels of the previous one it covers (a box filter, with fractional weights on odd sizes),
+// in linear space for sRGB textures. Levels are filtered from the unquantized float result of the previous one, split in rows
+// on the worker pool.
+class TextureMipGenerator
+{
+  public:
+    static u32 CalculateNumMips(u32 width, u32 height);
+
+    static u32 GetMipWidth(u32 width, u32 mip)
+    {
+        return std::max(width >> mip, 1u);
+    }
+
+    static u32 GetMipHeight(u32 height, u32 mip)
+    {
+        return std::max(height >> mip, 1u);
+    }
+
+    // Size in bytes of the first numMips levels of a RGBA8 texture, tightly packed from the largest.
+    static sizet CalculateMipChainSize(u32 width, u32 height, u32 numMips);
+
+    // inOutPixels holds the RGBA8 level 0, the other levels are appended after it. Returns the number of levels.
+    static u32 Generate(Vector<u8>& inOutPixels, u32 width, u32 height, const TextureImportSettings& settings);
+
+    // Same as above with level 0 and the other levels apart. outLevels is only written to; it holds
+    // CalculateMipChainSize(width, height, CalculateNumMips(width, height)) minus the size of level 0.
+    static u32 Generate(std::span<const u8>          level0,
+                        u32                          width,
+                        u32                          height,
+                        const TextureImportSettings& settings,
+                        std::span<u8>                outLevels);
+
+    // Fraction of the texels of a RGBA8 level whose alpha passes alphaCutoff, as alpha testing would.
+    static f32 CalculateAlphaCoverage(std::span<const u8> pixels, f32 alphaCutoff);
+};
+} // namespace Zn
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <span>
+
+namespace Zn
+{
+// Flat node hierarchy computing world matrices from local ones.
+// Nodes are stored by depth as structure of arrays, so every parent comes before its children: world matrices are computed in
+// a single linear pass, and the nodes of a same depth are independent from each other and can be split across the worker pool.
+// Only the subtrees below nodes whose local matrix changed since the last update are recomputed.
+class TransformHierarchy
+{
+  public:
+    static constexpr u32 kNoParent = u32_max;
+
+    TransformHierarchy() = default;
+
+    // parents[node] is the parent of node, kNoParent for roots. Nodes keep their index, the storage order is internal.
+    TransformHierarchy(std::span<const u32> parents, std::span<const glm::mat4> localMatrices);
+
+    sizet GetNumNodes() const
+    {
+        return nodeToSlot.size();
+    }
+
+    void SetLocalMatrix(u32 node, const glm::mat4& localMatrix);
+
+    const glm::mat4& GetLocalMatrix(u32 node) const
+    {
+        return localMatrices[nodeToSlot[node]];
+    }
+
+    // Up to date as of the last Update.
+    const glm::mat4& GetWorldMatrix(u32 node) const
+    {
+        return worldMatrices[nodeToSlot[node]];
+    }
+
+    bool IsDirty() const
+    {
+        return firstDirtyDepth < GetNumDepths();
+    }
+
+    // Recomputes the world matrices of the subtrees below the nodes changed since the last update.
+    void Update();
+
+    // Depths with at least this many nodes are split in batches across the worker pool.
+    static constexpr u32 kParallelBatchSize = 1024;
+
+  private:
+    u32 GetNumDepths() const
+    {
+        return static_cast<u32>(depthOffsets.size() - 1);
+    }
+
+    void UpdateRange(u32 begin, u32 end);
+
+    Vector<u32> nodeToSlot;
+
+    // Indexed by slot.
+    Vector<u32>       parents;
+    Vector<glm::mat4> localMatrices;
+    Vector<glm::mat4> worldMatrices;
+    Vector<u8>        dirty;
+
+    // First slot of every depth, followed by the number of nodes.
+    Vector<u32> depthOffsets = {0};
+
+    u32 firstDirtyDepth = u32_max;
+};
+} // namespace Zn
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+
+namespace Zn
+{
+// Sorting draws by their key groups them by state, the state most expensive to change in the highest bits.
+// From the highest bits: pass (4), pipeline (12), material set (16), mesh (16), depth (16).
+class RHIDrawSortKey
+{
+  public:
+    static constexpr u32 kPassBits     = 4;
+    static constexpr u32 kPipelineBits = 12;
+    static constexpr u32 kMaterialBits = 16;
+    static constexpr u32 kMeshBits     = 16;
+    static constexpr u32 kDepthBits    = 16;
+
+    // Values wider than their field are truncated.
+    static u64 Encode(u32 pass, u32 pipeline, u32 material, u32 mesh, u32 depth);
+
+    // Draws with the same state bits can share a batch.
+    static u64 GetStateBits(u64 key)
+    {
+        return key >> kDepthBits;
+    }
+
+    static u32 GetPass(u64 key);
+    static u32 GetPipeline(u64 key);
+    static u32 GetMaterial(u64 key);
+    static u32 GetMesh(u64 key);
+    static u32 GetDepth(u64 key);
+
+    // Distances outside of [nearClip, farClip] are clamped, the nearest draws sort first.
+    static u32 QuantizeDepth(f32 distance, f32 nearClip, f32 farClip);
+
+    // Stable least significant digit radix sort of keys, values are moved along with their key. The scratch vectors are resized to
+    // the number of keys, reuse them to avoid allocating every frame.
+    // Digits shared by every key are skipped, so keys that only differ in a few fields sort in a few passes.
+    static void Sort(Vector<u64>& keys, Vector<u32>& values, Vector<u64>& scratchKeys, Vector<u32>& scratchValues);
+};
+} // namespace Zn
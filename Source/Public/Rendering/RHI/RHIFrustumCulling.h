@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+
+#if defined(__AVX2__)
+    #define ZN_FRUSTUM_CULLING_AVX2 1
+#else
+    #define ZN_FRUSTUM_CULLING_AVX2 0
+#endif
+
+#if ZN_FRUSTUM_CULLING_AVX2 || defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ZN_FRUSTUM_CULLING_SSE2 1
+#else
+    #define ZN_FRUSTUM_CULLING_SSE2 0
+#endif
+
+namespace Zn
+{
+// Normalized planes facing the inside of a view frustum: a point p is inside when dot(plane.xyz, p) + plane.w >= 0 for every plane.
+struct RHIFrustum
+{
+    enum Plane : u8
+    {
+        Left,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        COUNT
+    };
+
+    glm::vec4 planes[Plane::COUNT];
+
+    // Planes of the clip volume of viewProjection. The near plane is the one of a [-1, 1] depth range, which contains the [0, 1] one.
+    static RHIFrustum FromViewProjection(const glm::mat4& viewProjection);
+};
+
+// Bounding spheres as one stream per component, so that the culling loads the components of 4 or 8 spheres at once.
+struct RHIBoundingSpheres
+{
+    Vector<f32> centerX;
+    Vector<f32> centerY;
+    Vector<f32> centerZ;
+    Vector<f32> radius;
+
+    void Add(const glm::vec3& center, f32 radius_);
+
+    void Clear();
+
+    sizet Size() const
+    {
+        return radius.size();
+    }
+};
+
+// Sphere against frustum tests. The widest instruction set enabled at compile time is used (AVX2, then SSE2), with a scalar
+// fallback. Spheres crossing a plane are visible.
+class RHIFrustumCulling
+{
+  public:
+    // Writes 1 to outVisible[index - first] for the spheres in [first, first + count) intersecting the frustum, 0 for the others.
+    // Returns the number of visible spheres.
+    static u32 Cull(const RHIFrustum& frustum, const RHIBoundingSpheres& spheres, sizet first, sizet count, u8* outVisible);
+
+    static bool IsVisible(const RHIFrustum& frustum, const glm::vec3& center, f32 radius);
+};
+} // namespace Zn
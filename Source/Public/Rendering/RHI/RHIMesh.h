@@ -4,6 +4,7 @@
 #include <Rendering/RHI/RHI.h>
 #include <Rendering/RHI/RHITypes.h>
 #include <Rendering/RHI/RHIVertex.h>
+#include <span>
 
 namespace Zn
 {
@@ -47,11 +48,14 @@ struct MaterialAttributes
     f32            alphaCutoff = 0.5f;
     AlphaMode      alphaMode   = AlphaMode::Opaque;
     bool           doubleSided = false;
+    u8             padding[2]  = {};
     ResourceHandle baseColorTexture {};
     ResourceHandle metalnessTexture {};
     ResourceHandle normalTexture {};
     ResourceHandle occlusionTexture {};
     ResourceHandle emissiveTexture {};
+
+    bool operator==(const MaterialAttributes&) const = default;
 };
 
 struct alignas(16) UBOMaterialAttributes
@@ -91,6 +95,18 @@ struct TextureSampler
     SamplerWrap   wrapUV[3];
 };
 
+// Coarser level of detail of a primitive, drawing the same vertices with fewer triangles.
+struct RHIPrimitiveLOD
+{
+    u32 firstIndex = 0;
+    u32 numIndices = 0;
+
+    // Estimated distance to the full detail surface, in the primitive space.
+    f32 error = 0.f;
+
+    bool operator==(const RHIPrimitiveLOD&) const = default;
+};
+
 struct RHIPrimitive
 {
     glm::mat4          matrix;
@@ -102,20 +118,68 @@ struct RHIPrimitive
     Vector<u32>        indices;
     PrimitiveTopology  topology;
     MaterialAttributes materialAttributes;
+
+    // Ordered from the finest to the coarsest, indexing into lodIndices. indices is the full detail level.
+    Vector<RHIPrimitiveLOD> lods;
+    Vector<u32>             lodIndices;
+};
+
+// Non-owning view of the primitive streams, over an RHIPrimitive or over a cooked mesh mapped in memory.
+struct RHIPrimitiveView
+{
+    glm::mat4                  matrix;
+    std::span<const glm::vec3> position;
+    std::span<const glm::vec3> normal;
+    std::span<const glm::vec4> tangent;
+    std::span<const glm::vec2> uv;
+    std::span<const glm::vec4> color;
+    std::span<const u32>       indices;
+    PrimitiveTopology          topology;
+    MaterialAttributes         materialAttributes;
+
+    std::span<const RHIPrimitiveLOD> lods;
+    std::span<const u32>             lodIndices;
+
+    static RHIPrimitiveView From(const RHIPrimitive& primitive)
+    {
+        return RHIPrimitiveView {
+            .matrix             = primitive.matrix,
+            .position           = primitive.position,
+            .normal             = primitive.normal,
+            .tangent            = primitive.tangent,
+            .uv                 = primitive.uv,
+            .color              = primitive.color,
+            .indices            = primitive.indices,
+            .topology           = primitive.topology,
+            .materialAttributes = primitive.materialAttributes,
+            .lods               = primitive.lods,
+            .lodIndices         = primitive.lodIndices,
+        };
+    }
 };
 
 struct RHIPrimitiveGPU
 {
     glm::mat4          matrix;
-    RHIBuffer          position;
-    RHIBuffer          normal;
-    RHIBuffer          tangent;
-    RHIBuffer          uv;
-    RHIBuffer          color;
-    RHIBuffer          indices;
     u32                numVertices;
     u32                numIndices;
     MaterialAttributes materialAttributes;
     RHIBuffer          uboMaterialAttributes;
+
+    // Vertices and indices are suballocated from the buffers of a geometry block, shared by many primitives.
+    u32 geometryBlock = 0;
+    u32 vertexOffset  = 0;
+    u32 firstIndex    = 0;
+
+    // Levels of detail index into the same buffer, after the numIndices of the full detail level. Their first index is relative to
+    // the one of the primitive.
+    Vector<RHIPrimitiveLOD> lods;
+
+    // Bounding sphere in the primitive space.
+    glm::vec3 boundsCenter = glm::vec3(0.f);
+    f32       boundsRadius = 0.f;
+
+    // Applied before matrix when the vertex streams are quantized, see RHIQuantizedPrimitive.
+    glm::mat4 dequantization = glm::mat4(1.f);
 };
 } // namespace Zn
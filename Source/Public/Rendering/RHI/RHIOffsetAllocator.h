@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Core/Containers/Map.h>
+#include <Core/Containers/Set.h>
+#include <Core/HAL/BasicTypes.h>
+#include <optional>
+#include <utility>
+
+namespace Zn
+{
+// Suballocates ranges of a fixed capacity, in any unit (vertices, indices, bytes). Nothing is stored in the managed memory, so it
+// works for GPU buffers.
+// Allocations take the smallest free range that fits, freed ranges are merged with their free neighbours.
+class RHIOffsetAllocator
+{
+  public:
+    void Initialize(u32 capacity_);
+
+    // Returns the offset of size units, nullopt when no free range is large enough.
+    std::optional<u32> Allocate(u32 size);
+
+    // size must be the one offset was allocated with.
+    void Free(u32 offset, u32 size);
+
+    u32 GetCapacity() const
+    {
+        return capacity;
+    }
+
+    u32 GetFreeSize() const
+    {
+        return freeSize;
+    }
+
+    u32 GetLargestFreeRange() const;
+
+    u32 GetNumFreeRanges() const
+    {
+        return static_cast<u32>(freeRanges.size());
+    }
+
+  private:
+    void AddFreeRange(u32 offset, u32 size);
+
+    void RemoveFreeRange(Map<u32, u32>::iterator range);
+
+    u32 capacity = 0;
+    u32 freeSize = 0;
+
+    // Size of the free ranges by offset, to find the neighbours of a freed range.
+    Map<u32, u32> freeRanges;
+
+    // Free ranges as (size, offset), to find the best fit.
+    Set<std::pair<u32, u32>> freeRangesBySize;
+};
+} // namespace Zn
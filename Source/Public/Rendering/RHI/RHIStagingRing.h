@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <deque>
+#include <optional>
+
+namespace Zn
+{
+// Hands out the ranges of a staging buffer in order, and takes them back in order once the GPU is done reading them.
+// Every allocation is retired with the value its reader signals on a timeline, Reclaim frees the allocations whose value the timeline
+// reached. An allocation is never split across the end of the buffer, the space left at the end is skipped instead.
+class RHIStagingRing
+{
+  public:
+    // Value of the allocations handed out and not retired yet, their memory may still be written.
+    static constexpr u64 kNotRetired = ~0ull;
+
+    struct Allocation
+    {
+        u64 offset   = 0;
+        u64 sequence = 0;
+    };
+
+    // capacity must be a multiple of alignment.
+    void Initialize(u64 capacity_, u64 alignment_);
+
+    // Returns nullopt when the free space can't hold size bytes.
+    std::optional<Allocation> Allocate(u64 size);
+
+    // The allocation is freed once the timeline reaches value, 0 frees it with the next Reclaim.
+    void Retire(u64 sequence, u64 value);
+
+    void Reclaim(u64 completedValue);
+
+    // Value the oldest allocation waits for, nullopt if there are none.
+    std::optional<u64> GetOldestRetireValue() const;
+
+    u64 GetCapacity() const
+    {
+        return capacity;
+    }
+
+    u64 GetUsedSize() const
+    {
+        return head - tail;
+    }
+
+  private:
+    struct Range
+    {
+        // Offsets grow forever, the buffer offset is the remainder of the division by the capacity.
+        u64 end         = 0;
+        u64 retireValue = kNotRetired;
+    };
+
+    u64 capacity  = 0;
+    u64 alignment = 1;
+    u64 head      = 0;
+    u64 tail      = 0;
+
+    std::deque<Range> ranges;
+    u64               firstSequence = 0;
+};
+} // namespace Zn
@@ -11,6 +11,8 @@ struct RHITexture
 
     i32 height;
 
+    u32 numMips = 1;
+
     vk::Format format;
 
     vk::Image image;
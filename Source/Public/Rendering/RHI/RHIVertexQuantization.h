@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+
+namespace Zn
+{
+struct RHIPrimitiveView;
+
+// Compact vertex streams, 20 bytes per vertex instead of the 48 bytes of the float streams:
+// - position: unorm16x4 relative to the primitive bounds, w is unused.
+// - normal: octahedral snorm16x2.
+// - tangent: octahedral snorm16x2, the bitangent sign is stored in the sign of y.
+// - uv: half2.
+// Must match VulkanPipeline::gltfQuantizedInputLayout and the decoding in vertex_quantized.vert.
+struct RHIQuantizedPrimitive
+{
+    Vector<glm::u16vec4> position;
+    Vector<u32>          normal;
+    Vector<u32>          tangent;
+    Vector<u32>          uv;
+
+    // Maps the unorm positions back to the primitive space. The scale is the same on every axis, so that the normals and the
+    // tangents don't have to be corrected when the dequantization is folded into the model matrix.
+    glm::mat4 dequantization = glm::mat4(1.f);
+};
+
+class RHIVertexQuantization
+{
+  public:
+    // A zero vector is encoded as +z.
+    static u32       EncodeOctahedral(const glm::vec3& normal);
+    static glm::vec3 DecodeOctahedral(u32 encoded);
+
+    // A zero tangent is replaced by one orthogonal to the normal, picked as the vertex shader did for the float streams.
+    static u32       EncodeTangent(const glm::vec4& tangent, const glm::vec3& normal);
+    static glm::vec4 DecodeTangent(u32 encoded);
+
+    // Missing normals, tangents and uvs are encoded as if zero.
+    static void Quantize(const RHIPrimitiveView& primitive, RHIQuantizedPrimitive& outPrimitive);
+};
+} // namespace Zn
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <Core/HAL/BasicTypes.h>
+#include <Core/Event.h>
 #include <Rendering/RendererTypes.h>
 
 namespace Zn
 {
+class Window;
+
 enum RendererBackendType
 {
     Vulkan,
@@ -33,6 +36,15 @@ class Renderer
   private:
     static UniquePtr<Renderer> instance;
 
+    // Forwards the resize, minimize and restore events of the window to the backend.
+    void BindWindowEvents(const SharedPtr<Window>& inWindow);
+    void UnbindWindowEvents();
+
+    SharedPtr<Window> window;
+    DelegateHandle    resizedHandle;
+    DelegateHandle    minimizedHandle;
+    DelegateHandle    restoredHandle;
+
   protected:
     Renderer() = default;
 };
@@ -1,9 +1,14 @@
 #pragma once
 
-#include <Core/Containers/Map.h>
+#include <Core/Containers/FlatMap.h>
+#include <Core/IO/IO.h>
+#include <Rendering/RHI/RHIFrustumCulling.h>
+#include <Rendering/RHI/RHIInstanceData.h>
+#include <Rendering/RHI/RHIOffsetAllocator.h>
 #include <Rendering/RHI/RHITypes.h>
 #include <Rendering/RHI/Vulkan/Vulkan.h>
 #include <Rendering/Vulkan/VulkanTypes.h>
+#include <Rendering/Vulkan/VulkanUploadManager.h>
 #include <Rendering/RendererTypes.h>
 #include <deque>
 #include <functional>
@@ -19,6 +24,8 @@ class Texture;
 struct ResourceHandle;
 struct TextureSampler;
 struct RHIPrimitiveGPU;
+struct RHIPrimitiveView;
+enum class TextureCompression : u8;
 
 class VulkanDevice
 {
@@ -50,6 +57,9 @@ class VulkanDevice
 
     static constexpr size_t kMaxFramesInFlight = 2;
 
+    // position, normal, tangent, uv, color
+    static constexpr size_t kMaxVertexStreams = 5;
+
     bool HasRequiredDeviceExtensions(vk::PhysicalDevice inDevice) const;
 
     vk::PhysicalDevice SelectPhysicalDevice(const Vector<vk::PhysicalDevice>& inDevices) const;
@@ -60,7 +70,7 @@ class VulkanDevice
 
     Vector<vk::DeviceQueueCreateInfo> BuildQueueCreateInfo(const QueueFamilyIndices& InIndices) const;
 
-    vk::ShaderModule CreateShaderModule(const Vector<uint8>& bytes);
+    vk::ShaderModule CreateShaderModule(std::span<const uint8> bytes);
 
     void CreateDescriptors();
     void CreateSwapChain();
@@ -102,6 +112,12 @@ class VulkanDevice
 
     vk::CommandPool           commandPool;
     Vector<vk::CommandBuffer> commandBuffers;
+
+    // Secondary command buffers of the render pass, one pool per draw chunk and frame so that each is only used by the thread recording
+    // its chunk. The pools of a frame are reset once its fence is signaled.
+    Vector<vk::CommandPool>   drawCommandPools[kMaxFramesInFlight];
+    Vector<vk::CommandBuffer> drawCommandBuffers[kMaxFramesInFlight];
+    vk::CommandBuffer         imguiCommandBuffers[kMaxFramesInFlight];
     GPUTraceContextPtr        gpuTraceContexts[kMaxFramesInFlight];
 
     vk::RenderPass          renderPass;
@@ -114,9 +130,13 @@ class VulkanDevice
     vk::DescriptorSetLayout   globalDescriptorSetLayout {};
     Vector<vk::DescriptorSet> globalDescriptorSets;
 
+    // Model matrix of each drawn object, read as a per instance vertex stream indexed by firstInstance.
     RHIBuffer instanceData[kMaxFramesInFlight];
     RHIBuffer drawCommands[kMaxFramesInFlight];
 
+    // Batches are drawn with one drawIndexedIndirect each, a drawIndexed per object otherwise.
+    bool bIndirectDraws = false;
+
     vk::DescriptorPool imguiDescriptorPool;
 
     static const Vector<const char*> kDeviceExtensions;
@@ -151,16 +171,43 @@ class VulkanDevice
     // == Scene Management ==
 
     Vector<RenderObject>                   renderables;
-    UnorderedMap<ResourceHandle, RHIMesh*> meshes;
+    FlatMap<ResourceHandle, RHIMesh*>      meshes;
     Vector<RHIPrimitiveGPU*>               gpuPrimitives;
 
-    // TODO: JUST A TEST
-    UnorderedMap<RHIPrimitiveGPU*, vk::DescriptorSet> gpuPrimitivesDescriptorSets;
+    // Per frame scratch of DrawObjects, kept to avoid reallocating them every frame.
+    Vector<u64>                            drawKeys;
+    Vector<u64>                            scratchDrawKeys;
+    Vector<u32>                            drawOrder;
+    Vector<u32>                            scratchDrawOrder;
+    Vector<const RenderObject*>            sortedRenderables;
+    Vector<RHIInstanceData>                drawInstances;
+    Vector<vk::DrawIndexedIndirectCommand> indirectCommands;
+    Vector<IndirectDrawBatch>              drawBatches;
+
+    DrawStats drawStats;
+
+    // World space bounds of the renderables, in the same order.
+    RHIBoundingSpheres   renderableBounds;
+    Vector<u8>           renderableVisibility;
+    Vector<RenderObject> visibleRenderables;
+
+    CullStats cullStats;
+
+    // Fills visibleRenderables with the renderables intersecting the frustum of viewProjection.
+    void CullRenderables(const glm::mat4& viewProjection);
 
     RHIMesh* GetMesh(const String& InName);
 
+    // Sorts the objects by RHIDrawSortKey, to draw them in as few batches as possible. The batches are split in chunks recorded in
+    // parallel into secondary command buffers, executed from commandBuffer.
     void DrawObjects(vk::CommandBuffer commandBuffer, RenderObject* first, u64 count);
 
+    // Records the batches [firstBatch, lastBatch) of the last DrawObjects, counting the state changes into outStats.
+    void RecordDrawBatches(vk::CommandBuffer commandBuffer, u32 firstBatch, u32 lastBatch, DrawStats& outStats);
+
+    // Begins a secondary command buffer continuing the render pass on the current swap chain framebuffer.
+    void BeginSecondaryCommandBuffer(vk::CommandBuffer commandBuffer) const;
+
     void CreateScene();
 
     // ==================
@@ -181,10 +228,48 @@ class VulkanDevice
     void CreateDefaultResources();
     void LoadMeshes();
 
-    RHIBuffer CreateRHIBuffer(const void* data, sizet size, vk::BufferUsageFlags bufferUsage, vma::MemoryUsage memoryUsage) const;
+    // Loads the mesh through the derived data cache. Returns false if the source has to be imported instead, textures that fail to
+    // load don't fail the mesh.
+    bool LoadCookedMesh(const String& sourcePath);
+
+    RHIPrimitiveGPU* CreatePrimitive(const RHIPrimitiveView& cpuPrimitive);
+
+    // Vertex streams and indices of many primitives, suballocated in vertices and in indices. Draws from the same block only differ
+    // by their offsets, its buffers are bound once.
+    struct GeometryBlock
+    {
+        // One buffer per binding of the primitive input layout.
+        Vector<RHIBuffer>  vertexStreams;
+        RHIBuffer          indices;
+        RHIOffsetAllocator vertexAllocator;
+        RHIOffsetAllocator indexAllocator;
+    };
+
+    static constexpr u32 kGeometryBlockVertices = 1 << 20;
+    static constexpr u32 kGeometryBlockIndices  = 1 << 22;
+
+    Vector<GeometryBlock> geometryBlocks;
+
+    // Places the vertices and numIndices indices of the primitive in the first block with room for them, or in a new block.
+    void AllocateGeometry(RHIPrimitiveGPU& primitive, u32 numIndices);
+
+    void CreateGeometryBlock(u32 numVertices, u32 numIndices);
+
+    void BindGeometryBlock(vk::CommandBuffer commandBuffer, u32 block) const;
+
+    // data holds one element per vertex of the primitive, in the format of the stream binding.
+    void UploadVertexStream(const RHIPrimitiveGPU& primitive, u32 stream, const void* data, sizet size);
+
+    // Starts reading the mesh pipeline shaders on the IO threads, so they load while the device is being created.
+    void RequestMeshPipelineShaders();
 
     void CreateMeshPipeline();
 
+    Vector<std::future<IOReadResult>> pendingShaderReads;
+
+    // Primitives are uploaded as RHIQuantizedPrimitive streams and drawn with VulkanPipeline::gltfQuantizedInputLayout.
+    bool quantizedVertices = false;
+
     // ===================
 
     // == Texture ==
@@ -192,14 +277,21 @@ class VulkanDevice
     RHITexture* CreateTexture(const String& texture);
     RHITexture* CreateTexture(const String& name, SharedPtr<struct TextureSource> texture);
 
-    RHITexture* CreateRHITexture(i32 width, i32 height, vk::Format format) const;
+    // staging holds the levels of the texture as imported, it is recorded for upload or discarded.
+    RHITexture* CreateTexture(const String& name, const struct TextureDescription& description, const VulkanStagingAllocation& staging);
+
+    RHITexture* CreateRHITexture(i32 width, i32 height, vk::Format format, u32 numMips = 1) const;
     vk::Sampler CreateSampler(const TextureSampler& sampler, u32 numMips);
 
-    void TransitionImageLayout(
-        vk::CommandBuffer cmd, vk::Image img, vk::Format fmt, vk::ImageLayout prevLayout, vk::ImageLayout newLayout) const;
+    void TransitionImageLayout(vk::CommandBuffer cmd,
+                               vk::Image         img,
+                               vk::Format        fmt,
+                               vk::ImageLayout   prevLayout,
+                               vk::ImageLayout   newLayout,
+                               u32               numMips = 1) const;
 
     // UnorderedMap<String, AllocatedImage> textures;
-    UnorderedMap<ResourceHandle, RHITexture*> textures;
+    FlatMap<ResourceHandle, RHITexture*> textures;
 
     vk::DescriptorSetLayout singleTextureSetLayout;
 
@@ -207,19 +299,20 @@ class VulkanDevice
 
     // == Command Buffer ==
 
-    struct UploadContext
-    {
-        vk::CommandPool    commandPool {VK_NULL_HANDLE};
-        vk::CommandBuffer  cmdBuffer {VK_NULL_HANDLE};
-        vk::Fence          fence {VK_NULL_HANDLE};
-        GPUTraceContextPtr traceContext {nullptr};
-    };
-
-    UploadContext uploadContext {};
+    // Resources are uploaded in batches, each frame waits for the batches submitted before it.
+    VulkanUploadManager uploadManager;
 
-    void ImmediateSubmit(std::function<void(vk::CommandBuffer)>&& function) const;
+    // The graphics and the transfer families when they differ, upload destinations are shared by both.
+    Vector<u32> uploadQueueFamilies;
 
-    void CopyBufferToImage(vk::CommandBuffer cmd, vk::Buffer buffer, vk::Image img, u32 width, u32 height) const;
+    void CopyBufferToImage(vk::CommandBuffer  cmd,
+                           vk::Buffer         buffer,
+                           vk::DeviceSize     bufferOffset,
+                           vk::Image          img,
+                           u32                width,
+                           u32                height,
+                           u32                numMips,
+                           TextureCompression compression) const;
 
     vk::ImageCreateInfo     MakeImageCreateInfo(vk::Format format, vk::ImageUsageFlags usageFlags, vk::Extent3D extent, u32 numMips) const;
     vk::ImageViewCreateInfo MakeImageViewCreateInfo(vk::Format format, vk::Image image, vk::ImageAspectFlagBits aspectFlags) const;
@@ -10,8 +10,12 @@ class VulkanPipeline
   public:
     static const RHIInputLayout defaultInputLayout;
     static const RHIInputLayout gltfInputLayout;
+    static const RHIInputLayout gltfQuantizedInputLayout;
     static const RHIInputLayout defaultIndirectInputLayout;
 
+    // Per instance RHIInstanceData of gltfInputLayout and gltfQuantizedInputLayout, after their vertex streams.
+    static constexpr u32 kInstanceBinding = 4;
+
     static vk::PipelineShaderStageCreateInfo CreateShaderStage(vk::ShaderStageFlagBits stageFlags, vk::ShaderModule shaderModule);
 
     static vk::PipelineInputAssemblyStateCreateInfo CreateInputAssembly(vk::PrimitiveTopology topology);
@@ -15,6 +15,9 @@ struct QueueFamilyIndices
 {
     std::optional<uint32> Graphics;
     std::optional<uint32> Present;
+
+    // A transfer only family when the device has one, the graphics family otherwise.
+    std::optional<uint32> Transfer;
 };
 
 struct SwapChainDetails
@@ -24,16 +27,40 @@ struct SwapChainDetails
     Vector<vk::PresentModeKHR>   PresentModes;
 };
 
-struct MeshPushConstants
+struct RenderObject
 {
-    glm::mat4 model;
-    glm::mat4 model_inverse;
+    RHIPrimitiveGPU*  primitive;
+    Material*         material;
+    vk::DescriptorSet materialSet;
+
+    // RHIDrawSortKey of the object state, without the depth.
+    u64 sortKey = 0;
 };
 
-struct RenderObject
+// Consecutive sorted RenderObjects with the same sort key state, drawn with a single drawIndexedIndirect.
+struct IndirectDrawBatch
+{
+    const RenderObject* object;
+    u32                 first;
+    u32                 count;
+};
+
+// State changes recorded by the last DrawObjects.
+struct DrawStats
+{
+    u32 numObjects         = 0;
+    u32 numBatches         = 0;
+    u32 numDrawCalls       = 0;
+    u32 numPipelineBinds   = 0;
+    u32 numDescriptorBinds = 0;
+    u32 numGeometryBinds   = 0;
+};
+
+// Renderables tested by the last CullRenderables.
+struct CullStats
 {
-    RHIPrimitiveGPU* primitive;
-    Material*        material;
+    u32 numVisible = 0;
+    u32 numCulled  = 0;
 };
 
 struct GPUCameraData
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <Core/HAL/BasicTypes.h>
+#include <Rendering/RHI/RHIStagingRing.h>
+#include <Rendering/RHI/Vulkan/Vulkan.h>
+#include <deque>
+#include <span>
+
+namespace Zn
+{
+// Staging memory of an upload, written by the caller before the copies reading it are recorded.
+struct VulkanStagingAllocation
+{
+    vk::Buffer     buffer;
+    vk::DeviceSize offset = 0;
+    std::span<u8>  data;
+
+    // Ring allocations only.
+    u64 sequence = 0;
+
+    // Allocations that don't fit in the ring get a buffer of their own.
+    vma::Allocation dedicatedAllocation;
+};
+
+// Batches the copies of resource uploads in a few submissions, on the transfer queue when the device has one.
+// Data is staged in a persistently mapped ring buffer. Every submission signals a timeline semaphore with its own value, the ring
+// space of its uploads is reclaimed once the semaphore reaches it. The frames wait on the semaphore before reading uploaded resources.
+class VulkanUploadManager
+{
+  public:
+    static constexpr vk::DeviceSize kDefaultRingSize = 64ull * 1024 * 1024;
+
+    // Copy offsets are aligned to the largest texel block.
+    static constexpr vk::DeviceSize kStagingAlignment = 16;
+
+    void Initialize(vk::Device device_, vma::Allocator allocator_, vk::Queue queue_, u32 queueFamily_, vk::DeviceSize ringSize_);
+
+    // Waits for the submitted uploads, then destroys every staging buffer.
+    void Shutdown();
+
+    // Returns size bytes of staging memory. When the ring is full the recorded uploads are submitted and the oldest ones waited
+    // for, uploads whose staging memory is still being written are never waited for.
+    VulkanStagingAllocation AllocateStaging(sizet size);
+
+    // Returns the command buffer of the current batch, to record the copies reading staging. staging is released with the batch.
+    vk::CommandBuffer RecordUpload(const VulkanStagingAllocation& staging);
+
+    // Releases staging memory that no upload is going to read.
+    void Discard(const VulkanStagingAllocation& staging);
+
+    // Stages data and records its copy to destination.
+    void UploadBuffer(vk::Buffer destination, const void* data, sizet size, vk::DeviceSize destinationOffset = 0);
+
+    // Submits the recorded uploads. Returns the value the timeline semaphore reaches once every upload submitted so far is done.
+    u64 Flush();
+
+    // Blocks until the uploads submitted up to value are done, then reclaims their staging memory.
+    void Wait(u64 value);
+
+    vk::Semaphore GetTimelineSemaphore() const
+    {
+        return timelineSemaphore;
+    }
+
+    u64 GetSubmittedValue() const
+    {
+        return submittedValue;
+    }
+
+    u32 GetNumSubmits() const
+    {
+        return numSubmits;
+    }
+
+  private:
+    struct DedicatedBuffer
+    {
+        vk::Buffer      buffer;
+        vma::Allocation allocation;
+        u64             retireValue = 0;
+    };
+
+    struct Batch
+    {
+        vk::CommandBuffer cmd;
+        u64               value = 0;
+    };
+
+    // Frees the staging memory of the completed batches and recycles their command buffers.
+    void Reclaim();
+
+    // The staging memory is freed once the timeline semaphore reaches value.
+    void Retire(const VulkanStagingAllocation& staging, u64 value);
+
+    vk::Device     device;
+    vma::Allocator allocator;
+    vk::Queue      queue;
+
+    vk::CommandPool   commandPool;
+    vk::Semaphore     timelineSemaphore;
+    vk::CommandBuffer recordingCmd;
+
+    RHIStagingRing  ring;
+    vk::Buffer      ringBuffer;
+    vma::Allocation ringAllocation;
+    u8*             ringData = nullptr;
+
+    Vector<DedicatedBuffer>   dedicatedBuffers;
+    std::deque<Batch>         pendingBatches;
+    Vector<vk::CommandBuffer> freeCmds;
+
+    u64 submittedValue = 0;
+    u64 completedValue = 0;
+    u32 numSubmits     = 0;
+};
+} // namespace Zn
@@ -0,0 +1,17 @@
+#pragma once
+#include "Core/HAL/BasicTypes.h"
+#include "Core/IO/MappedFile.h"
+
+namespace Zn
+{
+class WindowsFile
+{
+  public:
+    // Maps the whole file read-only. An empty file succeeds with a null view, since it can't be mapped.
+    static bool MapReadOnly(const String& filename, EFileAccessPattern accessPattern, const uint8*& outData, sizet& outSize);
+
+    static void Unmap(const uint8* data);
+
+    static void Prefetch(const uint8* data, sizet size);
+};
+} // namespace Zn
@@ -4,6 +4,7 @@
 #include "Windows/WindowsThreads.h"
 #include "Windows/WindowsCriticalSection.h"
 #include "Windows/WindowsMemory.h"
+#include "Windows/WindowsFile.h"
 #include "Windows/WindowsMisc.h"
 
 namespace Zn
@@ -12,6 +13,7 @@ typedef WindowsMemory        PlatformMemory;
 typedef WindowsVirtualMemory PlatformVirtualMemory;
 typedef WindowsMisc          PlatformMisc;
 typedef WindowsThreads       PlatformThreads;
+typedef WindowsFile          PlatformFile;
 
 typedef WindowsCriticalSection CriticalSection;
 } // namespace Zn
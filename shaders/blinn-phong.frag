@@ -116,6 +116,13 @@ vec3 encode_srgb( vec3 c ) {
     return clamp( result, 0.0, 1.0 );
 }
 
+// Normal maps may be BC5, which only keeps x and y: z is rebuilt from them.
+vec3 decodeNormal( vec2 encoded )
+{
+    vec2 xy = encoded * 2.0 - vec2(1.0);
+    return vec3(xy, sqrt(max(1.0 - dot(xy, xy), 0.0)));
+}
+
 vec3 applyDirectionalLight(DirectionalLight light, vec3 normal, vec3 viewDir) 
 {
     vec3 lightDir = normalize(light.direction.xyz);
@@ -143,7 +150,7 @@ vec3 applyPointLight(PointLight light, vec3 normal, vec4 fragPos, vec3 viewDir)
 
 void main() 
 {
-    vec3 normal = normalize(texture(sampler_pbr_textures[PBR_INDEX_NORMAL], inUV).rgb * 2.0 - 1.0);
+    vec3 normal = normalize(decodeNormal(texture(sampler_pbr_textures[PBR_INDEX_NORMAL], inUV).rg));
     vec3 tangent = normalize(inTangent.xyz);
     vec3 bitangent = cross(normalize(inNormal), tangent) * 1;
 
@@ -99,6 +99,13 @@ float heaviside( float v ) {
     else return 0.0;
 }
 
+// Normal maps may be BC5, which only keeps x and y: z is rebuilt from them.
+vec3 decodeNormal( vec2 encoded )
+{
+    vec2 xy = encoded * 2.0 - vec2(1.0);
+    return vec3(xy, sqrt(max(1.0 - dot(xy, xy), 0.0)));
+}
+
 vec3 calculateNormal()
 {
     vec3 normal = normalize( vNormal );
@@ -112,7 +119,7 @@ vec3 calculateNormal()
         normal *= -1.0;
     }
     
-    vec3 bump_normal = normalize( texture(uTexture[PBR_INDEX_NORMAL], vTexCoord).rgb * 2.0 - vec3(1.0));
+    vec3 bump_normal = normalize( decodeNormal(texture(uTexture[PBR_INDEX_NORMAL], vTexCoord).rg) );
     mat3 TBN = mat3(
         tangent,
         bitangent,
@@ -5,6 +5,9 @@ layout (location = 1) in vec3 normal;
 layout (location = 2) in vec4 tangent;
 layout (location = 3) in vec2 uv;
 
+// Per instance, see RHIInstanceData.
+layout (location = 4) in mat4 model;
+
 layout (location = 0) out vec3 vPosition;
 layout (location = 1) out vec3 vNormal;
 layout (location = 2) out vec3 vTangent;
@@ -19,18 +22,12 @@ layout(std140, set = 0, binding = 0) uniform CameraBuffer
 	mat4 view_projection;
 } camera;
 
-layout(push_constant) uniform PushConstants
-{
-	mat4 model;
-	mat4 model_inverse;
-} push_constants;
-
 void main()
 {
-	vec4 worldPosition = push_constants.model * vec4(position, 1.0f);
+	vec4 worldPosition = model * vec4(position, 1.0f);
 	gl_Position = camera.view_projection * worldPosition;
 	vPosition = worldPosition.xyz / worldPosition.w;	
-	vNormal = mat3(push_constants.model) * normal;
+	vNormal = mat3(model) * normal;
 
 	vec4 thisTangent = tangent;
 	if(tangent.xyz == vec3(0.0))
@@ -43,7 +40,7 @@ void main()
 		thisTangent.w = 1.f;
 	} else
 	{
-		vTangent = normalize(mat3(push_constants.model) * tangent.xyz);
+		vTangent = normalize(mat3(model) * tangent.xyz);
 	}
 
 	vBiTangent = cross( vNormal, vTangent ) * thisTangent.w;
@@ -0,0 +1,49 @@
+#version 450
+
+// Vertex streams of RHIQuantizedPrimitive.
+// The position dequantization is folded into the model matrix, its scale is uniform so normals and tangents only need normalizing.
+layout (location = 0) in vec4 position;
+layout (location = 1) in vec2 normal;
+layout (location = 2) in vec2 tangent;
+layout (location = 3) in vec2 uv;
+
+// Per instance, see RHIInstanceData.
+layout (location = 4) in mat4 model;
+
+layout (location = 0) out vec3 vPosition;
+layout (location = 1) out vec3 vNormal;
+layout (location = 2) out vec3 vTangent;
+layout (location = 3) out vec3 vBiTangent;
+layout (location = 4) out vec2 vUV;
+
+layout(std140, set = 0, binding = 0) uniform CameraBuffer
+{
+	vec4 position;
+	mat4 view;
+	mat4 projection;
+	mat4 view_projection;
+} camera;
+
+vec3 DecodeOctahedral(vec2 encoded)
+{
+	vec3 direction = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+	float fold = max(-direction.z, 0.0);
+	direction.x += direction.x >= 0.0 ? -fold : fold;
+	direction.y += direction.y >= 0.0 ? -fold : fold;
+	return normalize(direction);
+}
+
+void main()
+{
+	vec4 worldPosition = model * vec4(position.xyz, 1.0f);
+	gl_Position = camera.view_projection * worldPosition;
+	vPosition = worldPosition.xyz / worldPosition.w;
+	vNormal = normalize(mat3(model) * DecodeOctahedral(normal));
+
+	// The sign of y is the bitangent sign, y itself is remapped to [0, 1].
+	float bitangentSign = tangent.y < 0.0 ? -1.0 : 1.0;
+	vTangent = normalize(mat3(model) * DecodeOctahedral(vec2(tangent.x, abs(tangent.y) * 2.0 - 1.0)));
+
+	vBiTangent = cross( vNormal, vTangent ) * bitangentSign;
+	vUV = uv;
+}